@@ -8,13 +8,26 @@
 #include <Report.hpp>
 
 class Aggregator;
+class ExecutionGroup;
 
 /**
  * Some abstract class used by the receiver and observer
  */
 class Activatable {
  public:
-  Activatable() = default;
+  /**
+   * @param execution_group: group this object runs in. Group 0 is the task that calls `Aggregator::run()`, other
+   * groups get their own task once started by the aggregator.
+   */
+  explicit Activatable(uint8_t execution_group = 0) : execution_group(execution_group) {};
+
+  /**
+   * Get the execution group (affinity) of this object
+   * @return group id
+   */
+  uint8_t get_execution_group() const {
+    return execution_group;
+  }
 
  protected:
   /**
@@ -39,7 +52,11 @@ class Activatable {
    * @param active: true to activate, false to deactivate
    */
   virtual void set_active(bool _activate, _Status& status) final;
+
+  uint8_t execution_group;
+
   friend Aggregator;
+  friend ExecutionGroup;
 };
 
 #endif //SENSOR_HANDLER_INCLUDE_ACTIVATABLE_HPP_
@@ -4,7 +4,7 @@
 
 #include <Aggregator.hpp>
 
-Aggregator::Aggregator() : report() {
+Aggregator::Aggregator() : report(), execution_groups(), scheduler(), cycle_budget(0) {
 
 }
 
@@ -29,6 +29,7 @@ void Aggregator::register_handler(Handler& handler, bool activate /* = true*/) {
     // Create new handler
     handlers[handler_id] = &handler;
     report.handler_stats[handler_id] = HandlerStatus();
+    scheduler.add(handler);
     if(activate) {
       handler.set_active(true, report.handler_stats[handler_id]);
     }
@@ -43,26 +44,83 @@ void Aggregator::register_supervisor(Supervisor& supervisor) {
   supervisor.activate();
 }
 
+bool Aggregator::start_execution_group(uint8_t group_id, int core_id, uint32_t stack_size, uint8_t priority) {
+  if(group_id == 0) {
+    return false;
+  }
+  if(get_execution_group(group_id)) {
+    return true;
+  }
+  auto group = new ExecutionGroup(group_id);
+  for(const auto& w : workers) {
+    if(w.second->get_execution_group() == group_id) {
+      group->add_worker(*w.second, report.worker_stats.at(w.first));
+    }
+  }
+  for(const auto& h : handlers) {
+    if(h.second->get_execution_group() == group_id) {
+      group->add_handler(*h.second, report.handler_stats.at(h.first));
+    }
+  }
+  group->set_cycle_budget(cycle_budget);
+  if(!group->start(workers, core_id, stack_size, priority)) {
+    delete group;
+    return false;
+  }
+  for(const auto& h : handlers) {
+    if(h.second->get_execution_group() == group_id) {
+      scheduler.remove(*h.second);
+    }
+  }
+  execution_groups[group_id] = group;
+  return true;
+}
+
+ExecutionGroup* Aggregator::get_execution_group(uint8_t group_id) const {
+  if(group_id == 0) {
+    return nullptr;
+  }
+  auto group = execution_groups.find(group_id);
+  return group == execution_groups.end() ? nullptr : group->second;
+}
+
 void Aggregator::run() {
+  bool any_changed = false;
+  // get the states from the execution groups
+  for(const auto& g : execution_groups) {
+    if(g.second->collect_statuses(report.worker_stats, report.handler_stats)) {
+      any_changed = true;
+    }
+  }
+  // Handlers deferred in the previous cycle first, the worker_reports are still those of the previous cycle
+  if(scheduler.has_deferred()) {
+    scheduler.run_deferred(report.handler_stats, report.worker_stats);
+    any_changed = true;
+  }
   bool any_new = false;
+  uint32_t produced_at = millis();
   // get worker_reports from the data workers
   for(const auto& w : workers) {
     auto& worker = w.second;
+    if(!worker || get_execution_group(worker->get_execution_group())) {
+      continue;
+    }
     auto& worker_status = report.worker_stats[w.first];
-    if(worker && worker->work(worker_status)) {
+    if(worker->work(worker_status)) {
       any_new = true;
     }
   }
   // If no new worker_reports, skip the cycle
-  if(!any_new) {
+  if(!any_new && !any_changed) {
     return;
   }
-  // Report the worker_reports
-  for(const auto& r : handlers) {
-    auto handler = r.second;
-    if(handler) {
-      handler->try_handle_work(report.handler_stats.at(handler->get_handler_id()), report.worker_stats);
+  if(any_new) {
+    // Pass the worker_reports to the execution groups
+    for(const auto& g : execution_groups) {
+      g.second->post_work(workers, report.worker_stats);
     }
+    // Report the worker_reports
+    scheduler.dispatch(report.handler_stats, report.worker_stats, produced_at);
   }
   // Handle the final report
   for(const auto& report_handler : supervisors) {
@@ -73,9 +131,26 @@ void Aggregator::run() {
 }
 
 void Aggregator::set_worker_active(uint8_t worker_id, bool active) {
-  workers.at(worker_id)->set_active(active, report.worker_stats.at(worker_id));
+  auto worker = workers.at(worker_id);
+  auto group = get_execution_group(worker->get_execution_group());
+  if(group) {
+    group->post_set_active(true, worker_id, active);
+  } else {
+    worker->set_active(active, report.worker_stats.at(worker_id));
+  }
+}
+
+void Aggregator::set_cycle_budget(uint32_t budget) {
+  cycle_budget = budget;
+  scheduler.set_cycle_budget(budget);
 }
 
 void Aggregator::set_handler_active(uint8_t handler_id, bool active) {
-  handlers.at(handler_id)->set_active(active, report.handler_stats.at(handler_id));
+  auto handler = handlers.at(handler_id);
+  auto group = get_execution_group(handler->get_execution_group());
+  if(group) {
+    group->post_set_active(false, handler_id, active);
+  } else {
+    handler->set_active(active, report.handler_stats.at(handler_id));
+  }
 }
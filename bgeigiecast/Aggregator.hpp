@@ -10,6 +10,8 @@
 #include "Handler.hpp"
 #include "Supervisor.hpp"
 #include "Worker.hpp"
+#include "ExecutionGroup.hpp"
+#include "HandlerScheduler.hpp"
 
 /**
  * Some class that collects the data from the workers and passes it to the data handlers.
@@ -17,6 +19,7 @@
  * - workers (that retrieve data/worker_reports)
  * - handlers (handle the work that the workers produced)
  * - supervisors (that handle the full report)
+ * Workers and handlers can be moved to their own task (execution group), see `start_execution_group`.
  */
 class Aggregator {
  public:
@@ -55,20 +58,49 @@ class Aggregator {
    */
   void set_handler_active(uint8_t handler_id, bool active);
 
+  /**
+   * Set the time budget for the handlers to handle the work of a single cycle. Once it is used up, low priority
+   * handlers are deferred to the next cycle. Applies to the main loop and execution groups started after this call.
+   * @param budget: millis, 0 for no budget (default)
+   */
+  void set_cycle_budget(uint32_t budget);
+
+  /**
+   * Run all workers and handlers of an execution group in their own task, pinned to a core. Until the group is
+   * started, its members run in `run()` like the rest. Register all members of the group before starting it.
+   * @param group_id: execution group, anything but 0 (0 is the task calling `run()`)
+   * @param core_id: core to pin the task to
+   * @param stack_size: stack size of the task in bytes
+   * @param priority: priority of the task
+   * @return true if the group is running
+   */
+  bool start_execution_group(uint8_t group_id, int core_id, uint32_t stack_size, uint8_t priority);
+
   /**
    * Run the aggregator
    * Three steps:
    * 1. workers produce work
-   *   - If no fresh work is produced, the next steps are skipped
-   * 2. handlers handle produced work
+   *   - If no fresh work is produced (and no execution group reported changes), the next steps are skipped
+   * 2. handlers handle produced work in order of priority, the work is passed to the execution groups for their
+   *   handlers. Handlers deferred in the previous cycle handle their work before the workers produce new work.
    * 3. supervisor oversees final report
    */
   void run();
 
  private:
+  /**
+   * Get the running execution group
+   * @param group_id
+   * @return nullptr if the group is not running (members run in `run()`)
+   */
+  ExecutionGroup* get_execution_group(uint8_t group_id) const;
+
   std::map<uint8_t, BaseWorker*> workers;
   std::map<uint8_t, Handler*> handlers;
   std::vector<Supervisor*> supervisors;
+  std::map<uint8_t, ExecutionGroup*> execution_groups;
+  HandlerScheduler scheduler;
+  uint32_t cycle_budget;
 
   Report report;
 };
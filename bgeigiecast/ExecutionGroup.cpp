@@ -0,0 +1,245 @@
+#include "ExecutionGroup.hpp"
+
+ExecutionGroup::ExecutionGroup(uint8_t group_id) :
+    _group_id(group_id),
+    _task(nullptr),
+    _workers(),
+    _handlers(),
+    _scheduler(),
+    _worker_stats(),
+    _handler_stats(),
+    _published_worker_stats(),
+    _published_handler_stats(),
+    _work_queue(),
+    _command_queue(),
+    _status_queue() {
+}
+
+void ExecutionGroup::add_worker(BaseWorker& worker, const WorkerStatus& status) {
+  if(_task) {
+    // Members can't be added to a running group
+    return;
+  }
+  _workers[worker.get_worker_id()] = &worker;
+  _worker_stats[worker.get_worker_id()] = status;
+  _published_worker_stats[worker.get_worker_id()] = status;
+}
+
+void ExecutionGroup::add_handler(Handler& handler, const HandlerStatus& status) {
+  if(_task) {
+    // Members can't be added to a running group
+    return;
+  }
+  _handlers[handler.get_handler_id()] = &handler;
+  _scheduler.add(handler);
+  _handler_stats[handler.get_handler_id()] = status;
+  _published_handler_stats[handler.get_handler_id()] = status;
+}
+
+void ExecutionGroup::set_cycle_budget(uint32_t budget) {
+  _scheduler.set_cycle_budget(budget);
+}
+
+bool ExecutionGroup::start(const std::map<uint8_t, BaseWorker*>& source_workers,
+                           int core_id,
+                           uint32_t stack_size,
+                           uint8_t priority) {
+  if(_task) {
+    return true;
+  }
+  if(_workers.size() > EXECUTION_GROUP_MAX_WORKERS || _handlers.size() > EXECUTION_GROUP_MAX_HANDLERS) {
+    // Commands of a state transition could not all be queued
+    return false;
+  }
+  // Prepare a copy of the source worker data for each queue slot, so no allocations are needed while running
+  for(uint16_t i = 0; i < EXECUTION_GROUP_QUEUE_SIZE; ++i) {
+    auto& snapshot = _work_queue.slot(i);
+    snapshot.count = 0;
+    for(const auto& w : source_workers) {
+      if(w.second->get_execution_group() == _group_id || snapshot.count == EXECUTION_GROUP_MAX_WORKERS) {
+        continue;
+      }
+      snapshot.worker_ids[snapshot.count] = w.first;
+      snapshot.data[snapshot.count] = w.second->create_data_copy();
+      ++snapshot.count;
+    }
+  }
+  for(const auto& w : source_workers) {
+    if(w.second->get_execution_group() != _group_id) {
+      _worker_stats[w.first] = WorkerStatus();
+    }
+  }
+
+  char name[16];
+  sprintf(name, "ExecGroup%d", _group_id);
+  return xTaskCreatePinnedToCore(task, name, stack_size, this, priority, &_task, core_id) == pdPASS;
+}
+
+bool ExecutionGroup::post_work(const std::map<uint8_t, BaseWorker*>& source_workers,
+                               const worker_status_t& worker_stats) {
+  WorkSnapshot* snapshot = _work_queue.acquire();
+  if(!snapshot) {
+    return false;
+  }
+  snapshot->produced_at = millis();
+  for(uint8_t i = 0; i < snapshot->count; ++i) {
+    auto worker_id = snapshot->worker_ids[i];
+    auto& status = snapshot->stats[i];
+    status = worker_stats.at(worker_id);
+    if(status.is_fresh()) {
+      source_workers.at(worker_id)->copy_data(snapshot->data[i]);
+      status.data = snapshot->data[i];
+    } else {
+      status.data = nullptr;
+    }
+  }
+  _work_queue.commit();
+  xTaskNotifyGive(_task);
+  return true;
+}
+
+void ExecutionGroup::post_set_active(bool is_worker, uint8_t id, bool active) {
+  while(!_command_queue.push({is_worker, id, active})) {
+    // Only when more commands are posted than the queue is sized for, let the group task catch up
+    xTaskNotifyGive(_task);
+    vTaskDelay(1);
+  }
+  xTaskNotifyGive(_task);
+}
+
+bool ExecutionGroup::collect_statuses(worker_status_t& worker_stats, handler_status_t& handler_stats) {
+  bool any_changed = false;
+  StatusUpdate update{};
+  while(_status_queue.pop(update)) {
+    if(update.is_worker) {
+      auto& status = worker_stats.at(update.id);
+      status.active_state = update.active_state;
+      // Fresh work stays in the group, the data is not available outside of the group task
+      status.status = update.status == WorkerStatus::e_worker_data_read ? WorkerStatus::e_worker_idle : update.status;
+    } else {
+      auto& status = handler_stats.at(update.id);
+      status.active_state = update.active_state;
+      status.status = update.status;
+      status.deadline_misses = update.deadline_misses;
+      status.deferred = update.deferred;
+    }
+    any_changed = true;
+  }
+  return any_changed;
+}
+
+uint8_t ExecutionGroup::get_group_id() const {
+  return _group_id;
+}
+
+uint32_t ExecutionGroup::get_dropped_work() const {
+  return _work_queue.get_dropped();
+}
+
+void ExecutionGroup::task(void* arg) {
+  static_cast<ExecutionGroup*>(arg)->run();
+  vTaskDelete(nullptr);
+}
+
+void ExecutionGroup::run() {
+  for(;;) {
+    // Wait for work or commands, or until a group worker is due
+    ulTaskNotifyTake(pdTRUE, get_wait_ticks());
+
+    Command command{};
+    while(_command_queue.pop(command)) {
+      if(command.is_worker) {
+        _workers.at(command.id)->set_active(command.active, _worker_stats.at(command.id));
+      } else {
+        _handlers.at(command.id)->set_active(command.active, _handler_stats.at(command.id));
+      }
+    }
+
+    // Handlers deferred in the previous cycle first, the worker reports are still those of the previous cycle
+    if(_scheduler.has_deferred()) {
+      _scheduler.run_deferred(_handler_stats, _worker_stats);
+    }
+
+    bool any_new = false;
+    uint32_t produced_at = millis();
+    for(const auto& w : _workers) {
+      if(w.second->work(_worker_stats.at(w.first))) {
+        any_new = true;
+      }
+    }
+
+    WorkSnapshot* snapshot = _work_queue.peek();
+    do {
+      if(snapshot) {
+        apply_snapshot(*snapshot);
+        produced_at = snapshot->produced_at;
+        any_new = true;
+      }
+      if(any_new) {
+        _scheduler.dispatch(_handler_stats, _worker_stats, produced_at);
+      }
+      any_new = false;
+      if(snapshot) {
+        // Handlers are done with the data, the slot can be reused
+        _work_queue.release();
+        snapshot = _work_queue.peek();
+      }
+    } while(snapshot);
+
+    publish_statuses();
+  }
+}
+
+TickType_t ExecutionGroup::get_wait_ticks() const {
+  if(_scheduler.has_deferred()) {
+    return 1;
+  }
+  uint32_t wait = UINT32_MAX;
+  for(const auto& w : _workers) {
+    const auto& status = _worker_stats.at(w.first);
+    if(status.active_state == _Status::e_state_inactive) {
+      continue;
+    }
+    // Failed activations are retried every cycle
+    uint32_t worker_wait = status.active() ? w.second->get_wait_time() : 0;
+    if(worker_wait < wait) {
+      wait = worker_wait;
+    }
+  }
+  if(wait == UINT32_MAX) {
+    return portMAX_DELAY;
+  }
+  // At least one tick, a due worker that produced nothing is polled again on the next tick
+  TickType_t ticks = pdMS_TO_TICKS(wait + portTICK_PERIOD_MS - 1);
+  return ticks ? ticks : 1;
+}
+
+void ExecutionGroup::apply_snapshot(const WorkSnapshot& snapshot) {
+  for(uint8_t i = 0; i < snapshot.count; ++i) {
+    _worker_stats.at(snapshot.worker_ids[i]) = snapshot.stats[i];
+  }
+}
+
+void ExecutionGroup::publish_statuses() {
+  for(const auto& w : _workers) {
+    const auto& current = _worker_stats.at(w.first);
+    auto& published = _published_worker_stats.at(w.first);
+    if(current.active_state != published.active_state || current.status != published.status) {
+      if(_status_queue.push({true, w.first, current.active_state, current.status, 0, 0})) {
+        published = current;
+      }
+    }
+  }
+  for(const auto& h : _handlers) {
+    const auto& current = _handler_stats.at(h.first);
+    auto& published = _published_handler_stats.at(h.first);
+    if(current.active_state != published.active_state || current.status != published.status
+        || current.deadline_misses != published.deadline_misses || current.deferred != published.deferred) {
+      if(_status_queue.push({
+          false, h.first, current.active_state, current.status, current.deadline_misses, current.deferred
+      })) {
+        published = current;
+      }
+    }
+  }
+}
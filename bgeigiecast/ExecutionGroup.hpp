@@ -0,0 +1,166 @@
+#ifndef SENSOR_REPORTER_EXECUTIONGROUP_HPP_
+#define SENSOR_REPORTER_EXECUTIONGROUP_HPP_
+
+#include <map>
+#include <Arduino.h>
+
+#include "Handler.hpp"
+#include "Worker.hpp"
+#include "LockFreeQueue.hpp"
+#include "HandlerScheduler.hpp"
+
+#ifndef EXECUTION_GROUP_MAX_WORKERS
+#define EXECUTION_GROUP_MAX_WORKERS 8
+#endif
+
+#ifndef EXECUTION_GROUP_QUEUE_SIZE
+#define EXECUTION_GROUP_QUEUE_SIZE 4
+#endif
+
+#ifndef EXECUTION_GROUP_MAX_HANDLERS
+#define EXECUTION_GROUP_MAX_HANDLERS 8
+#endif
+
+#ifndef EXECUTION_GROUP_COMMAND_QUEUE_SIZE
+// A state transition deactivates and activates each member at most once
+#define EXECUTION_GROUP_COMMAND_QUEUE_SIZE (2 * (EXECUTION_GROUP_MAX_WORKERS + EXECUTION_GROUP_MAX_HANDLERS))
+#endif
+
+#ifndef EXECUTION_GROUP_STATUS_QUEUE_SIZE
+#define EXECUTION_GROUP_STATUS_QUEUE_SIZE 16
+#endif
+
+/**
+ * Runs a set of workers and handlers in their own FreeRTOS task, pinned to a core. The group gets the work of the
+ * aggregator's workers through a lock-free queue (with its own copy of the data) and reports the states of its own
+ * members back through another queue. Only the aggregator (caller of `Aggregator::run()`) may call the public
+ * functions, only the group task touches the members.
+ */
+class ExecutionGroup {
+ public:
+  explicit ExecutionGroup(uint8_t group_id);
+  virtual ~ExecutionGroup() = default;
+
+  /**
+   * Add a worker to the group, only before the group is started
+   */
+  void add_worker(BaseWorker& worker, const WorkerStatus& status);
+
+  /**
+   * Add a handler to the group, only before the group is started
+   */
+  void add_handler(Handler& handler, const HandlerStatus& status);
+
+  /**
+   * Set the time budget for the handlers of the group, only before the group is started
+   * @param budget: millis, 0 for no budget
+   */
+  void set_cycle_budget(uint32_t budget);
+
+  /**
+   * Start the group task
+   * @param source_workers: workers of the aggregator, their data will be passed to the group
+   * @param core_id: core to pin the task to
+   * @param stack_size: stack size of the task in bytes
+   * @param priority: priority of the task
+   * @return true if the task was created, false if it failed or the group has more members than the command queue
+   * is sized for (EXECUTION_GROUP_MAX_WORKERS / EXECUTION_GROUP_MAX_HANDLERS)
+   */
+  bool start(const std::map<uint8_t, BaseWorker*>& source_workers, int core_id, uint32_t stack_size, uint8_t priority);
+
+  /**
+   * Pass the produced work of the aggregator's workers to the group
+   * @return false if the group still had too much work queued (the work is dropped for this group)
+   */
+  bool post_work(const std::map<uint8_t, BaseWorker*>& source_workers, const worker_status_t& worker_stats);
+
+  /**
+   * Activate / deactivate a member of the group, will be executed in the group task. Commands are never dropped, if
+   * the queue is full this waits until the group task made room.
+   * @param is_worker: true for worker, false for handler
+   * @param id: worker or handler id
+   * @param active
+   */
+  void post_set_active(bool is_worker, uint8_t id, bool active);
+
+  /**
+   * Get the latest states of the group members
+   * @return true if any state changed
+   */
+  bool collect_statuses(worker_status_t& worker_stats, handler_status_t& handler_stats);
+
+  uint8_t get_group_id() const;
+
+  /**
+   * Get the amount of work cycles dropped because the group was too busy
+   */
+  uint32_t get_dropped_work() const;
+
+ private:
+  struct WorkSnapshot {
+    uint32_t produced_at;
+    uint8_t count;
+    uint8_t worker_ids[EXECUTION_GROUP_MAX_WORKERS];
+    WorkerStatus stats[EXECUTION_GROUP_MAX_WORKERS];
+    void* data[EXECUTION_GROUP_MAX_WORKERS];
+  };
+
+  struct Command {
+    bool is_worker;
+    uint8_t id;
+    bool active;
+  };
+
+  struct StatusUpdate {
+    bool is_worker;
+    uint8_t id;
+    _Status::State active_state;
+    int8_t status;
+    uint32_t deadline_misses;
+    uint32_t deferred;
+  };
+
+  static void task(void* arg);
+
+  /**
+   * Main loop of the group task
+   */
+  void run();
+
+  /**
+   * Get the ticks until a member of the group is due, the task sleeps until then unless work or commands are posted
+   * @return portMAX_DELAY if no member is active
+   */
+  TickType_t get_wait_ticks() const;
+
+  /**
+   * Copy the snapshot in the group's own worker states
+   */
+  void apply_snapshot(const WorkSnapshot& snapshot);
+
+  /**
+   * Push all member states that changed since the last publish
+   */
+  void publish_statuses();
+
+  uint8_t _group_id;
+  TaskHandle_t _task;
+
+  std::map<uint8_t, BaseWorker*> _workers;
+  std::map<uint8_t, Handler*> _handlers;
+  HandlerScheduler _scheduler;
+
+  // Owned by the group task
+  worker_status_t _worker_stats;
+  handler_status_t _handler_stats;
+
+  // Last published states, owned by the group task
+  worker_status_t _published_worker_stats;
+  handler_status_t _published_handler_stats;
+
+  LockFreeQueue<WorkSnapshot, EXECUTION_GROUP_QUEUE_SIZE> _work_queue;
+  LockFreeQueue<Command, EXECUTION_GROUP_COMMAND_QUEUE_SIZE> _command_queue;
+  LockFreeQueue<StatusUpdate, EXECUTION_GROUP_STATUS_QUEUE_SIZE> _status_queue;
+};
+
+#endif //SENSOR_REPORTER_EXECUTIONGROUP_HPP_
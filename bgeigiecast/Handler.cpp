@@ -4,7 +4,11 @@
 
 #include "Handler.hpp"
 
-Handler::Handler(uint8_t handler_id) : Activatable(), handler_id(handler_id) {
+Handler::Handler(uint8_t handler_id, uint8_t execution_group, Priority priority, uint32_t deadline) :
+    Activatable(execution_group),
+    handler_id(handler_id),
+    priority(priority),
+    deadline(deadline) {
 }
 
 void Handler::try_handle_work(HandlerStatus& status, worker_status_t& work_reports) {
@@ -27,3 +31,11 @@ void Handler::try_handle_work(HandlerStatus& status, worker_status_t& work_repor
 uint8_t Handler::get_handler_id() {
   return handler_id;
 }
+
+Handler::Priority Handler::get_priority() const {
+  return priority;
+}
+
+uint32_t Handler::get_deadline() const {
+  return deadline;
+}
@@ -13,11 +13,27 @@
  */
 class Handler : public Activatable {
  public:
+  /**
+   * Dispatch priority, handlers with a higher priority handle the work first. Only low priority handlers can be
+   * deferred to the next cycle.
+   */
+  typedef enum Priority {
+    e_priority_low = 0,
+    e_priority_normal,
+    e_priority_high,
+  } Priority;
+
   /**
    * Construct a handler
    * @param handler_id: unique id of the handler
+   * @param execution_group: group (task) the handler runs in, see `Aggregator::start_execution_group`
+   * @param priority: dispatch priority
+   * @param deadline: soft deadline in millis after the work was produced, 0 for no deadline
    */
-  explicit Handler(uint8_t handler_id);
+  explicit Handler(uint8_t handler_id,
+                   uint8_t execution_group = 0,
+                   Priority priority = e_priority_normal,
+                   uint32_t deadline = 0);
   virtual ~Handler() = default;
 
   /**
@@ -26,6 +42,18 @@ class Handler : public Activatable {
    */
   virtual uint8_t get_handler_id() final;
 
+  /**
+   * Gets the dispatch priority
+   * @return priority
+   */
+  Priority get_priority() const;
+
+  /**
+   * Gets the soft deadline
+   * @return millis after the work was produced, 0 for no deadline
+   */
+  uint32_t get_deadline() const;
+
   /**
    * Call the data handler sequence to report worker_reports
    * @param work_reports: worker reports to handle
@@ -44,6 +72,8 @@ class Handler : public Activatable {
 
  private:
   uint8_t handler_id;
+  Priority priority;
+  uint32_t deadline;
 };
 
 #endif //SENSOR_REPORTER_REPORTER_HPP_
@@ -0,0 +1,77 @@
+#include <Arduino.h>
+
+#include "HandlerScheduler.hpp"
+
+HandlerScheduler::HandlerScheduler() : _entries(), _cycle_budget(0), _deferred_produced_at(0) {
+}
+
+void HandlerScheduler::add(Handler& handler) {
+  // Keep sorted on priority (high first), same priority in order of id
+  auto it = _entries.begin();
+  while(it != _entries.end() && (it->handler->get_priority() > handler.get_priority()
+      || (it->handler->get_priority() == handler.get_priority()
+          && it->handler->get_handler_id() < handler.get_handler_id()))) {
+    ++it;
+  }
+  _entries.insert(it, {&handler, false});
+}
+
+void HandlerScheduler::remove(Handler& handler) {
+  for(auto it = _entries.begin(); it != _entries.end(); ++it) {
+    if(it->handler == &handler) {
+      _entries.erase(it);
+      return;
+    }
+  }
+}
+
+void HandlerScheduler::set_cycle_budget(uint32_t budget) {
+  _cycle_budget = budget;
+}
+
+bool HandlerScheduler::has_deferred() const {
+  for(const auto& entry : _entries) {
+    if(entry.deferred) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void HandlerScheduler::run_deferred(handler_status_t& handler_stats, worker_status_t& worker_reports) {
+  for(auto& entry : _entries) {
+    if(entry.deferred) {
+      entry.deferred = false;
+      run_handler(entry.handler, handler_stats.at(entry.handler->get_handler_id()), worker_reports, _deferred_produced_at);
+    }
+  }
+}
+
+void HandlerScheduler::dispatch(handler_status_t& handler_stats, worker_status_t& worker_reports, uint32_t produced_at) {
+  for(auto& entry : _entries) {
+    auto& status = handler_stats.at(entry.handler->get_handler_id());
+    if(_cycle_budget > 0
+        && entry.handler->get_priority() == Handler::e_priority_low
+        && millis() - produced_at > _cycle_budget) {
+      // Budget used up, handle this work in the next cycle
+      entry.deferred = true;
+      _deferred_produced_at = produced_at;
+      ++status.deferred;
+      continue;
+    }
+    run_handler(entry.handler, status, worker_reports, produced_at);
+  }
+}
+
+void HandlerScheduler::run_handler(Handler* handler,
+                                   HandlerStatus& status,
+                                   worker_status_t& worker_reports,
+                                   uint32_t produced_at) {
+  uint32_t start = millis();
+  handler->try_handle_work(status, worker_reports);
+  uint32_t end = millis();
+  status.last_duration = end - start;
+  if(handler->get_deadline() > 0 && end - produced_at > handler->get_deadline()) {
+    ++status.deadline_misses;
+  }
+}
@@ -0,0 +1,72 @@
+#ifndef SENSOR_REPORTER_HANDLERSCHEDULER_HPP_
+#define SENSOR_REPORTER_HANDLERSCHEDULER_HPP_
+
+#include <vector>
+#include "Handler.hpp"
+
+/**
+ * Dispatches the produced work to handlers in order of priority. Keeps track of the soft deadlines of the handlers
+ * and defers low priority handlers to the next cycle once the time budget of a cycle is used up.
+ */
+class HandlerScheduler {
+ public:
+  HandlerScheduler();
+  virtual ~HandlerScheduler() = default;
+
+  /**
+   * Add a handler to the dispatch order
+   * @param handler
+   */
+  void add(Handler& handler);
+
+  /**
+   * Remove a handler from the dispatch order
+   * @param handler
+   */
+  void remove(Handler& handler);
+
+  /**
+   * Set the time budget for handling the work of a single cycle
+   * @param budget: millis, 0 for no budget
+   */
+  void set_cycle_budget(uint32_t budget);
+
+  /**
+   * Check if handlers were deferred to the next cycle
+   * @return true if there are deferred handlers
+   */
+  bool has_deferred() const;
+
+  /**
+   * Let the handlers that were deferred in the previous cycle handle their work. Call this before the workers
+   * produce new work, so the worker reports are still those of the previous cycle.
+   * @param handler_stats: status of the handlers
+   * @param worker_reports: worker reports of the previous cycle
+   */
+  void run_deferred(handler_status_t& handler_stats, worker_status_t& worker_reports);
+
+  /**
+   * Let the handlers handle the produced work
+   * @param handler_stats: status of the handlers
+   * @param worker_reports: worker reports to handle
+   * @param produced_at: millis when the work was produced, deadlines are relative to this
+   */
+  void dispatch(handler_status_t& handler_stats, worker_status_t& worker_reports, uint32_t produced_at);
+
+ private:
+  /**
+   * Let a single handler handle the work and check its deadline
+   */
+  void run_handler(Handler* handler, HandlerStatus& status, worker_status_t& worker_reports, uint32_t produced_at);
+
+  struct Entry {
+    Handler* handler;
+    bool deferred;
+  };
+
+  std::vector<Entry> _entries;
+  uint32_t _cycle_budget;
+  uint32_t _deferred_produced_at;
+};
+
+#endif //SENSOR_REPORTER_HANDLERSCHEDULER_HPP_
@@ -0,0 +1,119 @@
+#ifndef SENSOR_REPORTER_LOCKFREEQUEUE_HPP_
+#define SENSOR_REPORTER_LOCKFREEQUEUE_HPP_
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Lock-free queue for exactly one producer and one consumer (for example two tasks on different cores).
+ * Items are written and read in place: the producer fills a slot from `acquire()` and publishes it with `commit()`,
+ * the consumer uses the slot from `peek()` and hands it back with `release()`.
+ * @tparam T: Type of the items
+ * @tparam max: max items in the queue
+ */
+template<typename T, uint16_t max>
+class LockFreeQueue {
+ public:
+  LockFreeQueue() : buffer(), head(0), tail(0), dropped(0) {};
+  virtual ~LockFreeQueue() = default;
+
+  /**
+   * Producer: get the next free slot. If the queue is full the drop counter is increased.
+   * @return: slot to fill, nullptr if the queue is full
+   */
+  T* acquire() {
+    auto t = tail.load(std::memory_order_relaxed);
+    if(t - head.load(std::memory_order_acquire) >= max) {
+      ++dropped;
+      return nullptr;
+    }
+    return &buffer[t % max];
+  }
+
+  /**
+   * Producer: publish the slot returned by the last `acquire()`
+   */
+  void commit() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * Producer: copy a value in the queue
+   * @param val
+   * @return: false if the queue is full
+   */
+  bool push(const T& val) {
+    T* slot = acquire();
+    if(!slot) {
+      return false;
+    }
+    *slot = val;
+    commit();
+    return true;
+  }
+
+  /**
+   * Consumer: get the oldest item without removing it
+   * @return: oldest item, nullptr if the queue is empty
+   */
+  T* peek() {
+    auto h = head.load(std::memory_order_relaxed);
+    if(h == tail.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &buffer[h % max];
+  }
+
+  /**
+   * Consumer: remove the item returned by the last `peek()`
+   */
+  void release() {
+    head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  /**
+   * Consumer: copy the oldest item out of the queue
+   * @param out
+   * @return: false if the queue is empty
+   */
+  bool pop(T& out) {
+    T* slot = peek();
+    if(!slot) {
+      return false;
+    }
+    out = *slot;
+    release();
+    return true;
+  }
+
+  /**
+   * Check if the queue is empty
+   * @return: true if empty
+   */
+  bool empty() const {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Get a slot by index, only to prepare slots before the queue is shared
+   * @param index: 0 to max - 1
+   */
+  T& slot(uint16_t index) {
+    return buffer[index % max];
+  }
+
+  /**
+   * Get the amount of items that could not be added because the queue was full (producer side)
+   */
+  uint32_t get_dropped() const {
+    return dropped;
+  }
+
+ private:
+  T buffer[max];
+  std::atomic<uint32_t> head;
+  std::atomic<uint32_t> tail;
+  uint32_t dropped;
+};
+
+#endif //SENSOR_REPORTER_LOCKFREEQUEUE_HPP_
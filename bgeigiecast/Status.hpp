@@ -62,6 +62,10 @@ struct HandlerStatus : public _Status {
   } Status;
 
   int8_t status = 0; // Custom error codes can be used
+
+  uint32_t deadline_misses = 0; // Times the handler finished after its soft deadline
+  uint32_t deferred = 0; // Times the handler was moved to the next cycle because the cycle budget was used up
+  uint32_t last_duration = 0; // Millis the last handling took
 };
 
 typedef std::map<uint8_t, HandlerStatus> handler_status_t;
@@ -14,8 +14,8 @@
  */
 class BaseWorker : public Activatable {
  public:
-  explicit BaseWorker(uint8_t worker_id) :
-      Activatable(),
+  explicit BaseWorker(uint8_t worker_id, uint8_t execution_group = 0) :
+      Activatable(execution_group),
       worker_id(worker_id) {};
   virtual ~BaseWorker() = default;
 
@@ -33,6 +33,24 @@ class BaseWorker : public Activatable {
    */
   virtual bool work(WorkerStatus& status) = 0;
 
+  /**
+   * Get the time until the worker is due to produce data again, execution groups sleep until then
+   * @return millis, 0 if it is due
+   */
+  virtual uint32_t get_wait_time() const = 0;
+
+  /**
+   * Create a copy of the produced data, used by execution groups to get their own copy of the data
+   * @return new copy, owned by the caller
+   */
+  virtual void* create_data_copy() const = 0;
+
+  /**
+   * Copy the produced data into a copy made by `create_data_copy`
+   * @param destination
+   */
+  virtual void copy_data(void* destination) const = 0;
+
  private:
   uint8_t worker_id;
 };
@@ -51,9 +69,10 @@ class Worker : public BaseWorker {
    * @param worker_id : unique id of the worker
    * @param initial_val : initial value of the data it produces
    * @param break_duration : time in millis how long the delay should be between produced work.
+   * @param execution_group : group (task) the worker runs in, see `Aggregator::start_execution_group`
    */
-  Worker(uint8_t worker_id, T initial_val, uint32_t break_duration = 1000)
-      : BaseWorker(worker_id),
+  Worker(uint8_t worker_id, T initial_val, uint32_t break_duration = 1000, uint8_t execution_group = 0)
+      : BaseWorker(worker_id, execution_group),
         data(initial_val),
         break_duration(break_duration),
         last_break(0) {
@@ -96,6 +115,14 @@ class Worker : public BaseWorker {
     return false;
   }
 
+  uint32_t get_wait_time() const final {
+    uint32_t since_break = millis() - last_break;
+    if(last_break == 0 || since_break > break_duration) {
+      return 0;
+    }
+    return break_duration - since_break + 1;
+  }
+
   /**
    * Get the current data from the worker
    * @return current data
@@ -104,6 +131,14 @@ class Worker : public BaseWorker {
     return data;
   }
 
+  void* create_data_copy() const final {
+    return new T(data);
+  }
+
+  void copy_data(void* destination) const final {
+    *static_cast<T*>(destination) = data;
+  }
+
  protected:
   T data;
 
@@ -5,7 +5,7 @@
 #include "debugger.h"
 
 AccessPoint::AccessPoint(LocalStorage& config) :
-    Worker<bool>(k_worker_wifi_access_point, false),
+    Worker<bool>(k_worker_wifi_access_point, false, 1000, k_group_network),
     _config(config){
 
 }
@@ -24,7 +24,12 @@ bool AccessPoint::activate(bool) {
   char host_ssid[16];
   sprintf(host_ssid, ACCESS_POINT_SSID, device_id);
 
-  return WiFiConnection::start_ap_server(host_ssid, _config.get_ap_password());
+  char password[CONFIG_VAL_MAX];
+  {
+    std::lock_guard<LocalStorage> guard(_config);
+    strcpy(password, _config.get_ap_password());
+  }
+  return WiFiConnection::start_ap_server(host_ssid, password);
 }
 
 void AccessPoint::deactivate() {
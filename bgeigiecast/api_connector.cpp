@@ -10,7 +10,7 @@
 #define RETRY_TIMEOUT 10000
 
 ApiReporter::ApiReporter(LocalStorage& config) :
-    Handler(k_handler_api_reporter),
+    Handler(k_handler_api_reporter, k_group_network, e_priority_high, API_HANDLE_DEADLINE_MILLIS),
     _config(config),
     _saved_readings(),
     _last_send(),
@@ -19,6 +19,10 @@ ApiReporter::ApiReporter(LocalStorage& config) :
     _alert() {
 }
 
+uint16_t ApiReporter::get_backlog() const {
+  return _saved_readings.get_count();
+}
+
 bool ApiReporter::time_to_send() const {
   return millis() - _last_send > API_SEND_FREQUENCY(_alert, _config.get_use_dev());
 }
@@ -42,14 +46,18 @@ bool ApiReporter::activate(bool retry) {
   }
   if (!retry) {
     reset_reading();
-  } else if(millis() - last_try < RETRY_TIMEOUT) {
+  } else if(WiFiConnection::wifi_connecting() || millis() - last_try < RETRY_TIMEOUT) {
+    // Connect in progress, or failed and waiting before trying again
     return false;
   }
   last_try = millis();
 
-  WiFiConnection::connect_wifi(_config.get_wifi_ssid(), _config.get_wifi_password());
-
-  return WiFi.isConnected();
+  WiFiProfile profiles[WIFI_PROFILE_COUNT];
+  {
+    std::lock_guard<LocalStorage> guard(_config);
+    memcpy(profiles, _config.get_wifi_profiles(), sizeof(profiles));
+  }
+  return WiFiConnection::connect_wifi(profiles, WIFI_PROFILE_COUNT);
 }
 
 void ApiReporter::deactivate() {
@@ -104,11 +112,14 @@ ApiReporter::ApiHandlerStatus ApiReporter::send_reading(const Reading& reading)
   HTTPClient http;
 
   char url[100];
-  sprintf(url,
-          "%s?api_key=%s&%s",
-          API_MEASUREMENTS_ENDPOINT,
-          _config.get_api_key(),
-          _config.get_use_dev() ? "test=true" : "");
+  {
+    std::lock_guard<LocalStorage> guard(_config);
+    sprintf(url,
+            "%s?api_key=%s&%s",
+            API_MEASUREMENTS_ENDPOINT,
+            _config.get_api_key(),
+            _config.get_use_dev() ? "test=true" : "");
+  }
 
   //Specify destination for HTTP request
   if(!http.begin(url)) {
@@ -30,6 +30,12 @@ class ApiReporter : public Handler {
   explicit ApiReporter(LocalStorage& config);
   virtual ~ApiReporter() = default;
 
+  /**
+   * Get the amount of readings waiting to be sent, only exact when called from the network task
+   * @return
+   */
+  uint16_t get_backlog() const;
+
  protected:
 
   /**
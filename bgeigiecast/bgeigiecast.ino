@@ -47,28 +47,31 @@ Contact: Jelle Bouwhuis (email jellebouwhuis@outlook.com) and Rob Oudendijk (rob
 #include "controller.h"
 #include "bgeigie_connector.h"
 #include "configuration_server.h"
+#include "ota_puller.h"
 #include "mode_led.h"
+#include "identifiers.h"
 
 HardwareSerial& bGeigieSerialConnection = Serial2;
 
 LocalStorage config;
+ReadingLog reading_log;
 Controller controller(config);
 
-// Workers
-BGeigieConnector bgeigie_connector(bGeigieSerialConnection);
-ConfigWebServer config_server(config);
-
 // Data handlers
-BluetoothReporter bluetooth_reporter(config);
+BluetoothReporter bluetooth_reporter(config, reading_log);
 ApiReporter api_reporter(config);
+OtaPuller ota_puller(config);
 AccessPoint access_point(config);
 
+// Workers
+BGeigieConnector bgeigie_connector(bGeigieSerialConnection);
+ConfigWebServer config_server(config, &controller.get_trace(), &api_reporter);
+
 // Report handlers
 ModeLED mode_led(config);
 
 #if DEBUG_FULL_REPORT
 #if ENABLE_DEBUG
-#include "identifiers.h"
 
 /**
  * Prints full details of the workers and handlers
@@ -87,11 +90,11 @@ class FullReporter : public Supervisor {
         "- controller_handler\n"
         "  - state: %d, status: %d\n"
         "- storage_handler\n"
-        "  - state: %d, status: %d\n"
+        "  - state: %d, status: %d, deferred: %d\n"
         "- bluetooth_reporter\n"
         "  - state: %d, status: %d\n"
         "- api_reporter\n"
-        "  - state: %d, status: %d\n",
+        "  - state: %d, status: %d, deadline misses: %d\n",
         worker_stats.at(k_worker_bgeigie_connector).active_state,
         worker_stats.at(k_worker_bgeigie_connector).status,
         worker_stats.at(k_worker_configuration_server).active_state,
@@ -100,10 +103,12 @@ class FullReporter : public Supervisor {
         handler_stats.at(k_handler_controller_handler).status,
         handler_stats.at(k_handler_storage_handler).active_state,
         handler_stats.at(k_handler_storage_handler).status,
+        handler_stats.at(k_handler_storage_handler).deferred,
         handler_stats.at(k_handler_bluetooth_reporter).active_state,
         handler_stats.at(k_handler_bluetooth_reporter).status,
         handler_stats.at(k_handler_api_reporter).active_state,
-        handler_stats.at(k_handler_api_reporter).status
+        handler_stats.at(k_handler_api_reporter).status,
+        handler_stats.at(k_handler_api_reporter).deadline_misses
     );
   }
 };
@@ -130,28 +135,120 @@ void setup() {
   gpio_config(&io_conf);
   gpio_install_isr_service(ESP_INTR_FLAG_LEVEL1);
 
+  reading_log.begin();
+
   /// Software configurations
   // Setup aggregator
   controller.register_worker(access_point, false);
   controller.register_worker(bgeigie_connector, false);
   controller.register_worker(config_server, false);
+  controller.register_worker(bluetooth_reporter, false);
 
   controller.register_handler(bluetooth_reporter, false);
   controller.register_handler(api_reporter, false);
+  controller.register_handler(ota_puller, false);
   controller.register_handler(config, false);
 
   controller.register_supervisor(mode_led);
+  controller.register_supervisor(config_server);
 #if DEBUG_FULL_REPORT
 #if ENABLE_DEBUG
   controller.register_supervisor(full_reporter);
 #endif
 #endif
+
+  controller.set_cycle_budget(HANDLER_CYCLE_BUDGET_MILLIS);
+
+  // Network workers and handlers run on the other core, so they don't delay the sensor path
+  controller.start_execution_group(k_group_network, NETWORK_TASK_CORE, NETWORK_TASK_STACK_SIZE, NETWORK_TASK_PRIORITY);
+
   controller.setup_state_machine();
 }
 
+#if ENABLE_DEBUG
+/**
+ * Serial debug commands:
+ * - t: dump the state machine trace as hex (decode with tools/decode_trace.py)
+ * - d: print the dwell times per state and the event latency
+ * - s: print the storage write metrics
+ * - h: print the web server response times
+ * - b: print the bluetooth notification and log transfer metrics
+ * - p: print the mode button interrupt and latency metrics
+ * - w: print the WiFi scan and connect timings
+ */
+void handle_serial_command() {
+  if(!DEBUG_STREAM.available()) {
+    return;
+  }
+  switch(DEBUG_STREAM.read()) {
+    case 't': {
+      static uint8_t buffer[StateTrace::k_serialized_size];
+      auto size = controller.get_trace().serialize(buffer, sizeof(buffer));
+      DEBUG_PRINT("TRACE:");
+      for(size_t i = 0; i < size; ++i) {
+        DEBUG_PRINTF("%02x", buffer[i]);
+      }
+      DEBUG_PRINTLN("");
+      break;
+    }
+    case 'd':
+      controller.get_trace().print_dwell_stats(DEBUG_STREAM);
+      DEBUG_PRINTF("Event latency: %u us (max %u us), dropped events: %u\n",
+                   controller.get_last_event_latency(), controller.get_max_event_latency(),
+                   controller.get_dropped_events());
+      break;
+    case 's':
+      config.print_metrics(DEBUG_STREAM);
+      break;
+    case 'b': {
+      bluetooth_reporter.print_metrics(DEBUG_STREAM);
+      // Button -> MobileMode -> bluetooth reporter activated on the network task -> advertising
+      uint32_t pressed = controller.get_last_button_press();
+      uint32_t advertising = bluetooth_reporter.get_metrics().advertising_since.load();
+      if(pressed && advertising >= pressed) {
+        DEBUG_PRINTF("Button to advertising: %u ms\n", advertising - pressed);
+      }
+      break;
+    }
+    case 'p': {
+      const auto& metrics = controller.get_button_metrics();
+      DEBUG_PRINTF("Button interrupts: %u, ISR: %u us (max %u us), edge to handled: %u us (max %u us)\n",
+                   metrics.interrupts.load(), metrics.last_isr.load(), metrics.max_isr.load(),
+                   metrics.last_latency.load(), metrics.max_latency.load());
+      break;
+    }
+    case 'w': {
+      const auto& metrics = WiFiConnection::get_metrics();
+      DEBUG_PRINTF("WiFi connects: %u (fast %u, fast failed %u), disconnects: %u (last reason %u)\n",
+                   metrics.connects.load(), metrics.fast_connects.load(), metrics.fast_failed.load(),
+                   metrics.disconnects.load(), metrics.last_reason.load());
+      DEBUG_PRINTF("Last connect: network %u, %u ms (%s%s), association: %u ms, ip: %u ms\n",
+                   metrics.last_profile.load(), metrics.last_connect.load(), metrics.last_fast ? "fast" : "full",
+                   metrics.last_lease_reused ? ", cached lease" : "", metrics.last_association.load(),
+                   metrics.last_dhcp.load());
+      DEBUG_PRINTF("Scans: %u, last scan: %u ms (%u stored networks found), failovers: %u\n",
+                   metrics.scans.load(), metrics.last_scan.load(), metrics.last_candidates.load(),
+                   metrics.failovers.load());
+      break;
+    }
+    case 'h': {
+      const auto& metrics = config_server.get_response_metrics();
+      DEBUG_PRINTF("Pages: %u, TTFB: %u us (max %u us), last duration: %u us, not modified: %u\n",
+                   metrics.responses.load(), metrics.last_ttfb.load(), metrics.max_ttfb.load(),
+                   metrics.last_duration.load(), metrics.not_modified.load());
+      break;
+    }
+    default:
+      break;
+  }
+}
+#endif
+
 void loop() {
   controller.run();
-  mode_led.loop();
+#if ENABLE_DEBUG
+  handle_serial_command();
+#endif
 }
 
 #endif
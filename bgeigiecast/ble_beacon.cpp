@@ -0,0 +1,66 @@
+#include <math.h>
+
+#include "ble_beacon.h"
+
+#define BLE_BEACON_COORDINATE_MAX 0x7FFFFF
+
+namespace {
+
+void write_u16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFFu;
+  out[1] = value >> 8u;
+}
+
+uint16_t read_u16(const uint8_t* data) {
+  return data[0] | (data[1] << 8u);
+}
+
+void write_coordinate(uint8_t* out, double degrees) {
+  double scaled = degrees * BLE_BEACON_POSITION_SCALE;
+  // Clamp before rounding, long is 32 bit on the ESP32
+  if(scaled > BLE_BEACON_COORDINATE_MAX) {
+    scaled = BLE_BEACON_COORDINATE_MAX;
+  } else if(scaled < -BLE_BEACON_COORDINATE_MAX) {
+    scaled = -BLE_BEACON_COORDINATE_MAX;
+  }
+  auto raw = static_cast<uint32_t>(lround(scaled));
+  out[0] = raw & 0xFFu;
+  out[1] = (raw >> 8u) & 0xFFu;
+  out[2] = (raw >> 16u) & 0xFFu;
+}
+
+double read_coordinate(const uint8_t* data) {
+  int32_t value = data[0] | (data[1] << 8u) | (data[2] << 16u);
+  if(value & 0x800000) {
+    // Sign extend
+    value -= 0x1000000;
+  }
+  return static_cast<double>(value) / BLE_BEACON_POSITION_SCALE;
+}
+
+}
+
+size_t BleBeacon::encode(uint8_t* out) const {
+  write_u16(out, BLE_BEACON_COMPANY_ID);
+  out[2] = BLE_BEACON_VERSION;
+  write_u16(out + 3, device_id);
+  write_u16(out + 5, cpm);
+  out[7] = status;
+  write_coordinate(out + 8, latitude);
+  write_coordinate(out + 11, longitude);
+  out[14] = sequence;
+  return BLE_BEACON_SIZE;
+}
+
+bool BleBeacon::decode(const uint8_t* data, size_t size, BleBeacon& out) {
+  if(size < BLE_BEACON_SIZE || read_u16(data) != BLE_BEACON_COMPANY_ID || data[2] != BLE_BEACON_VERSION) {
+    return false;
+  }
+  out.device_id = read_u16(data + 3);
+  out.cpm = read_u16(data + 5);
+  out.status = data[7];
+  out.latitude = read_coordinate(data + 8);
+  out.longitude = read_coordinate(data + 11);
+  out.sequence = data[14];
+  return true;
+}
@@ -0,0 +1,47 @@
+#ifndef BGEIGIECAST_BLE_BEACON_H
+#define BGEIGIECAST_BLE_BEACON_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define BLE_BEACON_COMPANY_ID 0xFFFF // Reserved for testing / internal use, no Bluetooth SIG company id assigned
+#define BLE_BEACON_VERSION 1
+#define BLE_BEACON_SIZE 15
+#define BLE_BEACON_POSITION_SCALE 1000 // Coarse position, 1/1000 degree (~110 m)
+
+/**
+ * Latest reading of a device as broadcast in the manufacturer specific advertising data, so scanners can collect
+ * readings without connecting.
+ *
+ * Layout, all values little endian:
+ * - company id (2 bytes)
+ * - version (1 byte)
+ * - device id (2 bytes)
+ * - cpm (2 bytes)
+ * - status (1 byte, `k_reading_*` flags of the reading)
+ * - latitude, longitude (3 bytes each, signed, 1/1000 degree)
+ * - sequence (1 byte, incremented with every reading)
+ */
+struct BleBeacon {
+  uint16_t device_id;
+  uint16_t cpm;
+  uint8_t status;
+  double latitude;
+  double longitude;
+  uint8_t sequence;
+
+  /**
+   * Encode as manufacturer data
+   * @param out: at least BLE_BEACON_SIZE bytes
+   * @return encoded size
+   */
+  size_t encode(uint8_t* out) const;
+
+  /**
+   * Decode manufacturer data of an advertisement
+   * @return false if it is not a beacon of this version
+   */
+  static bool decode(const uint8_t* data, size_t size, BleBeacon& out);
+};
+
+#endif //BGEIGIECAST_BLE_BEACON_H
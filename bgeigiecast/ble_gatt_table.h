@@ -0,0 +1,116 @@
+#ifndef BGEIGIECAST_BLE_GATT_TABLE_H
+#define BGEIGIECAST_BLE_GATT_TABLE_H
+
+#include <BLEDevice.h>
+
+#include "bluetooth_settings.h"
+
+#define GATT_READ BLECharacteristic::PROPERTY_READ
+#define GATT_WRITE BLECharacteristic::PROPERTY_WRITE
+#define GATT_WRITE_NR BLECharacteristic::PROPERTY_WRITE_NR
+#define GATT_NOTIFY BLECharacteristic::PROPERTY_NOTIFY
+
+/**
+ * Characteristics the reporter uses after the services are registered
+ */
+typedef enum GattRole {
+  e_gatt_static = 0, // Only the initial value
+  e_gatt_readings, // Readings are notified
+  e_gatt_log_control, // Log transfer commands are written by the client
+  e_gatt_log_data, // Log transfer packets are notified
+  e_gatt_role_count,
+} GattRole;
+
+/**
+ * Declarative description of a characteristic
+ */
+struct GattCharacteristic {
+  const char* uuid;
+  uint32_t properties;
+  const char* description; // user description (0x2901), nullptr for none
+  const char* value; // initial value, nullptr for none
+  uint8_t value_size; // 0 if the value is a string
+  GattRole role;
+};
+
+struct GattService {
+  const char* uuid;
+  const GattCharacteristic* characteristics;
+  uint8_t characteristic_count;
+};
+
+constexpr GattCharacteristic k_gatt_profile_characteristics[] = {
+    {CHARACTERISTIC_PROFILE_NAME_UUID, GATT_READ, nullptr, BLE_PROFILE_NAME, 0, e_gatt_static},
+    {CHARACTERISTIC_PROFILE_APPEARANCE_UUID, GATT_READ, nullptr, nullptr, 0, e_gatt_static},
+};
+
+constexpr GattCharacteristic k_gatt_device_characteristics[] = {
+    {CHARACTERISTIC_DEVICE_MANUFACTURER_UUID, GATT_READ, "Manufacturer Name String", BLE_DEVICE_INFO_MANUFACTURER, 0,
+     e_gatt_static},
+    {CHARACTERISTIC_DEVICE_MODEL_UUID, GATT_READ, "Model Number String", BLE_DEVICE_INFO_MODEL, 0, e_gatt_static},
+    {CHARACTERISTIC_DEVICE_FIRMWARE_UUID, GATT_READ, "Firmware Revision String", BLE_DEVICE_INFO_FIRMWARE_REVISION, 0,
+     e_gatt_static},
+    {CHARACTERISTIC_DEVICE_REVISION_UUID, GATT_READ, "Hardware Revision String", BLE_DEVICE_INFO_HARDWARE_REVISION, 0,
+     e_gatt_static},
+};
+
+constexpr GattCharacteristic k_gatt_data_characteristics[] = {
+    {CHARACTERISTIC_DATA_BDADDR_UUID, GATT_READ, "DB-Addr", BLE_DATA_ADDR, BLE_DATA_ADDR_SIZE, e_gatt_static},
+    {CHARACTERISTIC_DATA_BAUD_UUID, GATT_READ | GATT_WRITE, "Baudrate", nullptr, 0, e_gatt_static},
+    {CHARACTERISTIC_DATA_RX_UUID, GATT_READ | GATT_NOTIFY, "RX", nullptr, 0, e_gatt_readings},
+    {CHARACTERISTIC_DATA_TX_UUID, GATT_READ | GATT_WRITE | GATT_WRITE_NR, "TX", nullptr, 0, e_gatt_static},
+    {CHARACTERISTIC_LOG_CONTROL_UUID, GATT_WRITE | GATT_WRITE_NR, "Log control", nullptr, 0, e_gatt_log_control},
+    {CHARACTERISTIC_LOG_DATA_UUID, GATT_NOTIFY, "Log data", nullptr, 0, e_gatt_log_data},
+};
+
+#define GATT_SERVICE(uuid, characteristics) \
+  {uuid, characteristics, sizeof(characteristics) / sizeof(GattCharacteristic)}
+
+constexpr GattService k_gatt_services[] = {
+    GATT_SERVICE(SERVICE_PROFILE_UUID, k_gatt_profile_characteristics),
+    GATT_SERVICE(SERVICE_DEVICE_UUID, k_gatt_device_characteristics),
+    GATT_SERVICE(SERVICE_DATA_UUID, k_gatt_data_characteristics),
+};
+
+constexpr uint8_t k_gatt_service_count = sizeof(k_gatt_services) / sizeof(GattService);
+
+/**
+ * Attribute handles of a characteristic: declaration, value and its descriptors
+ */
+constexpr uint16_t gatt_handles(const GattCharacteristic& characteristic) {
+  return 2 + (characteristic.description ? 1 : 0) + (characteristic.properties & GATT_NOTIFY ? 1 : 0);
+}
+
+/**
+ * Attribute handles of a service, so no more handles are reserved than needed
+ */
+constexpr uint16_t gatt_handles(const GattService& service, uint8_t index = 0) {
+  return index == service.characteristic_count
+         ? 1 : gatt_handles(service.characteristics[index]) + gatt_handles(service, index + 1);
+}
+
+constexpr uint8_t gatt_description_count(const GattService& service, uint8_t index = 0) {
+  return index == service.characteristic_count
+         ? 0 : (service.characteristics[index].description ? 1 : 0) + gatt_description_count(service, index + 1);
+}
+
+constexpr uint8_t gatt_description_count(uint8_t service = 0) {
+  return service == k_gatt_service_count
+         ? 0 : gatt_description_count(k_gatt_services[service]) + gatt_description_count(service + 1);
+}
+
+constexpr uint8_t gatt_role_count(GattRole role, const GattService& service, uint8_t index = 0) {
+  return index == service.characteristic_count
+         ? 0 : (service.characteristics[index].role == role ? 1 : 0) + gatt_role_count(role, service, index + 1);
+}
+
+constexpr uint8_t gatt_role_count(GattRole role, uint8_t service = 0) {
+  return service == k_gatt_service_count
+         ? 0 : gatt_role_count(role, k_gatt_services[service]) + gatt_role_count(role, service + 1);
+}
+
+static_assert(gatt_role_count(e_gatt_readings) == 1, "Readings are sent on a single characteristic (RX)");
+static_assert(gatt_role_count(e_gatt_log_control) == 1 && gatt_role_count(e_gatt_log_data) == 1,
+              "Log transfer needs a control and a data characteristic");
+
+#endif //BGEIGIECAST_BLE_GATT_TABLE_H
@@ -1,11 +1,100 @@
 #include <Arduino.h>
 
+#include <new>
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+#include <esp_gap_ble_api.h>
+#endif
+
 #include "bluetooth_reporter.h"
+#include "ble_gatt_table.h"
 #include "debugger.h"
 #include "identifiers.h"
 
-BluetoothReporter::BluetoothReporter(LocalStorage& config)
-    : Handler(k_handler_bluetooth_reporter), config(config), _pServer(nullptr), pDataRXCharacteristic(nullptr) {
+// The advertisement has the flags (1 byte) and the beacon
+static_assert(BLE_AD_HEADER_SIZE + 1 + BLE_AD_HEADER_SIZE + BLE_BEACON_SIZE <= BLE_ADV_MAX_SIZE,
+              "Beacon does not fit the advertisement");
+// The scan response has the data service and the name, longer names are shortened
+#define BLE_SCAN_RESPONSE_NAME_MAX (BLE_ADV_MAX_SIZE - 2 * BLE_AD_HEADER_SIZE - BLE_UUID128_SIZE)
+static_assert(BLE_SCAN_RESPONSE_NAME_MAX >= sizeof("bGeigie") - 1, "Scan response has no room for the name");
+
+// For the GATT server events
+BluetoothReporter* reporter_instance = nullptr;
+
+BluetoothReporter::BluetoothReporter(LocalStorage& config, ReadingLog& log)
+    : Handler(k_handler_bluetooth_reporter, k_group_network, e_priority_high),
+      Worker<bool>(k_worker_bluetooth_transfer, false, 0, k_group_network),
+      config(config),
+      _log(log),
+      _pServer(nullptr),
+      pDataRXCharacteristic(nullptr),
+      pDataRXNotifications(nullptr),
+      pLogDataCharacteristic(nullptr),
+      pLogDataNotifications(nullptr),
+      _metrics(),
+      _notify_failed(false),
+      _advertise(false),
+      _backlog(),
+      _replaying(false),
+      _replay_start(0),
+      _replay_backoff(false),
+      _replay_backoff_start(0),
+      _replay_readings(0),
+      _replay_bytes(0),
+      _replay_offset(0),
+      _beacon(),
+      _transfer(log, [this](const uint8_t* packet, size_t size) {
+        _notify_failed = false;
+        pLogDataCharacteristic->setValue(const_cast<uint8_t*>(packet), size);
+        pLogDataCharacteristic->notify();
+        return !_notify_failed;
+      }),
+      _log_commands(),
+      _peer_address(),
+      _fast_connection(false) {
+}
+
+const BluetoothMetrics& BluetoothReporter::get_metrics() const {
+  return _metrics;
+}
+
+void BluetoothReporter::print_metrics(Print& out) const {
+  uint32_t readings = _metrics.readings.load();
+  out.printf("BLE readings: %u, notifications: %u (%u per reading), payload: %u bytes, send: %u us (max %u us)\n",
+             readings,
+             _metrics.notifications.load(),
+             readings ? _metrics.notifications.load() / readings : 0,
+             _metrics.payload_size.load(),
+             _metrics.last_send.load(),
+             _metrics.max_send.load());
+  uint32_t duration = _metrics.last_replay_duration.load();
+  out.printf("BLE backlog: %u, dropped: %u, replayed: %u, congested: %u, last replay: %u readings in %u ms (%u B/s)\n",
+             _metrics.backlog.load(),
+             _metrics.dropped.load(),
+             _metrics.replayed.load(),
+             _metrics.congested.load(),
+             _metrics.last_replay_readings.load(),
+             duration,
+             duration ? _metrics.last_replay_bytes.load() * 1000 / duration : 0);
+  out.printf("BLE bring up: %u us\n", _metrics.bring_up.load());
+  const auto& transfer = _transfer.get_metrics();
+  out.printf("BLE log: %u - %u, transfers: %u, packets: %u (%u bytes), resent: %u, gaps: %u, timeouts: %u, "
+             "congested: %u, last: %u bytes in %u ms (%u B/s)\n",
+             _log.get_start(),
+             _log.get_end(),
+             transfer.transfers,
+             transfer.packets,
+             transfer.bytes,
+             transfer.resent,
+             transfer.gaps,
+             transfer.timeouts,
+             transfer.congested,
+             transfer.last_bytes,
+             transfer.last_duration,
+             transfer.last_duration ? transfer.last_bytes * 1000 / transfer.last_duration : 0);
+}
+
+const LogTransferMetrics& BluetoothReporter::get_transfer_metrics() const {
+  return _transfer.get_metrics();
 }
 
 bool BluetoothReporter::activate(bool) {
@@ -13,39 +102,64 @@ bool BluetoothReporter::activate(bool) {
     DEBUG_PRINTLN("Cannot initialize bluetooth without device id");
     return false;
   }
+  if(_advertise) {
+    // Activated as handler and as worker
+    return true;
+  }
+  _advertise = true;
   if(BLEDevice::getInitialized()) {
     // Already initialized
     _pServer->getAdvertising()->start();
+    _metrics.advertising_since = millis();
     return true;
   }
+  uint32_t start = micros();
 
   char deviceName[16];
   sprintf(deviceName, "bGeigie%d", config.get_device_id());
   BLEDevice::init(deviceName);
+  // The client starts the MTU exchange, this is the largest MTU accepted
+  BLEDevice::setMTU(BLE_LOCAL_MTU);
 
   if(!_pServer) {
     _pServer = BLEDevice::createServer();
+    _pServer->setCallbacks(this);
+    reporter_instance = this;
+    BLEDevice::setCustomGattsHandler(on_gatts_event);
 
-    create_ble_profile_service(_pServer);
-    create_ble_device_service(_pServer);
-    create_ble_data_service(_pServer);
+    create_gatt_services(_pServer);
   }
 
+  // Advertising carries the beacon, the name and data service go in the scan response (31 bytes each). A five digit
+  // device id does not fit the complete name, the beacon in the advertisement has the id.
   BLEAdvertising* pAdvertising = BLEDevice::getAdvertising();
-  pAdvertising->addServiceUUID(SERVICE_PROFILE_UUID);
-  pAdvertising->addServiceUUID(SERVICE_DEVICE_UUID);
-  pAdvertising->addServiceUUID(SERVICE_DATA_UUID);
+  BLEAdvertisementData scan_response;
+  if(strlen(deviceName) > BLE_SCAN_RESPONSE_NAME_MAX) {
+    scan_response.setShortName(std::string(deviceName, BLE_SCAN_RESPONSE_NAME_MAX));
+  } else {
+    scan_response.setName(deviceName);
+  }
+  scan_response.setCompleteServices(BLEUUID(SERVICE_DATA_UUID));
+  pAdvertising->setScanResponseData(scan_response);
   pAdvertising->setScanResponse(true);
+  _beacon.device_id = config.get_device_id();
+  update_beacon();
   pAdvertising->setMinPreferred(0x06);
   pAdvertising->setMinPreferred(0x12);
 
   BLEDevice::startAdvertising();
+  _metrics.bring_up = micros() - start;
+  _metrics.advertising_since = millis();
 
-  DEBUG_PRINTF("Bluetooth initialized, device: %s", deviceName);
+  DEBUG_PRINTF("Bluetooth initialized, device: %s in %u us\n", deviceName, _metrics.bring_up.load());
   return BLEDevice::getInitialized();
 }
 
 void BluetoothReporter::deactivate() {
+  if(!_advertise) {
+    return;
+  }
+  _advertise = false;
   for(auto& peerDevice : BLEDevice::getPeerDevices(true)) {
     _pServer->disconnect(peerDevice.first);
   }
@@ -55,143 +169,286 @@ void BluetoothReporter::deactivate() {
 
 int8_t BluetoothReporter::handle_produced_work(const worker_status_t& worker_reports) {
   const auto& reading_stat = worker_reports.at(k_worker_bgeigie_connector);
-  if(!reading_stat.is_fresh()) {
-    return _pServer->getConnectedCount() > 0 ? e_handler_clients_available : Status::e_handler_idle;
-  }
-  // Fresh reading is produced
-  const auto& reading = reading_stat.get<Reading>();
-  return send_reading(reading) ? Status::e_handler_clients_available : Status::e_handler_no_clients;
-}
-
-void BluetoothReporter::create_ble_profile_service(BLEServer* pServer) {
-  BLEService* pProfileService = pServer->createService(SERVICE_PROFILE_UUID);
-  BLECharacteristic* pProfileNameCharacteristic = pProfileService->createCharacteristic(
-      CHARACTERISTIC_PROFILE_NAME_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-  /*BLECharacteristic* pProfileAppearanceCharacteristic = */pProfileService->createCharacteristic(
-      CHARACTERISTIC_PROFILE_APPEARANCE_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-
-  pProfileNameCharacteristic->setValue(BLE_PROFILE_NAME);
-
-  pProfileService->start();
-}
-
-void BluetoothReporter::create_ble_device_service(BLEServer* pServer) {
-  BLEService* pDeviceService = pServer->createService(SERVICE_DEVICE_UUID);
-
-  // Manufacturer name
-  BLECharacteristic* pDeviceManufacturerCharacteristic = pDeviceService->createCharacteristic(
-      CHARACTERISTIC_DEVICE_MANUFACTURER_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-  static BLEDescriptor* pDescriptorManufacturer = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorManufacturer->setValue("Manufacturer Name String");
-  pDeviceManufacturerCharacteristic->addDescriptor(pDescriptorManufacturer);
-
-  // Model number
-  BLECharacteristic* pDeviceModelCharacteristic = pDeviceService->createCharacteristic(
-      CHARACTERISTIC_DEVICE_MODEL_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-  static BLEDescriptor* pDescriptorModel = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorModel->setValue("Model Number String");
-  pDeviceModelCharacteristic->addDescriptor(pDescriptorModel);
-
-  // Firmware revision
-  BLECharacteristic* pDeviceFirmwareCharacteristic = pDeviceService->createCharacteristic(
-      CHARACTERISTIC_DEVICE_FIRMWARE_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-  static BLEDescriptor* pDescriptorFirmware = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorFirmware->setValue("Firmware Revision String");
-  pDeviceFirmwareCharacteristic->addDescriptor(pDescriptorFirmware);
-
-  // Hardware revision
-  BLECharacteristic* pDeviceRevisionCharacteristic = pDeviceService->createCharacteristic(
-      CHARACTERISTIC_DEVICE_REVISION_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-  static BLEDescriptor* pDescriptorHardware = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorHardware->setValue("Hardware Revision String");
-  pDeviceRevisionCharacteristic->addDescriptor(pDescriptorHardware);
-
-  pDeviceManufacturerCharacteristic->setValue(BLE_DEVICE_INFO_MANUFACTURER);
-  pDeviceModelCharacteristic->setValue(BLE_DEVICE_INFO_MODEL);
-  pDeviceFirmwareCharacteristic->setValue(BLE_DEVICE_INFO_FIRMWARE_REVISION);
-  pDeviceRevisionCharacteristic->setValue(BLE_DEVICE_INFO_HARDWARE_REVISION);
-
-  pDeviceService->start();
-}
-
-void BluetoothReporter::create_ble_data_service(BLEServer* pServer) {
-  BLEService* pDataService = pServer->createService(SERVICE_DATA_UUID);
-
-  // DB Addr
-  BLECharacteristic* pDataDBAddrCharacteristic = pDataService->createCharacteristic(
-      CHARACTERISTIC_DATA_BDADDR_UUID,
-      BLECharacteristic::PROPERTY_READ
-  );
-  static BLEDescriptor* pDescriptorAddr = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorAddr->setValue("DB-Addr");
-  pDataDBAddrCharacteristic->addDescriptor(pDescriptorAddr);
-
-  // Baudrate
-  BLECharacteristic* pDataBaudCharacteristic = pDataService->createCharacteristic(
-      CHARACTERISTIC_DATA_BAUD_UUID,
-      BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_WRITE
-  );
-  static BLEDescriptor* pDescriptorBaud = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorBaud->setValue("Baudrate");
-  pDataBaudCharacteristic->addDescriptor(pDescriptorBaud);
-
-  // RX
-  pDataRXCharacteristic = pDataService->createCharacteristic(
-      CHARACTERISTIC_DATA_RX_UUID,
-      BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_NOTIFY
-  );
-  static BLEDescriptor* pDescriptorRX = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorRX->setValue("RX");
-  pDataRXCharacteristic->addDescriptor(pDescriptorRX);
-  static BLEDescriptor* pDescriptorRXNotifications = new BLEDescriptor((uint16_t) 0x2902);
-  pDescriptorRXNotifications->setValue("Notifications and indications disabled");
-  pDataRXCharacteristic->addDescriptor(pDescriptorRXNotifications);
-
-  // TX
-  BLECharacteristic* pDataTXCharacteristic = pDataService->createCharacteristic(
-      CHARACTERISTIC_DATA_TX_UUID,
-      BLECharacteristic::PROPERTY_READ | BLECharacteristic::PROPERTY_WRITE | BLECharacteristic::PROPERTY_WRITE_NR
-  );
-  static BLEDescriptor* pDescriptorTX = new BLEDescriptor((uint16_t) 0x2901);
-  pDescriptorTX->setValue("TX");
-  pDataTXCharacteristic->addDescriptor(pDescriptorTX);
-
-  pDataDBAddrCharacteristic->setValue(addr, BLE_DATA_ADDR_SIZE);
-
-  pDataService->start();
-}
-
-bool BluetoothReporter::send_reading(const Reading& reading) const {
-  if(_pServer->getConnectedCount() == 0) {
-    // No clients to send data to
-    return false;
+  bool subscribed = is_subscribed();
+  if(reading_stat.is_fresh()) {
+    // Fresh reading is produced, live readings wait until the backlog is replayed to keep the order
+    const auto& reading = reading_stat.get<Reading>();
+    _beacon.cpm = reading.get_cpm();
+    _beacon.status = reading.get_status();
+    if(reading.get_status() & k_reading_gps_ok) {
+      _beacon.latitude = reading.get_latitude();
+      _beacon.longitude = reading.get_longitude();
+    }
+    ++_beacon.sequence;
+    update_beacon();
+    _log.append(reading.get_reading_str());
+    size_t sent = 0;
+    if(!subscribed || !_backlog.empty() || !send_reading(reading, sent)) {
+      add_to_backlog(reading);
+      if(_backlog.get_count() == 1) {
+        // The replay continues after the segments the client already got
+        _replay_offset = sent;
+      }
+    }
+  }
+  if(subscribed) {
+    return Status::e_handler_clients_available;
+  }
+  return reading_stat.is_fresh() ? Status::e_handler_no_clients : Status::e_handler_idle;
+}
+
+int8_t BluetoothReporter::produce_data() {
+  transfer_log();
+  if(!is_subscribed()) {
+    // A new client gets the partly sent sentence from the start
+    _replay_offset = 0;
+  } else if(!_backlog.empty()) {
+    replay();
+  }
+  return WorkerStatus::e_worker_idle;
+}
+
+void BluetoothReporter::transfer_log() {
+  LogCommand command{};
+  while(_log_commands.pop(command)) {
+    // Packets fill the MTU the client negotiated with our server
+    _transfer.set_packet_size(get_payload_size());
+    if(!_transfer.handle_command(command.data, command.size, millis())) {
+      DEBUG_PRINTF("Invalid log transfer command %c\n", command.size ? command.data[0] : ' ');
+    }
+  }
+  if(_transfer.is_active() && pLogDataNotifications->getNotifications()) {
+    if(!_fast_connection) {
+      set_fast_connection(true);
+    }
+    _transfer.poll(millis());
+  } else if(_fast_connection) {
+    set_fast_connection(false);
+  }
+}
+
+void BluetoothReporter::set_fast_connection(bool fast) {
+  _fast_connection = fast;
+  if(!_pServer->getConnectedCount()) {
+    return;
+  }
+  if(fast) {
+    _pServer->updateConnParams(
+        _peer_address, BLE_CONN_FAST_MIN_INTERVAL, BLE_CONN_FAST_MAX_INTERVAL, 0, BLE_CONN_TIMEOUT);
+#if CONFIG_BT_BLE_50_FEATURES_SUPPORTED
+    // Only BLE 5 chips (not the original ESP32) have the 2M PHY
+    esp_ble_gap_set_preferred_phy(_peer_address,
+                                  0,
+                                  ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                  ESP_BLE_GAP_PHY_2M_PREF_MASK,
+                                  ESP_BLE_GAP_PHY_OPTIONS_NO_PREF);
+#endif
+  } else {
+    _pServer->updateConnParams(
+        _peer_address, BLE_CONN_SLOW_MIN_INTERVAL, BLE_CONN_SLOW_MAX_INTERVAL, 0, BLE_CONN_TIMEOUT);
+  }
+}
+
+void BluetoothReporter::update_beacon() {
+  uint8_t data[BLE_BEACON_SIZE];
+  auto size = _beacon.encode(data);
+  BLEAdvertisementData advertisement;
+  advertisement.setFlags(ESP_BLE_ADV_FLAG_GEN_DISC | ESP_BLE_ADV_FLAG_BREDR_NOT_SPT);
+  advertisement.setManufacturerData(std::string(reinterpret_cast<const char*>(data), size));
+  // Updates the data of the running advertisement
+  BLEDevice::getAdvertising()->setAdvertisementData(advertisement);
+}
+
+void BluetoothReporter::onConnect(BLEServer*, esp_ble_gatts_cb_param_t* param) {
+  memcpy(_peer_address, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+}
+
+void BluetoothReporter::onDisconnect(BLEServer* pServer) {
+  // The client enables notifications again after reconnecting, until then readings go to the backlog
+  pDataRXNotifications->setNotifications(false);
+  pLogDataNotifications->setNotifications(false);
+  if(_advertise) {
+    pServer->getAdvertising()->start();
+  }
+}
+
+void BluetoothReporter::on_gatts_event(esp_gatts_cb_event_t event, esp_gatt_if_t, esp_ble_gatts_cb_param_t* param) {
+  if(event != ESP_GATTS_DISCONNECT_EVT || !reporter_instance) {
+    return;
   }
+  if(memcmp(param->disconnect.remote_bda, reporter_instance->_peer_address, sizeof(esp_bd_addr_t)) == 0) {
+    // Only the transfer client cancels it, it resumes from its last acknowledged offset after reconnecting
+    reporter_instance->_log_commands.push({1, {'X'}});
+  }
+}
+
+void BluetoothReporter::onWrite(BLECharacteristic* pCharacteristic) {
+  std::string value = pCharacteristic->getValue();
+  LogCommand* command = _log_commands.acquire();
+  if(!command || value.size() > sizeof(command->data)) {
+    return;
+  }
+  command->size = value.size();
+  memcpy(command->data, value.data(), value.size());
+  _log_commands.commit();
+}
+
+void BluetoothReporter::onStatus(BLECharacteristic*, BLECharacteristicCallbacks::Status status, uint32_t) {
+  // ERROR_GATT when the stack has no buffer for the notification (congested), the others when the client is gone
+  if(status != BLECharacteristicCallbacks::Status::SUCCESS_NOTIFY
+      && status != BLECharacteristicCallbacks::Status::SUCCESS_INDICATE) {
+    _notify_failed = true;
+  }
+}
+
+bool BluetoothReporter::is_subscribed() const {
+  return _pServer->getConnectedCount() > 0 && pDataRXNotifications->getNotifications();
+}
+
+void BluetoothReporter::add_to_backlog(const Reading& reading) {
+  Sentence sentence{};
+  strncpy(sentence.data, reading.get_reading_str(), READING_STR_MAX - 1);
+  sentence.length = strlen(sentence.data);
+  if(_backlog.full()) {
+    // Replaces the oldest sentence, the next one starts from the beginning
+    ++_metrics.dropped;
+    _replay_offset = 0;
+  }
+  _backlog.add(sentence);
+  _metrics.backlog = _backlog.get_count();
+}
+
+void BluetoothReporter::replay() {
+  if(_replay_backoff && millis() - _replay_backoff_start < BLE_REPLAY_BACKOFF_MILLIS) {
+    return;
+  }
+  _replay_backoff = false;
+  if(!_replaying) {
+    DEBUG_PRINTF("Replaying %u readings over Bluetooth\n", _backlog.get_count());
+    _replaying = true;
+    _replay_start = millis();
+    _replay_readings = 0;
+    _replay_bytes = 0;
+  }
+
+  for(uint8_t i = 0; i < BLE_REPLAY_BURST && !_backlog.empty(); ++i) {
+    const auto& sentence = _backlog.peek();
+    if(!notify(sentence.data, sentence.length, _replay_offset)) {
+      // Stack is congested, the sentence continues with the refused segment after the back off
+      ++_metrics.congested;
+      _replay_backoff = true;
+      _replay_backoff_start = millis();
+      return;
+    }
+    _replay_bytes += sentence.length;
+    ++_replay_readings;
+    ++_metrics.replayed;
+    _replay_offset = 0;
+    _backlog.get();
+    _metrics.backlog = _backlog.get_count();
+  }
+
+  if(_backlog.empty()) {
+    _replaying = false;
+    _metrics.last_replay_readings = _replay_readings;
+    _metrics.last_replay_bytes = _replay_bytes;
+    _metrics.last_replay_duration = millis() - _replay_start;
+    DEBUG_PRINTF("Replayed %u readings in %u ms\n", _replay_readings, _metrics.last_replay_duration.load());
+  }
+}
+
+void BluetoothReporter::create_gatt_services(BLEServer* pServer) {
+  // Storage for the user descriptions, the stack keeps them as long as the server exists
+  alignas(BLEDescriptor) static uint8_t description_pool[gatt_description_count()][sizeof(BLEDescriptor)];
+  uint8_t description_count = 0;
+
+  for(const auto& service_description : k_gatt_services) {
+    BLEService* pService = pServer->createService(BLEUUID(service_description.uuid), gatt_handles(service_description));
+    for(uint8_t i = 0; i < service_description.characteristic_count; ++i) {
+      const auto& description = service_description.characteristics[i];
+      BLECharacteristic* pCharacteristic = pService->createCharacteristic(description.uuid, description.properties);
+      if(description.description) {
+        // Value buffer of the exact size instead of the default 100 bytes
+        auto pDescriptor = new(description_pool[description_count++]) BLEDescriptor(
+            BLEUUID((uint16_t) 0x2901), strlen(description.description));
+        pDescriptor->setValue(description.description);
+        pCharacteristic->addDescriptor(pDescriptor);
+      }
+      switch(description.role) {
+        case e_gatt_readings:
+          pDataRXNotifications = new BLE2902();
+          pCharacteristic->addDescriptor(pDataRXNotifications);
+          pCharacteristic->setCallbacks(this);
+          pDataRXCharacteristic = pCharacteristic;
+          break;
+        case e_gatt_log_control:
+          pCharacteristic->setCallbacks(this);
+          break;
+        case e_gatt_log_data:
+          pLogDataNotifications = new BLE2902();
+          pCharacteristic->addDescriptor(pLogDataNotifications);
+          pCharacteristic->setCallbacks(this);
+          pLogDataCharacteristic = pCharacteristic;
+          break;
+        default:
+          break;
+      }
+      if(description.value) {
+        pCharacteristic->setValue(
+            reinterpret_cast<uint8_t*>(const_cast<char*>(description.value)),
+            description.value_size ? description.value_size : strlen(description.value));
+      }
+    }
+    pService->start();
+  }
+}
+
+bool BluetoothReporter::send_reading(const Reading& reading, size_t& sent) {
   DEBUG_PRINTLN("Sending reading over Bluetooth");
+  uint32_t start = micros();
   const char* reading_str = reading.get_reading_str();
-  size_t size = strlen(reading_str);
+  if(!notify(reading_str, strlen(reading_str), sent)) {
+    ++_metrics.congested;
+    return false;
+  }
+
+  uint32_t duration = micros() - start;
+  ++_metrics.readings;
+  _metrics.last_send = duration;
+  if(duration > _metrics.max_send) {
+    _metrics.max_send = duration;
+  }
+  return true;
+}
 
-  int segment = 0;
-  const static uint8_t max_segment_size = 20; // Max that can be send over bluetooth
-  do {
-    ++segment;
-    uint8_t segment_size = segment * max_segment_size > size ? size % max_segment_size : max_segment_size;
-    char to_send[segment_size];
-    strncpy(to_send, reading_str + ((segment - 1) * max_segment_size), segment_size);
+bool BluetoothReporter::notify(const char* sentence, size_t size, size_t& offset) {
+  auto data = reinterpret_cast<const uint8_t*>(sentence);
+  uint16_t payload_size = get_payload_size();
+  _metrics.payload_size = payload_size;
 
-    pDataRXCharacteristic->setValue((uint8_t*) to_send, segment_size);
+  // Whole sentence in one notification if the MTU allows, segments otherwise
+  while(offset < size) {
+    size_t segment_size = size - offset < payload_size ? size - offset : payload_size;
+    _notify_failed = false;
+    pDataRXCharacteristic->setValue(const_cast<uint8_t*>(data + offset), segment_size);
     pDataRXCharacteristic->notify();
-  } while(segment * max_segment_size < size);
+    if(_notify_failed) {
+      return false;
+    }
+    ++_metrics.notifications;
+    offset += segment_size;
+  }
   return true;
 }
+
+uint16_t BluetoothReporter::get_payload_size() const {
+  uint16_t mtu = BLE_LOCAL_MTU;
+  // The clients connected to our server, BLEDevice only knows the servers we connected to as a client
+  for(const auto& peer : _pServer->getPeerDevices(false)) {
+    uint16_t peer_mtu = peer.second.mtu < BLE_DEFAULT_MTU ? BLE_DEFAULT_MTU : peer.second.mtu;
+    if(peer_mtu < mtu) {
+      mtu = peer_mtu;
+    }
+  }
+  return mtu - BLE_ATT_HEADER_SIZE;
+}
@@ -2,17 +2,60 @@
 #define BGEIGIECAST_BLUETOOTH_CONNECTOR_H
 
 #include <BLEDevice.h>
+#include <BLE2902.h>
+#include <atomic>
 
 #include <Handler.hpp>
+#include <Worker.hpp>
+#include <LockFreeQueue.hpp>
 
 #include "bluetooth_settings.h"
 #include "reading.h"
 #include "local_storage.h"
+#include "circular_buffer.h"
+#include "ble_beacon.h"
+#include "log_transfer.h"
+#include "reading_log.h"
 
 /**
- * Setups up bluetooth endpoint for the device, allowing it to send readings over bluetooth
+ * Notification statistics, written by the network task
  */
-class BluetoothReporter : public Handler {
+struct BluetoothMetrics {
+  std::atomic<uint32_t> readings;
+  std::atomic<uint32_t> notifications;
+  std::atomic<uint16_t> payload_size; // notification size used for the last reading
+  std::atomic<uint32_t> last_send; // micros to notify the last reading
+  std::atomic<uint32_t> max_send;
+  std::atomic<uint16_t> backlog; // readings waiting for a subscribed client
+  std::atomic<uint32_t> dropped; // oldest backlog readings replaced because the backlog was full
+  std::atomic<uint32_t> replayed;
+  std::atomic<uint32_t> congested; // notifications refused by the stack, retried after a back off
+  std::atomic<uint16_t> last_replay_readings;
+  std::atomic<uint32_t> last_replay_bytes;
+  std::atomic<uint32_t> last_replay_duration; // millis from the first replayed reading until the backlog was empty
+  std::atomic<uint32_t> bring_up; // micros to initialize the stack, register the services and start advertising
+  std::atomic<uint32_t> advertising_since; // millis when advertising was (re)started by activating the reporter
+};
+
+/**
+ * Setups up bluetooth endpoint for the device, allowing it to send readings over bluetooth.
+ *
+ * Readings produced while no client is subscribed are kept in a backlog. When a client subscribes, the backlog is
+ * replayed in small bursts before live readings are sent again, a burst stops when the stack refuses a notification.
+ * A sentence sent in segments continues with the refused segment, it leaves the backlog once all segments are sent.
+ *
+ * The latest reading is also broadcast in the advertising data (see BleBeacon), for scanners that do not connect.
+ *
+ * Readings are stored in the reading log, clients download it with the log control and log data characteristics (see
+ * LogTransfer for the protocol). A faster connection interval is requested during a download.
+ *
+ * The worker part runs every tick of the network task: it sends the log transfer packets and replays the backlog,
+ * the handler part only runs when a new reading was produced.
+ */
+class BluetoothReporter : public Handler,
+                          public Worker<bool>,
+                          private BLEServerCallbacks,
+                          private BLECharacteristicCallbacks {
  public:
   typedef enum Status {
     e_handler_idle = -1,
@@ -20,26 +63,128 @@ class BluetoothReporter : public Handler {
     e_handler_no_clients,
   } Status;
 
-  explicit BluetoothReporter(LocalStorage& config);
+  BluetoothReporter(LocalStorage& config, ReadingLog& log);
   virtual ~BluetoothReporter() = default;
 
+  const BluetoothMetrics& get_metrics() const;
+
+  /**
+   * Print the notification statistics
+   * @param out
+   */
+  void print_metrics(Print& out) const;
+
+  const LogTransferMetrics& get_transfer_metrics() const;
+
  protected:
   bool activate(bool retry) override;
   void deactivate() override;
   int8_t handle_produced_work(const worker_status_t& worker_reports) override;
+  int8_t produce_data() override;
  private:
+  /**
+   * Reading sentence as it is notified, without the parsed values
+   */
+  struct Sentence {
+    uint8_t length;
+    char data[READING_STR_MAX];
+  };
+
+  /**
+   * Log transfer command as written by the client
+   */
+  struct LogCommand {
+    uint8_t size;
+    uint8_t data[8];
+  };
+
+  void onConnect(BLEServer* pServer, esp_ble_gatts_cb_param_t* param) override;
+  void onDisconnect(BLEServer* pServer) override;
+
+  /**
+   * GATT server events after the server handled them, for the address of a disconnected client (onDisconnect does
+   * not get it)
+   */
+  static void on_gatts_event(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t* param);
+  void onWrite(BLECharacteristic* pCharacteristic) override;
+  void onStatus(BLECharacteristic* pCharacteristic, BLECharacteristicCallbacks::Status status, uint32_t code) override;
 
-  bool send_reading(const Reading& reading) const;
+  /**
+   * @return true if a client is connected and has notifications enabled
+   */
+  bool is_subscribed() const;
 
-  void create_ble_profile_service(BLEServer* pServer);
-  void create_ble_device_service(BLEServer* pServer);
-  void create_ble_data_service(BLEServer* pServer);
+  /**
+   * @param sent: bytes the client got, less than the sentence if it failed after some segments
+   * @return false if the stack refused a notification
+   */
+  bool send_reading(const Reading& reading, size_t& sent);
+
+  /**
+   * Notify a sentence, in segments if the MTU is too small
+   * @param offset: first byte to send, advanced past every segment the stack accepted
+   * @return false if the stack refused a notification, offset is the start of the refused segment
+   */
+  bool notify(const char* sentence, size_t size, size_t& offset);
+
+  void add_to_backlog(const Reading& reading);
+
+  /**
+   * Set the advertising data to the current beacon
+   */
+  void update_beacon();
+
+  /**
+   * Notify the next burst of the backlog
+   */
+  void replay();
+
+  /**
+   * Handle the log transfer commands and send what the window allows
+   */
+  void transfer_log();
+
+  /**
+   * Request a short connection interval for a log transfer, or the normal interval after it
+   */
+  void set_fast_connection(bool fast);
+
+  /**
+   * Get the largest notification all connected clients can receive, based on the MTU they negotiated
+   */
+  uint16_t get_payload_size() const;
+
+  /**
+   * Register the services of the GATT table (ble_gatt_table.h)
+   */
+  void create_gatt_services(BLEServer* pServer);
 
   LocalStorage& config;
+  ReadingLog& _log;
   BLEServer* _pServer;
   BLECharacteristic* pDataRXCharacteristic;
+  BLE2902* pDataRXNotifications;
+  BLECharacteristic* pLogDataCharacteristic;
+  BLE2902* pLogDataNotifications;
+  BluetoothMetrics _metrics;
+  std::atomic<bool> _notify_failed;
+  std::atomic<bool> _advertise;
+
+  CircularBuffer<Sentence, BLE_BACKLOG_SIZE> _backlog;
+  bool _replaying;
+  uint32_t _replay_start;
+  bool _replay_backoff;
+  uint32_t _replay_backoff_start;
+  uint16_t _replay_readings;
+  uint32_t _replay_bytes;
+  size_t _replay_offset; // bytes of the oldest backlog sentence the client already got
+
+  BleBeacon _beacon;
 
-  uint8_t addr[BLE_DATA_ADDR_SIZE] = BLE_DATA_ADDR;
+  LogTransfer _transfer;
+  LockFreeQueue<LogCommand, BLE_LOG_COMMAND_QUEUE_SIZE> _log_commands; // written by the BLE task
+  esp_bd_addr_t _peer_address; // of the last connected client, the one that can run a log transfer
+  bool _fast_connection;
 };
 
 #endif //BGEIGIECAST_BLUETOOTH_CONNECTOR_H
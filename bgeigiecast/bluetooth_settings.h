@@ -2,7 +2,22 @@
 #define BGEIGIECAST_BLUETOOTH_SETTINGS_H
 
 #define BLE_DATA_ADDR_SIZE    6
-#define BLE_DATA_ADDR         {0x88, 0x6B, 0x0F, 0x09, 0x7C, 0x9A}
+#define BLE_LOCAL_MTU         247 // Offered in the MTU exchange, 244 byte notifications fit one data length extended packet
+#define BLE_DEFAULT_MTU       23 // Until the client exchanged the MTU
+#define BLE_ATT_HEADER_SIZE   3 // Opcode and handle of a notification
+#define BLE_BACKLOG_SIZE      120 // Readings kept while no client is subscribed, 10 minutes of 5 second readings
+#define BLE_REPLAY_BURST      4 // Backlog readings notified per handler cycle
+#define BLE_REPLAY_BACKOFF_MILLIS 50 // Pause of the replay after the stack refused a notification (congested)
+#define BLE_DATA_ADDR         "\x88\x6B\x0F\x09\x7C\x9A"
+#define BLE_LOG_COMMAND_QUEUE_SIZE 8 // Log transfer commands written by the client, handled on the network task
+#define BLE_CONN_FAST_MIN_INTERVAL 6 // 7.5 ms (1.25 ms units), requested during a log transfer
+#define BLE_CONN_FAST_MAX_INTERVAL 12 // 15 ms
+#define BLE_CONN_SLOW_MIN_INTERVAL 24 // 30 ms, requested again after the transfer
+#define BLE_CONN_SLOW_MAX_INTERVAL 48 // 60 ms
+#define BLE_CONN_TIMEOUT 400 // 4 s (10 ms units)
+#define BLE_ADV_MAX_SIZE 31 // Legacy advertising and scan response data
+#define BLE_AD_HEADER_SIZE 2 // Length and type of an advertising data structure
+#define BLE_UUID128_SIZE 16
 
 #define BLE_PROFILE_NAME                            "bGeigie advanced module"
 
@@ -26,5 +41,7 @@
 #define CHARACTERISTIC_DATA_BAUD_UUID               "2FBC0F31-726A-4014-B9FE-C8BE0652E982"
 #define CHARACTERISTIC_DATA_RX_UUID                 "A1E8F5B1-696B-4E4C-87C6-69DFE0B0093B"
 #define CHARACTERISTIC_DATA_TX_UUID                 "1494440E-9A58-4CC0-81E4-DDEA7F74F623"
+#define CHARACTERISTIC_LOG_CONTROL_UUID             "5B8E2C4A-0E51-4C6B-9A6E-3F1D2B7C8A90"
+#define CHARACTERISTIC_LOG_DATA_UUID                "5B8E2C4B-0E51-4C6B-9A6E-3F1D2B7C8A90"
 
 #endif //BGEIGIECAST_BLUETOOTH_SETTINGS_H
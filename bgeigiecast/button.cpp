@@ -1,33 +1,122 @@
 #include "button.h"
 #include "debugger.h"
 
-void buttonTrigger(void* arg) {
-  if(!arg) {
-    return;
-  }
-  Button* b = ((Button*) arg);
-  // Read the pin value here so we can use the state_changed in unit tests
-  b->state_changed(digitalRead(b->get_pin()), millis());
-}
-
 Button::Button(uint8_t pin, uint8_t pull_type) :
+#ifdef ARDUINO
+    _task(nullptr),
+    _debounce_timer(nullptr),
+    _gesture_timer(nullptr),
+    _edge_pending(false),
+    _edge_micros(0),
+#endif
     _pin(pin),
     _pull_type_mode(pull_type == PULLDOWN ? HIGH : LOW),
     _observer(nullptr),
     _current_state(false),
-    _last_state_change(0) {
+    _last_state_change(0),
+    _single_pending(false),
+    _gesture_done(false),
+    _gesture_deadline(0),
+    _metrics() {
 }
 
 Button::~Button() {
+#ifdef ARDUINO
   gpio_isr_handler_remove((gpio_num_t) _pin);
+  if(_task) {
+    vTaskDelete(_task);
+  }
+  if(_debounce_timer) {
+    esp_timer_stop(_debounce_timer);
+    esp_timer_delete(_debounce_timer);
+  }
+  if(_gesture_timer) {
+    esp_timer_stop(_gesture_timer);
+    esp_timer_delete(_gesture_timer);
+  }
+#endif
 }
 
+#ifdef ARDUINO
 void Button::activate() {
+  if(!_task) {
+    esp_timer_create_args_t timer_args{};
+    timer_args.callback = &Button::on_debounced;
+    timer_args.arg = this;
+    timer_args.name = "button_debounce";
+    esp_timer_create(&timer_args, &_debounce_timer);
+    timer_args.callback = &Button::on_gesture_deadline;
+    timer_args.name = "button_gesture";
+    esp_timer_create(&timer_args, &_gesture_timer);
+    xTaskCreate(task, "Button", BUTTON_TASK_STACK_SIZE, this, BUTTON_TASK_PRIORITY, &_task);
+  }
   gpio_set_intr_type((gpio_num_t) _pin, GPIO_INTR_ANYEDGE);
-  gpio_isr_handler_add((gpio_num_t) _pin, buttonTrigger, this);
+  gpio_isr_handler_add((gpio_num_t) _pin, on_interrupt, this);
   _current_state = digitalRead(_pin) == _pull_type_mode;
 }
 
+void IRAM_ATTR Button::on_interrupt(void* arg) {
+  auto start = static_cast<uint32_t>(esp_timer_get_time());
+  auto button = static_cast<Button*>(arg);
+  if(!button->_edge_pending.exchange(true)) {
+    button->_edge_micros = start;
+  }
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(button->_task, &woken);
+
+  ++button->_metrics.interrupts;
+  uint32_t duration = static_cast<uint32_t>(esp_timer_get_time()) - start;
+  button->_metrics.last_isr = duration;
+  if(duration > button->_metrics.max_isr) {
+    button->_metrics.max_isr = duration;
+  }
+  if(woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+void Button::task(void* arg) {
+  auto button = static_cast<Button*>(arg);
+  for(;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    // Every bounce restarts the timer, it fires when the pin was stable for the debounce time
+    esp_timer_stop(button->_debounce_timer);
+    esp_timer_start_once(button->_debounce_timer, BUTTON_DEBOUNCE_TIME_MILLIS * 1000);
+  }
+}
+
+void Button::on_debounced(void* arg) {
+  auto button = static_cast<Button*>(arg);
+  uint32_t edge = button->_edge_micros;
+  button->_edge_pending = false;
+  button->state_changed(digitalRead(button->_pin), millis());
+  button->schedule_gesture();
+
+  uint32_t latency = static_cast<uint32_t>(esp_timer_get_time()) - edge;
+  button->_metrics.last_latency = latency;
+  if(latency > button->_metrics.max_latency) {
+    button->_metrics.max_latency = latency;
+  }
+}
+
+void Button::on_gesture_deadline(void* arg) {
+  auto button = static_cast<Button*>(arg);
+  button->time_passed(millis());
+  button->schedule_gesture();
+}
+
+void Button::schedule_gesture() {
+  esp_timer_stop(_gesture_timer);
+  if(_gesture_deadline) {
+    int32_t remaining = static_cast<int32_t>(_gesture_deadline - millis());
+    esp_timer_start_once(_gesture_timer, remaining > 0 ? remaining * 1000 : 0);
+  }
+}
+#else
+void Button::activate() {
+}
+#endif
+
 void Button::set_observer(ButtonObserver* observer) {
   _observer = observer;
 }
@@ -46,14 +135,51 @@ bool Button::state_changed(int state, uint32_t time) {
 
   if(_current_state) {
     if(_observer) { _observer->on_button_down(this); }
+    if(_single_pending) {
+      _single_pending = false;
+      _gesture_done = true;
+      _gesture_deadline = 0;
+      fire(e_gesture_double);
+    } else {
+      _gesture_done = false;
+      _gesture_deadline = time + BUTTON_LONG_HOLD_MILLIS;
+    }
   } else if(_last_state_change != 0) { // Ignore initial presses at startups
     if(_observer) { _observer->on_button_release(this); }
     if(_observer) { _observer->on_button_pressed(this, time - _last_state_change); }
+    if(_gesture_done) {
+      _gesture_deadline = 0;
+    } else {
+      _single_pending = true;
+      _gesture_deadline = time + BUTTON_DOUBLE_PRESS_MILLIS;
+    }
   }
   _last_state_change = time;
   return true;
 }
 
+void Button::time_passed(uint32_t time) {
+  if(!_gesture_deadline || static_cast<int32_t>(time - _gesture_deadline) < 0) {
+    return;
+  }
+  _gesture_deadline = 0;
+  if(_single_pending) {
+    _single_pending = false;
+    fire(e_gesture_single);
+  } else if(_current_state && !_gesture_done) {
+    _gesture_done = true;
+    fire(e_gesture_long_hold);
+  }
+}
+
+uint32_t Button::get_gesture_deadline() const {
+  return _gesture_deadline;
+}
+
+void Button::fire(ButtonGesture gesture) {
+  if(_observer) { _observer->on_button_gesture(this, gesture); }
+}
+
 uint8_t Button::get_pin() const {
   return _pin;
 }
@@ -61,3 +187,7 @@ uint8_t Button::get_pin() const {
 uint32_t Button::get_last_state_change() const {
   return _last_state_change;
 }
+
+const ButtonMetrics& Button::get_metrics() const {
+  return _metrics;
+}
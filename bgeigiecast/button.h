@@ -2,13 +2,51 @@
 #define BGEIGIECAST_BUTTON_HPP
 
 #define BUTTON_DEBOUNCE_TIME_MILLIS 50
+#define BUTTON_DOUBLE_PRESS_MILLIS 300 // A second press within this time after a release is a double press
+#define BUTTON_LONG_HOLD_MILLIS 4000 // Long hold fires while the button is still held
+#define BUTTON_TASK_STACK_SIZE 2048
+#define BUTTON_TASK_PRIORITY 5
 
+#include <stdint.h>
+#include <atomic>
+
+#ifdef ARDUINO
 #include <Arduino.h>
+#include <esp_timer.h>
+#else
+// Host tests only use the gesture recognizer
+#define LOW 0x0
+#define HIGH 0x1
+#define PULLUP 0x04
+#define PULLDOWN 0x08
+#endif
 
 class ButtonObserver;
 
+typedef enum ButtonGesture {
+  e_gesture_single, // Released and not pressed again within BUTTON_DOUBLE_PRESS_MILLIS
+  e_gesture_double,
+  e_gesture_long_hold, // Held for BUTTON_LONG_HOLD_MILLIS, the release after it is not a gesture
+} ButtonGesture;
+
+/**
+ * Interrupt and latency statistics of a button
+ */
+struct ButtonMetrics {
+  std::atomic<uint32_t> interrupts;
+  std::atomic<uint32_t> last_isr; // micros spent in the interrupt handler
+  std::atomic<uint32_t> max_isr;
+  std::atomic<uint32_t> last_latency; // micros from the first interrupt of an edge until it was handled (debounced)
+  std::atomic<uint32_t> max_latency;
+};
+
 /**
  * A nice button class
+ *
+ * The interrupt handler only records the time and notifies the button task. The task (re)starts a one-shot debounce
+ * timer, when the pin was stable for BUTTON_DEBOUNCE_TIME_MILLIS the timer reads it and calls `state_changed`. Gestures
+ * that depend on time passing (single press, long hold) fire from a second one-shot timer through `time_passed`.
+ * Observers are called from the esp_timer task.
  */
 class Button {
  public:
@@ -29,6 +67,18 @@ class Button {
    */
   bool state_changed(int state, uint32_t time);
 
+  /**
+   * Let the button know that time has passed, fires the gestures that waited for it
+   * @param time: current time
+   */
+  void time_passed(uint32_t time);
+
+  /**
+   * Get the time `time_passed` has to be called
+   * @return millis, 0 if no gesture is waiting
+   */
+  uint32_t get_gesture_deadline() const;
+
   /**
    * Get pin number
    * @return: pin number
@@ -53,12 +103,38 @@ class Button {
    */
   void set_observer(ButtonObserver* observer);
 
+  const ButtonMetrics& get_metrics() const;
+
  private:
+  void fire(ButtonGesture gesture);
+
+#ifdef ARDUINO
+  static void IRAM_ATTR on_interrupt(void* arg);
+  static void task(void* arg);
+  static void on_debounced(void* arg);
+  static void on_gesture_deadline(void* arg);
+
+  /**
+   * Arm the gesture timer for the current deadline
+   */
+  void schedule_gesture();
+
+  TaskHandle_t _task;
+  esp_timer_handle_t _debounce_timer;
+  esp_timer_handle_t _gesture_timer;
+  std::atomic<bool> _edge_pending;
+  std::atomic<uint32_t> _edge_micros; // first interrupt of the pending edge
+#endif
+
   uint8_t _pin;
   bool _pull_type_mode;
   ButtonObserver* _observer;
   bool _current_state;
   uint32_t _last_state_change;
+  bool _single_pending; // released once, waiting for a second press
+  bool _gesture_done; // the current press already fired a gesture (double, long hold)
+  uint32_t _gesture_deadline;
+  ButtonMetrics _metrics;
 };
 
 /**
@@ -93,6 +169,13 @@ class ButtonObserver {
    * @param millis: how long the button was pressed in millis
    */
   virtual void on_button_pressed(Button* button, uint32_t millis) {/*no implementation*/};
+
+  /**
+   * Callback when a gesture is recognized
+   * @param button: The button that caused the trigger
+   * @param gesture: single, double or long hold
+   */
+  virtual void on_button_gesture(Button* button, ButtonGesture gesture) {/*no implementation*/};
 };
 
 #endif //BGEIGIECAST_BUTTON_HPP
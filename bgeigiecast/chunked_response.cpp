@@ -0,0 +1,80 @@
+#include "chunked_response.h"
+
+ChunkedResponse::ChunkedResponse(HttpResponse& response, int code, const char* content_type, ResponseMetrics* metrics)
+    : _response(response),
+      _metrics(metrics),
+      _started_at(micros()),
+      _first_chunk_at(0),
+      _ended(false),
+      _length(0),
+      _buffer() {
+  _response.begin_chunked(code, content_type);
+}
+
+ChunkedResponse::~ChunkedResponse() {
+  end();
+}
+
+size_t ChunkedResponse::write(uint8_t c) {
+  if(_ended) {
+    return 0;
+  }
+  if(_length == sizeof(_buffer)) {
+    flush_buffer();
+  }
+  _buffer[_length++] = static_cast<char>(c);
+  return 1;
+}
+
+size_t ChunkedResponse::write(const uint8_t* buffer, size_t size) {
+  if(_ended) {
+    return 0;
+  }
+  if(_length + size <= sizeof(_buffer)) {
+    memcpy(&_buffer[_length], buffer, size);
+    _length += size;
+    return size;
+  }
+  // Does not fit, send what is buffered and send large writes as their own chunk
+  flush_buffer();
+  if(size >= sizeof(_buffer)) {
+    if(!_first_chunk_at) {
+      _first_chunk_at = micros();
+    }
+    _response.write_chunk(reinterpret_cast<const char*>(buffer), size);
+  } else {
+    memcpy(_buffer, buffer, size);
+    _length = size;
+  }
+  return size;
+}
+
+void ChunkedResponse::end() {
+  if(_ended) {
+    return;
+  }
+  flush_buffer();
+  _response.end_chunked();
+  _ended = true;
+
+  if(_metrics) {
+    uint32_t now = micros();
+    uint32_t ttfb = (_first_chunk_at ? _first_chunk_at : now) - _started_at;
+    ++_metrics->responses;
+    _metrics->last_ttfb = ttfb;
+    uint32_t max_ttfb = _metrics->max_ttfb;
+    while(ttfb > max_ttfb && !_metrics->max_ttfb.compare_exchange_weak(max_ttfb, ttfb)) {}
+    _metrics->last_duration = now - _started_at;
+  }
+}
+
+void ChunkedResponse::flush_buffer() {
+  if(_length == 0) {
+    return;
+  }
+  if(!_first_chunk_at) {
+    _first_chunk_at = micros();
+  }
+  _response.write_chunk(_buffer, _length);
+  _length = 0;
+}
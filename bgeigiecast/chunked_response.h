@@ -0,0 +1,60 @@
+#ifndef BGEIGIECAST_CHUNKED_RESPONSE_H
+#define BGEIGIECAST_CHUNKED_RESPONSE_H
+
+#include <atomic>
+#include <Arduino.h>
+
+#include "http_server.h"
+
+#ifndef CHUNKED_RESPONSE_BUFFER_SIZE
+#define CHUNKED_RESPONSE_BUFFER_SIZE 256
+#endif
+
+/**
+ * Timing of the streamed responses, updated by concurrent requests
+ */
+struct ResponseMetrics {
+  std::atomic<uint32_t> responses;
+  std::atomic<uint32_t> last_ttfb; // micros from the start of the response until the first body chunk was sent
+  std::atomic<uint32_t> max_ttfb;
+  std::atomic<uint32_t> last_duration; // micros from the start of the response until the last chunk was sent
+  std::atomic<uint32_t> not_modified; // static resources answered with 304
+};
+
+/**
+ * Streams a response body with chunked transfer encoding. Writes are collected in a small buffer which is sent as a
+ * chunk when full, so the client starts receiving while the rest of the body is still being rendered.
+ */
+class ChunkedResponse : public Print {
+ public:
+  /**
+   * Sends the status line and headers, the body follows through the print functions
+   * @param response: response of the current request
+   * @param code: http status code
+   * @param content_type
+   * @param metrics: optional, updated when the response ends
+   */
+  ChunkedResponse(HttpResponse& response, int code, const char* content_type, ResponseMetrics* metrics = nullptr);
+  virtual ~ChunkedResponse();
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  /**
+   * Send the remaining buffer and the closing chunk, done automatically when the response goes out of scope
+   */
+  void end();
+
+ private:
+  void flush_buffer();
+
+  HttpResponse& _response;
+  ResponseMetrics* _metrics;
+  uint32_t _started_at;
+  uint32_t _first_chunk_at;
+  bool _ended;
+  size_t _length;
+  char _buffer[CHUNKED_RESPONSE_BUFFER_SIZE];
+};
+
+#endif //BGEIGIECAST_CHUNKED_RESPONSE_H
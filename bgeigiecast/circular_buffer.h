@@ -26,6 +26,14 @@ class CircularBuffer {
     return val;
   };
 
+  /**
+   * Get the next value without removing it, should check if buffer is not empty before calling this
+   * @return: next value T
+   */
+  T& peek() {
+    return buffer[current];
+  };
+
   /**
    * Add a value to the buffer. If the buffer is full, it will throw away the oldest value and add this.
    * @param val
@@ -48,6 +56,14 @@ class CircularBuffer {
     return count == 0;
   }
 
+  /**
+   * Check if the buffer is full, the next add replaces the oldest value
+   * @return: true if buffer is full
+   */
+  bool full() const {
+    return count == max;
+  }
+
   /**
    * Get the amount of items in the buffer
    * @return
@@ -1,13 +1,18 @@
-#include <Update.h>
 #include <ESPmDNS.h>
+#include <mutex>
 #include "configuration_server.h"
 #include "user_config.h"
 #include "local_storage.h"
 #include "debugger.h"
 #include "http_pages.h"
+#include "chunked_response.h"
+#include "web_assets.h"
+#include "json_writer.h"
 #include "identifiers.h"
+#include "ota_updater.h"
 
 #define RETRY_TIMEOUT 4000
+#define UPDATE_BUFFER_SIZE 1024
 
 template<typename T, typename T2>
 T clamp(T2 val, T min, T max) {
@@ -15,10 +20,14 @@ T clamp(T2 val, T min, T max) {
   return _val < min ? min : _val > max ? max : _val;
 }
 
-ConfigWebServer::ConfigWebServer(LocalStorage& config)
-    : Worker<ServerStatus>(k_worker_configuration_server, k_server_status_offline, 0),
-      _server(SERVER_WIFI_PORT),
-      _config(config) {
+ConfigWebServer::ConfigWebServer(LocalStorage& config, const StateTrace* trace, const ApiReporter* api_reporter)
+    : Worker<ServerStatus>(k_worker_configuration_server, k_server_status_offline, 0, k_group_network),
+      _server(),
+      _config(config),
+      _trace(trace),
+      _api_reporter(api_reporter),
+      _status(),
+      _metrics() {
   add_urls();
 }
 
@@ -32,8 +41,12 @@ bool ConfigWebServer::activate(bool) {
       MDNS.addService("http", "tcp", 80);
     }
 
-    // Start config server
-    _server.begin(SERVER_WIFI_PORT);
+    // Start config server, requests are handled by its own tasks
+    if(!_server.is_running() && !_server.begin(SERVER_WIFI_PORT)) {
+      DEBUG_PRINTLN("Unable to start config server");
+      MDNS.end();
+      return false;
+    }
     HttpPages::internet_access = WiFiConnection::wifi_connected();
     return true;
   }
@@ -41,13 +54,14 @@ bool ConfigWebServer::activate(bool) {
 }
 
 void ConfigWebServer::deactivate() {
-  _server.close();
   _server.stop();
+  _events.close_all();
   MDNS.end();
 }
 
 int8_t ConfigWebServer::produce_data() {
-  _server.handleClient();
+  publish_readings();
+  _events.loop();
   if(data == k_server_status_offline) {
     data = HttpPages::internet_access ? k_server_status_running_wifi : k_server_status_running_access_point;
     return WorkerStatus::e_worker_data_read;
@@ -57,176 +71,355 @@ int8_t ConfigWebServer::produce_data() {
 
 void ConfigWebServer::add_urls() {
   // Home
-  _server.on("/", HTTP_GET, [this]() {
-    _server.sendHeader("Connection", "close");
-    _server.send(200, "text/html", HttpPages::get_home_page(_config.get_device_id()));
+  _server.on("/", e_http_get, [this](HttpRequest&, HttpResponse& response) {
+    ChunkedResponse out(response, 200, "text/html", &_metrics);
+    HttpPages::render_home_page(out, _config.get_device_id());
   });
 
   // Configure Device
-  _server.on("/device", HTTP_GET, [this]() {
-    _server.sendHeader("Connection", "close");
-    _server.send(200, "text/html", HttpPages::get_config_device_page(
-        _server.hasArg("success"),
-        _config.get_device_id(),
-        _config.get_led_color_intensity(),
-        _config.is_led_color_blind()
-    ));
+  _server.on("/device", e_http_get, [this](HttpRequest& request, HttpResponse& response) {
+    uint16_t device_id;
+    uint8_t led_color_intensity;
+    bool led_color_blind;
+    {
+      std::lock_guard<LocalStorage> guard(_config);
+      device_id = _config.get_device_id();
+      led_color_intensity = _config.get_led_color_intensity();
+      led_color_blind = _config.is_led_color_blind();
+    }
+    ChunkedResponse out(response, 200, "text/html", &_metrics);
+    HttpPages::render_config_device_page(
+        out,
+        request.has_arg("success"),
+        device_id,
+        led_color_intensity,
+        led_color_blind
+    );
   });
 
   // Configure Connection
-  _server.on("/connection", HTTP_GET, [this]() {
-    _server.sendHeader("Connection", "close");
-    _server.send(200, "text/html", HttpPages::get_config_connection_page(
-        _server.hasArg("success"),
-        _config.get_device_id(),
-        _config.get_ap_password(),
-        _config.get_wifi_ssid(),
-        _config.get_wifi_password(),
-        _config.get_api_key(),
-        _config.get_use_dev()
-    ));
+  _server.on("/connection", e_http_get, [this](HttpRequest& request, HttpResponse& response) {
+    // Copies, a save on another server task changes the strings while the page is sent
+    uint16_t device_id;
+    char ap_password[CONFIG_VAL_MAX];
+    WiFiProfile wifi_profiles[WIFI_PROFILE_COUNT];
+    char api_key[CONFIG_VAL_MAX];
+    bool use_dev;
+    char update_url[CONFIG_URL_MAX];
+    {
+      std::lock_guard<LocalStorage> guard(_config);
+      device_id = _config.get_device_id();
+      strcpy(ap_password, _config.get_ap_password());
+      memcpy(wifi_profiles, _config.get_wifi_profiles(), sizeof(wifi_profiles));
+      strcpy(api_key, _config.get_api_key());
+      use_dev = _config.get_use_dev();
+      strcpy(update_url, _config.get_update_url());
+    }
+    ChunkedResponse out(response, 200, "text/html", &_metrics);
+    HttpPages::render_config_connection_page(
+        out,
+        request.has_arg("success"),
+        device_id,
+        ap_password,
+        wifi_profiles,
+        api_key,
+        use_dev,
+        update_url
+    );
   });
 
   // Configure Location
-  _server.on("/location", HTTP_GET, [this]() {
-
-    _server.sendHeader("Connection", "close");
-    _server.send(200, "text/html", HttpPages::get_config_location_page(
-        _server.hasArg("success"),
-        _config.get_device_id(),
-        _config.get_use_home_location(),
-        _config.get_home_latitude(),
-        _config.get_home_longitude(),
-        _config.get_last_latitude(),
-        _config.get_last_longitude()
-    ));
-
-    _server.sendHeader("Connection", "close");
+  _server.on("/location", e_http_get, [this](HttpRequest& request, HttpResponse& response) {
+    uint16_t device_id;
+    bool use_home_location;
+    double home_latitude, home_longitude, last_latitude, last_longitude;
+    {
+      std::lock_guard<LocalStorage> guard(_config);
+      device_id = _config.get_device_id();
+      use_home_location = _config.get_use_home_location();
+      home_latitude = _config.get_home_latitude();
+      home_longitude = _config.get_home_longitude();
+      last_latitude = _config.get_last_latitude();
+      last_longitude = _config.get_last_longitude();
+    }
+    ChunkedResponse out(response, 200, "text/html", &_metrics);
+    HttpPages::render_config_location_page(
+        out,
+        request.has_arg("success"),
+        device_id,
+        use_home_location,
+        home_latitude,
+        home_longitude,
+        last_latitude,
+        last_longitude
+    );
   });
 
   // Save config
-  _server.on("/save", HTTP_POST, [this]() {
-    handle_save();
+  _server.on("/save", e_http_post, [this](HttpRequest& request, HttpResponse& response) {
+    handle_save(request, response);
   });
 
   // Upload get
-  _server.on("/update", HTTP_GET, [this]() {
-    _server.sendHeader("Connection", "close");
-    _server.send(200, "text/html", HttpPages::get_update_page(_config.get_device_id()));
+  _server.on("/update", e_http_get, [this](HttpRequest&, HttpResponse& response) {
+    ChunkedResponse out(response, 200, "text/html", &_metrics);
+    HttpPages::render_update_page(out, _config.get_device_id());
   });
 
   // Status get
-  _server.on("/status", HTTP_GET, [this]() {
-    _server.sendHeader("Connection", "close");
-    _server.send(200, "text/html", HttpPages::get_status_page(_config.get_device_id()));
+  _server.on("/status", e_http_get, [this](HttpRequest&, HttpResponse& response) {
+    ChunkedResponse out(response, 200, "text/html", &_metrics);
+    HttpPages::render_status_page(out, _config.get_device_id());
   });
 
-  // Upload post
-  _server.on("/update", HTTP_POST, [this]() {
-    // Complete
-    _server.sendHeader("Connection", "close");
-    if(_server.upload().totalSize == 0 || Update.hasError()) {
-      _server.send(500, "text/plain", "FAIL");
-    } else {
-      _server.send(200, "text/plain", "OK");
-      _server.client().flush();
-    }
-  }, [this]() {
-    // Progress
-    handle_update_uploading();
+  // Upload post, the firmware is the raw body
+  _server.on("/update", e_http_post, [this](HttpRequest& request, HttpResponse& response) {
+    handle_update(request, response);
+  }, true);
+
+  // Live status as json
+  _server.on("/api/status", e_http_get, [this](HttpRequest&, HttpResponse& response) {
+    handle_api_status(response);
   });
 
-  _server.on("/reboot", [this]() { // Reboot
-    _server.send(200, "text/plain", "OK");
-    _server.client().flush();
-    ESP.restart();
+  // Live readings as server-sent events
+  _server.on("/events", e_http_get, [this](HttpRequest&, HttpResponse& response) {
+    if(_events.get_client_count() >= EVENT_STREAM_MAX_CLIENTS) {
+      response.send(503, "text/plain", "Too many clients");
+      return;
+    }
+    response.add_header("Cache-Control", "no-store");
+    response.add_header("Access-Control-Allow-Origin", "*");
+    response.begin_stream(200, "text/event-stream");
+    // The event stream takes over the connection
+    _events.add_client(response.detach());
   });
 
-  // css get
-  _server.on("/pure.css", HTTP_GET, [this]() {
-    _server.sendHeader("Content-Encoding", "gzip");
-    _server.send_P(200, "text/css", reinterpret_cast<const char*>(HttpPages::pure_css), PURE_CSS_SIZE);
+  // State machine trace get
+  _server.on("/trace", e_http_get, [this](HttpRequest&, HttpResponse& response) {
+    handle_trace(response);
   });
 
-  // css get
-  _server.on("/favicon.ico", HTTP_GET, [this]() {
-    _server.send_P(200, "image/x-icon", reinterpret_cast<const char*>(HttpPages::favicon), FAVICON_SIZE);
+  // Reboot
+  _server.on("/reboot", e_http_any, [](HttpRequest&, HttpResponse& response) {
+    response.send(200, "text/plain", "OK");
+    delay(100);
+    ESP.restart();
   });
+
+  // Static resources
+  for(const auto& asset : web_assets) {
+    _server.on(asset.path, e_http_get, [this, &asset](HttpRequest& request, HttpResponse& response) {
+      handle_asset(asset, request, response);
+    });
+  }
 }
 
-void ConfigWebServer::handle_save() {
-  if(_server.hasArg(FORM_NAME_AP_LOGIN)) {
-    _config.set_ap_password(_server.arg(FORM_NAME_AP_LOGIN).c_str(), false);
+void ConfigWebServer::handle_save(HttpRequest& request, HttpResponse& response) {
+  {
+    // Two saves at the same time should not mix their settings, and readers see all or none of a save
+    std::lock_guard<LocalStorage> guard(_config);
+    if(request.has_arg(FORM_NAME_AP_LOGIN)) {
+      _config.set_ap_password(request.arg(FORM_NAME_AP_LOGIN), false);
+    }
+    char ssid_name[8];
+    char pass_name[8];
+    char priority_name[8];
+    for(uint8_t i = 0; i < WIFI_PROFILE_COUNT; ++i) {
+      HttpPages::wifi_form_name(ssid_name, FORM_NAME_WIFI_SSID, i);
+      HttpPages::wifi_form_name(pass_name, FORM_NAME_WIFI_PASS, i);
+      HttpPages::wifi_form_name(priority_name, FORM_NAME_WIFI_PRIORITY, i);
+      if(!request.has_arg(ssid_name) && !request.has_arg(pass_name) && !request.has_arg(priority_name)) {
+        continue;
+      }
+      // Fields that are not posted keep their value
+      const auto& profile = _config.get_wifi_profiles()[i];
+      _config.set_wifi_profile(
+          i,
+          request.has_arg(ssid_name) ? request.arg(ssid_name) : profile.ssid,
+          request.has_arg(pass_name) ? request.arg(pass_name) : profile.password,
+          request.has_arg(priority_name)
+          ? clamp<uint8_t>(atoi(request.arg(priority_name)), 0, WIFI_PRIORITY_MAX) : profile.priority,
+          false
+      );
+    }
+    if(request.has_arg(FORM_NAME_API_KEY)) {
+      _config.set_api_key(request.arg(FORM_NAME_API_KEY), false);
+    }
+    if(request.has_arg(FORM_NAME_UPDATE_URL)) {
+      _config.set_update_url(request.arg(FORM_NAME_UPDATE_URL), false);
+    }
+    if(request.has_arg(FORM_NAME_USE_DEV)) {
+      _config.set_use_dev(strcmp(request.arg(FORM_NAME_USE_DEV), "1") == 0, false);
+    }
+    if(request.has_arg(FORM_NAME_LED_INTENSITY)) {
+      _config.set_led_color_intensity(clamp<uint8_t>(atoi(request.arg(FORM_NAME_LED_INTENSITY)), 5, 100), false);
+    }
+    if(request.has_arg(FORM_NAME_LED_COLOR)) {
+      _config.set_led_color_blind(strcmp(request.arg(FORM_NAME_LED_COLOR), "1") == 0, false);
+    }
+    if(request.has_arg(FORM_NAME_LOC_HOME)) {
+      _config.set_use_home_location(strcmp(request.arg(FORM_NAME_LOC_HOME), "1") == 0, false);
+    }
+    if(request.has_arg(FORM_NAME_LOC_HOME_LAT)) {
+      _config.set_home_latitude(clamp<double>(atof(request.arg(FORM_NAME_LOC_HOME_LAT)), -90.0, 90.0), false);
+    }
+    if(request.has_arg(FORM_NAME_LOC_HOME_LON)) {
+      _config.set_home_longitude(clamp<double>(atof(request.arg(FORM_NAME_LOC_HOME_LON)), -180.0, 180.0), false);
+    }
   }
-  if(_server.hasArg(FORM_NAME_WIFI_SSID)) {
-    _config.set_wifi_ssid(_server.arg(FORM_NAME_WIFI_SSID).c_str(), false);
+
+  char location[64];
+  snprintf(location, sizeof(location), "%s?success=true", request.arg("next"));
+  response.add_header("Location", location);
+  response.send(302, "text/html");
+}
+
+void ConfigWebServer::handle_asset(const WebAsset& asset, HttpRequest& request, HttpResponse& response) {
+  response.add_header("ETag", asset.etag);
+  // Pages link the resources with their content hash, a new firmware uses new urls
+  response.add_header("Cache-Control", "public, max-age=" ASSET_MAX_AGE_SECONDS);
+  auto if_none_match = request.header("If-None-Match");
+  if(if_none_match && strcmp(if_none_match, asset.etag) == 0) {
+    ++_metrics.not_modified;
+    response.send(304);
+    return;
   }
-  if(_server.hasArg(FORM_NAME_WIFI_PASS)) {
-    _config.set_wifi_password(_server.arg(FORM_NAME_WIFI_PASS).c_str(), false);
+  if(asset.gzipped) {
+    response.add_header("Content-Encoding", "gzip");
   }
-  if(_server.hasArg(FORM_NAME_API_KEY)) {
-    _config.set_api_key(_server.arg(FORM_NAME_API_KEY).c_str(), false);
+  response.send(200, asset.content_type, asset.data, asset.size);
+}
+
+void ConfigWebServer::handle_api_status(HttpResponse& response) {
+  response.add_header("Cache-Control", "no-store");
+  ChunkedResponse out(response, 200, "application/json", &_metrics);
+  JsonWriter json(out);
+  json.begin_object();
+  json.add("device_id", _config.get_device_id());
+  json.add("version", BGEIGIECAST_VERSION);
+  json.add("uptime", millis() / 1000);
+
+  json.begin_object("heap");
+  json.add("free", ESP.getFreeHeap());
+  json.add("min_free", ESP.getMinFreeHeap());
+  json.end_object();
+
+  json.begin_object("wifi");
+  json.add("connected", WiFiConnection::wifi_connected());
+  if(WiFiConnection::wifi_connected()) {
+    json.add("rssi", WiFi.RSSI());
+  } else {
+    json.add_null("rssi");
   }
-  if(_server.hasArg(FORM_NAME_USE_DEV)) {
-    _config.set_use_dev(_server.arg(FORM_NAME_USE_DEV) == "1", false);
+  json.add("access_point", WiFiConnection::ap_server_up());
+  const auto& wifi = WiFiConnection::get_metrics();
+  json.add("connects", wifi.connects.load());
+  json.add("last_connect_ms", wifi.last_connect.load());
+  json.add("last_fast", wifi.last_fast.load());
+  json.add("network", wifi.last_profile.load());
+  json.end_object();
+
+  json.begin_object("api");
+  if(_api_reporter) {
+    json.add("backlog", _api_reporter->get_backlog());
+  } else {
+    json.add_null("backlog");
   }
-  if(_server.hasArg(FORM_NAME_LED_INTENSITY)) {
-    _config.set_led_color_intensity(clamp<uint8_t>(_server.arg(FORM_NAME_LED_INTENSITY).toInt(), 5, 100), false);
+  json.end_object();
+
+  const auto& ota = _ota.get_metrics();
+  json.begin_object("ota");
+  json.add("size", ota.size);
+  json.add("bytes_per_second", ota.bytes_per_second());
+  json.add("network", ota.network());
+  json.add("hash", ota.hash);
+  json.add("wait", ota.wait);
+  json.add("flash", ota.flash);
+  json.add("finish", ota.finish);
+  json.end_object();
+
+  json.begin_object("events");
+  json.add("clients", _events.get_client_count());
+  json.add("dropped_clients", _events.get_dropped_clients());
+  json.end_object();
+
+  _status.write_json(json);
+  json.end_object();
+}
+
+void ConfigWebServer::handle_trace(HttpResponse& response) {
+  if(!_trace) {
+    response.send(404, "text/plain", "No trace available");
+    return;
   }
-  if(_server.hasArg(FORM_NAME_LED_COLOR)) {
-    _config.set_led_color_blind(strcmp(_server.arg(FORM_NAME_LED_COLOR).c_str(), "1") == 0, false);
+  // Static, the trace can be too large for the stack of the server tasks
+  static uint8_t buffer[StateTrace::k_serialized_size];
+  static std::mutex buffer_lock;
+  std::lock_guard<std::mutex> guard(buffer_lock);
+  auto size = _trace->serialize(buffer, sizeof(buffer));
+  response.add_header("Content-Disposition", "attachment; filename=trace.bin");
+  response.send(200, "application/octet-stream", buffer, size);
+}
+
+void ConfigWebServer::handle_update(HttpRequest& request, HttpResponse& response) {
+  // Only one update at a time
+  std::unique_lock<std::mutex> guard(_update_lock, std::try_to_lock);
+  if(!guard.owns_lock()) {
+    response.send(409, "text/plain", "Update in progress");
+    return;
   }
-  if(_server.hasArg(FORM_NAME_LOC_HOME)) {
-    _config.set_use_home_location(strcmp(_server.arg(FORM_NAME_LOC_HOME).c_str(), "1") == 0, false);
+  size_t total = request.content_length();
+  auto result = _ota.begin(total, request.header(OTA_DIGEST_HEADER));
+  if(result != OtaUpdater::e_ota_ok) {
+    DEBUG_PRINTF("Unable to start update: %s\n", OtaUpdater::result_name(result));
+    response.send(result == OtaUpdater::e_ota_invalid_digest ? 400 : 500, "text/plain", OtaUpdater::result_name(result));
+    return;
   }
-  if(_server.hasArg(FORM_NAME_LOC_HOME_LAT)) {
-    _config.set_home_latitude(clamp<double>(_server.arg(FORM_NAME_LOC_HOME_LAT).toDouble(), -90.0, 90.0), false);
+  DEBUG_PRINTF("Starting update of %u bytes\n", total);
+
+  // Flash writes happen in the background, while the next part is received
+  uint8_t buffer[UPDATE_BUFFER_SIZE];
+  int read_size;
+  while((read_size = request.read(buffer, sizeof(buffer))) > 0 && _ota.write(buffer, read_size)) {
   }
-  if(_server.hasArg(FORM_NAME_LOC_HOME_LON)) {
-    _config.set_home_longitude(clamp<double>(_server.arg(FORM_NAME_LOC_HOME_LON).toDouble(), -180.0, 180.0), false);
+
+  result = _ota.end();
+#if ENABLE_DEBUG
+  _ota.print_metrics(DEBUG_STREAM);
+#endif
+  if(result == OtaUpdater::e_ota_ok) {
+    DEBUG_PRINTLN("Update Success");
+    response.send(200, "text/plain", "OK");
+  } else {
+    DEBUG_PRINTF("Update Failed: %s\n", OtaUpdater::result_name(result));
+    response.send(500, "text/plain", OtaUpdater::result_name(result));
   }
+}
 
-  _server.sendHeader("Location", _server.arg("next") + "?success=true");
-  _server.send(302, "text/html");
-  _server.client().flush();
+const ResponseMetrics& ConfigWebServer::get_response_metrics() const {
+  return _metrics;
 }
 
-void ConfigWebServer::handle_update_uploading() {
-  HTTPUpload& upload = _server.upload();
-  switch(upload.status) {
-    case UPLOAD_FILE_START: {
-      DEBUG_PRINTF("Update: %s\n", upload.filename.c_str());
-      if(Update.begin(UPDATE_SIZE_UNKNOWN)) {
-        DEBUG_PRINTLN("Starting update");
-      } else {
-        DEBUG_PRINTLN("Unable to start update");
-      }
-      break;
-    }
-    case UPLOAD_FILE_WRITE: {
-      DEBUG_PRINTF(".");
-      auto write_size = Update.write(upload.buf, upload.currentSize);
-      if(write_size != upload.currentSize) {
-        DEBUG_PRINTF("Something failed while uploading (wrote %d out of %d)\n", write_size, upload.currentSize);
-        Update.abort();
-      }
-      break;
-    }
-    case UPLOAD_FILE_END: {
-      if(upload.totalSize > 0 && Update.end(true)) { //true to set the size to the current progress
-        DEBUG_PRINTF("\nUpdate Success: %u\n", upload.totalSize);
-      } else {
-        DEBUG_PRINTF("Update Failed...");
-      }
-      break;
-    }
-    case UPLOAD_FILE_ABORTED: {
-      Update.abort();
-      DEBUG_PRINTF("Update aborted...");
-      break;
-    }
+void ConfigWebServer::publish_readings() {
+  Reading* reading;
+  while((reading = _readings.peek())) {
+    _events.begin_event("reading");
+    JsonWriter json(_events);
+    json.begin_object();
+    DeviceStatus::write_reading(json, *reading);
+    json.end_object();
+    _events.end_event();
+    _readings.release();
   }
 }
 
 void ConfigWebServer::handle_report(const Report& report) {
+  _status.update(report);
+
+  // Pass fresh readings to the server task for the event stream
+  auto reader = report.get_worker_stats().find(k_worker_bgeigie_connector);
+  if(_events.get_client_count() > 0 && reader != report.get_worker_stats().end() && reader->second.is_fresh()) {
+    _readings.push(reader->second.get<Reading>());
+  }
 }
@@ -1,14 +1,24 @@
 #ifndef BGEIGIECAST_SERVER_H
 #define BGEIGIECAST_SERVER_H
 
+#include <mutex>
 #include <WiFi.h>
-#include <WebServer.h>
 
 #include <Worker.hpp>
 #include <Supervisor.hpp>
 
 #include "local_storage.h"
+#include "user_config.h"
 #include "wifi_connection.h"
+#include "sm_trace.h"
+#include "chunked_response.h"
+#include "web_assets.h"
+#include "device_status.h"
+#include "api_connector.h"
+#include "event_stream.h"
+#include "http_server.h"
+#include "ota_updater.h"
+#include "LockFreeQueue.hpp"
 
 enum ServerStatus {
   k_server_status_offline,
@@ -18,15 +28,23 @@ enum ServerStatus {
 
 /**
  * Class to host a web server for configuring the ESP32. Will set up an access
- * point based on user_config.h "Access point settings".
+ * point based on user_config.h "Access point settings". Requests are handled
+ * concurrently by the tasks of the http server, not by `produce_data`.
  */
 class ConfigWebServer : public Worker<ServerStatus>, public Supervisor {
  public:
-  explicit ConfigWebServer(LocalStorage& config);
+  /**
+   * @param config: settings to show and edit
+   * @param trace: state machine trace to export on `/trace`, nullptr to disable the endpoint
+   * @param api_reporter: to report the upload backlog on `/api/status`, must run in the same execution group
+   */
+  explicit ConfigWebServer(LocalStorage& config,
+                           const StateTrace* trace = nullptr,
+                           const ApiReporter* api_reporter = nullptr);
   virtual ~ConfigWebServer() = default;
 
   /**
-   * Checks if there are requests and handles them
+   * Sends the pending readings to the event stream clients
    */
   int8_t produce_data();
 
@@ -35,8 +53,16 @@ class ConfigWebServer : public Worker<ServerStatus>, public Supervisor {
    */
   void add_urls();
 
+  /**
+   * Keeps a copy of the report for `/api/status`, called by the aggregator task
+   */
   void handle_report(const Report& report) override;
 
+  /**
+   * Get the timing of the rendered pages
+   */
+  const ResponseMetrics& get_response_metrics() const;
+
  protected:
   /**
    * Initialize the web server, does nothing if it is already initialized.
@@ -55,15 +81,44 @@ class ConfigWebServer : public Worker<ServerStatus>, public Supervisor {
   /**
    * Handles request for `/save`
    */
-  void handle_save();
+  void handle_save(HttpRequest& request, HttpResponse& response);
+
+  /**
+   * Handles request for `/update` post, the body is the new firmware. Verified if the request has the SHA-256 digest
+   * of the image in the OTA_DIGEST_HEADER header.
+   */
+  void handle_update(HttpRequest& request, HttpResponse& response);
+
+  /**
+   * Handles request for a static resource, answers 304 if the browser already has this version
+   */
+  void handle_asset(const WebAsset& asset, HttpRequest& request, HttpResponse& response);
+
+  /**
+   * Handles request for `/api/status`, sends the live device status as json
+   */
+  void handle_api_status(HttpResponse& response);
+
+  /**
+   * Send the readings passed by `handle_report` to the event stream clients
+   */
+  void publish_readings();
 
   /**
-   * Handles request for `/update` post
+   * Handles request for `/trace`, sends the binary state machine trace
    */
-  void handle_update_uploading();
+  void handle_trace(HttpResponse& response);
 
-  WebServer _server;
+  HttpServer _server;
   LocalStorage& _config;
+  const StateTrace* _trace;
+  const ApiReporter* _api_reporter;
+  DeviceStatus _status;
+  EventStream _events;
+  LockFreeQueue<Reading, EVENT_STREAM_READING_QUEUE_SIZE> _readings;
+  ResponseMetrics _metrics;
+  std::mutex _update_lock;
+  OtaUpdater _ota;
 };
 
 #endif //BGEIGIECAST_SERVER_H
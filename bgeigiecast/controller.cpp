@@ -2,7 +2,6 @@
 #include "controller.h"
 #include "identifiers.h"
 
-#define BUTTON_LONG_PRESSED_MILLIS_TRESHOLD 4000
 
 Controller::Controller(LocalStorage& config) :
     ButtonObserver(),
@@ -12,11 +11,33 @@ Controller::Controller(LocalStorage& config) :
     Worker<bool>(k_worker_controller_state_changer, false, 0),
     _config(config),
     _mode_button(MODE_BUTTON_PIN),
-    _state_changed(false) {
+    _state_changed(false),
+    _last_button_press(0),
+    _initialize_state(*this),
+    _init_reading_state(*this),
+    _post_initialize_state(*this),
+    _configuration_mode_state(*this),
+    _mobile_mode_state(*this),
+    _fixed_mode_state(*this),
+    _reset_state(*this),
+    _state_table{
+        &_initialize_state,
+        &_init_reading_state,
+        &_post_initialize_state,
+        &_configuration_mode_state,
+        &_mobile_mode_state,
+        &_fixed_mode_state,
+        &_reset_state,
+    } {
+}
+
+Controller::~Controller() {
+  // Exit the current state while the states still exist
+  Context::set_state(nullptr);
 }
 
 void Controller::setup_state_machine() {
-  set_state(new InitializeState(*this));
+  set_state(ControllerState::k_state_InitializeState);
 }
 
 void Controller::run() {
@@ -36,18 +57,38 @@ void Controller::initialize() {
   schedule_event(Event_enum::e_c_controller_initialized);
 }
 
-void Controller::on_button_pressed(Button* button, uint32_t millis_pressed) {
+void Controller::on_button_gesture(Button* button, ButtonGesture gesture) {
   if(button->get_pin() == MODE_BUTTON_PIN) {
-    if(millis_pressed > BUTTON_LONG_PRESSED_MILLIS_TRESHOLD) {
-      DEBUG_PRINTLN("Button long pressed");
-      schedule_event(Event_enum::e_c_button_long_pressed);
-    } else {
-      DEBUG_PRINTLN("Button pressed");
-      schedule_event(Event_enum::e_c_button_pressed);
+    switch(gesture) {
+      case e_gesture_single:
+        _last_button_press = button->get_last_state_change(); // Release time
+        DEBUG_PRINTLN("Button pressed");
+        schedule_event(Event_enum::e_c_button_pressed);
+        break;
+      case e_gesture_double:
+        _last_button_press = button->get_last_state_change(); // Second press
+        DEBUG_PRINTLN("Button double pressed");
+        // No state has its own action for it, handled as the two presses it was before gestures
+        schedule_event(Event_enum::e_c_button_pressed);
+        schedule_event(Event_enum::e_c_button_pressed);
+        break;
+      case e_gesture_long_hold:
+        _last_button_press = millis(); // Still held down
+        DEBUG_PRINTLN("Button long pressed");
+        schedule_event(Event_enum::e_c_button_long_pressed);
+        break;
     }
   }
 }
 
+uint32_t Controller::get_last_button_press() const {
+  return _last_button_press;
+}
+
+const ButtonMetrics& Controller::get_button_metrics() const {
+  return _mode_button.get_metrics();
+}
+
 void Controller::reset_system() {
   _config.reset_defaults();
   DEBUG_PRINTLN("\n RESTARTING ESP...\n");
@@ -77,6 +118,10 @@ void Controller::set_state(State* state) {
   _state_changed = true;
 }
 
+void Controller::set_state(ControllerState::StateId state_id) {
+  set_state(_state_table[state_id]);
+}
+
 int8_t Controller::produce_data() {
   if(_state_changed) {
     _state_changed = false;
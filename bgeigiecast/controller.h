@@ -6,6 +6,7 @@
 
 #include "button.h"
 #include "sm_context.h"
+#include "sm_c_concete_states.h"
 #include "local_storage.h"
 
 /**
@@ -20,7 +21,7 @@ class Controller : private ButtonObserver, public Context, public Aggregator, pr
   } SavableState;
 
   Controller(LocalStorage& config);
-  virtual ~Controller() = default;
+  virtual ~Controller();
 
   /**
    * Set initial state for the state machine,
@@ -35,7 +36,18 @@ class Controller : private ButtonObserver, public Context, public Aggregator, pr
   /**
    * Callback for the button
    */
-  void on_button_pressed(Button* button, uint32_t millis) override;
+  void on_button_gesture(Button* button, ButtonGesture gesture) override;
+
+  /**
+   * Get the moment of the last gesture of the mode button (release, second press or while held down)
+   * @return millis, 0 if never pressed
+   */
+  uint32_t get_last_button_press() const;
+
+  /**
+   * Get the interrupt and latency statistics of the mode button
+   */
+  const ButtonMetrics& get_button_metrics() const;
 
   /**
    * override set state from context, to flag worker that change has been made
@@ -43,6 +55,12 @@ class Controller : private ButtonObserver, public Context, public Aggregator, pr
    */
   void set_state(State* state) override;
 
+  /**
+   * Enter one of the controller states, states are preallocated so this does not allocate
+   * @param state_id
+   */
+  void set_state(ControllerState::StateId state_id);
+
  protected:
   int8_t handle_produced_work(const worker_status_t& worker_reports) override;
  private:
@@ -73,6 +91,17 @@ class Controller : private ButtonObserver, public Context, public Aggregator, pr
   LocalStorage& _config;
   Button _mode_button;
   bool _state_changed;
+  uint32_t _last_button_press;
+
+  // All states of the state machine, live as long as the controller
+  InitializeState _initialize_state;
+  InitReadingState _init_reading_state;
+  PostInitializeState _post_initialize_state;
+  ConfigurationModeState _configuration_mode_state;
+  MobileModeState _mobile_mode_state;
+  FixedModeState _fixed_mode_state;
+  ResetState _reset_state;
+  State* const _state_table[ControllerState::k_state_count];
 
   friend class InitializeState;
   friend class PostInitializeState;
@@ -0,0 +1,160 @@
+#include <string.h>
+
+#include "delta_patch.h"
+
+#define DELTA_OPERATION_COPY 'C'
+#define DELTA_OPERATION_INSERT 'I'
+#define DELTA_OPERATION_END 'E'
+
+DeltaPatcher::DeltaPatcher(const SourceReader& source, const Sink& target) :
+    _source(source),
+    _target(target),
+    _state(e_state_header),
+    _arguments(),
+    _argument_size(DELTA_HEADER_SIZE),
+    _argument_length(0),
+    _source_size(0),
+    _target_size(0),
+    _written(0),
+    _insert_remaining(0) {
+}
+
+bool DeltaPatcher::write(const uint8_t* data, size_t size) {
+  while(size > 0) {
+    switch(_state) {
+      case e_state_header:
+      case e_state_copy_arguments:
+      case e_state_insert_length:
+        if(collect(data, size) && !handle_arguments()) {
+          _state = e_state_failed;
+        }
+        break;
+      case e_state_operation: {
+        uint8_t operation = *data++;
+        --size;
+        switch(operation) {
+          case DELTA_OPERATION_COPY:
+            expect(e_state_copy_arguments, 8);
+            break;
+          case DELTA_OPERATION_INSERT:
+            expect(e_state_insert_length, 4);
+            break;
+          case DELTA_OPERATION_END:
+            _state = _written == _target_size ? e_state_done : e_state_failed;
+            break;
+          default:
+            _state = e_state_failed;
+            break;
+        }
+        break;
+      }
+      case e_state_insert_data: {
+        size_t part = size < _insert_remaining ? size : _insert_remaining;
+        if(!emit(data, part)) {
+          _state = e_state_failed;
+          break;
+        }
+        data += part;
+        size -= part;
+        _insert_remaining -= part;
+        if(_insert_remaining == 0) {
+          _state = e_state_operation;
+        }
+        break;
+      }
+      case e_state_done: // Nothing may follow the end
+      case e_state_failed:
+        _state = e_state_failed;
+        return false;
+    }
+  }
+  return _state != e_state_failed;
+}
+
+bool DeltaPatcher::is_complete() const {
+  return _state == e_state_done;
+}
+
+bool DeltaPatcher::has_failed() const {
+  return _state == e_state_failed;
+}
+
+uint32_t DeltaPatcher::get_source_size() const {
+  return _source_size;
+}
+
+uint32_t DeltaPatcher::get_target_size() const {
+  return _target_size;
+}
+
+uint32_t DeltaPatcher::get_written() const {
+  return _written;
+}
+
+bool DeltaPatcher::collect(const uint8_t*& data, size_t& size) {
+  size_t part = _argument_size - _argument_length;
+  if(part > size) {
+    part = size;
+  }
+  memcpy(_arguments + _argument_length, data, part);
+  _argument_length += part;
+  data += part;
+  size -= part;
+  return _argument_length == _argument_size;
+}
+
+bool DeltaPatcher::handle_arguments() {
+  switch(_state) {
+    case e_state_header:
+      if(memcmp(_arguments, DELTA_MAGIC, 4) != 0 || _arguments[4] != DELTA_VERSION) {
+        return false;
+      }
+      _source_size = read_u32(_arguments + 8);
+      _target_size = read_u32(_arguments + 12);
+      _state = e_state_operation;
+      return true;
+    case e_state_copy_arguments:
+      _state = e_state_operation;
+      return copy(read_u32(_arguments), read_u32(_arguments + 4));
+    case e_state_insert_length:
+      _insert_remaining = read_u32(_arguments);
+      _state = _insert_remaining > 0 ? e_state_insert_data : e_state_operation;
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool DeltaPatcher::copy(uint32_t offset, uint32_t length) {
+  if(offset > _source_size || length > _source_size - offset) {
+    return false;
+  }
+  uint8_t buffer[DELTA_COPY_BUFFER_SIZE];
+  while(length > 0) {
+    size_t part = length < sizeof(buffer) ? length : sizeof(buffer);
+    if(!_source(offset, buffer, part) || !emit(buffer, part)) {
+      return false;
+    }
+    offset += part;
+    length -= part;
+  }
+  return true;
+}
+
+bool DeltaPatcher::emit(const uint8_t* data, size_t size) {
+  if(size > _target_size - _written || !_target(data, size)) {
+    return false;
+  }
+  _written += size;
+  return true;
+}
+
+void DeltaPatcher::expect(State state, uint8_t argument_size) {
+  _state = state;
+  _argument_size = argument_size;
+  _argument_length = 0;
+}
+
+uint32_t DeltaPatcher::read_u32(const uint8_t* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
@@ -0,0 +1,99 @@
+#ifndef BGEIGIECAST_DELTA_PATCH_H
+#define BGEIGIECAST_DELTA_PATCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+#ifndef DELTA_COPY_BUFFER_SIZE
+#define DELTA_COPY_BUFFER_SIZE 512
+#endif
+
+#define DELTA_MAGIC "BGCD"
+#define DELTA_VERSION 1
+#define DELTA_HEADER_SIZE 16
+
+/**
+ * Applies a binary delta patch (created with tools/ota_publish.py) to a source image while the patch is streamed in.
+ *
+ * Format, all values little endian:
+ * - header: "BGCD", version (1 byte), 3 reserved bytes, source size (4 bytes), target size (4 bytes)
+ * - operations until the end:
+ *   - 'C' offset (4 bytes) length (4 bytes): copy from the source
+ *   - 'I' length (4 bytes) data: insert the data
+ *   - 'E': end of the patch
+ */
+class DeltaPatcher {
+ public:
+  /**
+   * Reads from the source image (the running firmware)
+   * @return false if reading failed
+   */
+  typedef std::function<bool(uint32_t offset, uint8_t* buffer, size_t size)> SourceReader;
+
+  /**
+   * Receives the target image in order
+   * @return false to stop patching
+   */
+  typedef std::function<bool(const uint8_t* data, size_t size)> Sink;
+
+  DeltaPatcher(const SourceReader& source, const Sink& target);
+  virtual ~DeltaPatcher() = default;
+
+  /**
+   * Apply the next part of the patch
+   * @return false if the patch is invalid or the source / target failed, the rest of the patch is ignored
+   */
+  bool write(const uint8_t* data, size_t size);
+
+  /**
+   * @return true if the end of the patch was reached and the complete target was written
+   */
+  bool is_complete() const;
+
+  bool has_failed() const;
+
+  uint32_t get_source_size() const;
+  uint32_t get_target_size() const;
+
+  /**
+   * Get the amount of target bytes written
+   */
+  uint32_t get_written() const;
+
+ private:
+  typedef enum State {
+    e_state_header,
+    e_state_operation,
+    e_state_copy_arguments,
+    e_state_insert_length,
+    e_state_insert_data,
+    e_state_done,
+    e_state_failed,
+  } State;
+
+  /**
+   * Collect bytes into the argument buffer
+   * @return true when `_argument_size` bytes are available
+   */
+  bool collect(const uint8_t*& data, size_t& size);
+  bool handle_arguments();
+  bool copy(uint32_t offset, uint32_t length);
+  bool emit(const uint8_t* data, size_t size);
+  void expect(State state, uint8_t argument_size);
+
+  static uint32_t read_u32(const uint8_t* data);
+
+  SourceReader _source;
+  Sink _target;
+  State _state;
+  uint8_t _arguments[DELTA_HEADER_SIZE];
+  uint8_t _argument_size;
+  uint8_t _argument_length;
+  uint32_t _source_size;
+  uint32_t _target_size;
+  uint32_t _written;
+  uint32_t _insert_remaining;
+};
+
+#endif //BGEIGIECAST_DELTA_PATCH_H
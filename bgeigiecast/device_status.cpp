@@ -0,0 +1,132 @@
+#include "device_status.h"
+#include "identifiers.h"
+
+// Names by id, see identifiers.h
+const char* const worker_names[] = {
+    "bgeigie_connector",
+    "configuration_server",
+    "wifi_access_point",
+    "controller_state_changer",
+    "bluetooth_transfer",
+};
+static_assert(sizeof(worker_names) / sizeof(worker_names[0]) == k_worker_count, "Name every worker");
+
+const char* const handler_names[] = {
+    "controller",
+    "storage",
+    "bluetooth_reporter",
+    "api_reporter",
+    "ota_puller",
+};
+static_assert(sizeof(handler_names) / sizeof(handler_names[0]) == k_handler_count, "Name every handler");
+
+const char* const state_names[] = {
+    "inactive",
+    "activating_failed",
+    "active",
+};
+
+template<size_t N>
+const char* name_of(const char* const (& names)[N], uint8_t id) {
+  return id < N ? names[id] : nullptr;
+}
+
+DeviceStatus::DeviceStatus() : _snapshot() {
+}
+
+void DeviceStatus::update(const Report& report) {
+  Snapshot update{};
+  update.updated_at = millis();
+  for(const auto& w : report.get_worker_stats()) {
+    if(update.worker_count == DEVICE_STATUS_MAX_MEMBERS) {
+      break;
+    }
+    update.workers[update.worker_count++] = {w.first, w.second.active_state, w.second.status, 0, 0};
+  }
+  for(const auto& h : report.get_handler_stats()) {
+    if(update.handler_count == DEVICE_STATUS_MAX_MEMBERS) {
+      break;
+    }
+    update.handlers[update.handler_count++] = {
+        h.first, h.second.active_state, h.second.status, h.second.deadline_misses, h.second.deferred
+    };
+  }
+
+  const auto& worker_stats = report.get_worker_stats();
+  auto reader = worker_stats.find(k_worker_bgeigie_connector);
+  bool fresh_reading = reader != worker_stats.end() && reader->second.is_fresh();
+
+  portENTER_CRITICAL(&_lock);
+  update.has_reading = _snapshot.has_reading;
+  update.reading_at = _snapshot.reading_at;
+  if(fresh_reading) {
+    update.has_reading = true;
+    update.reading_at = update.updated_at;
+    update.last_reading = reader->second.get<Reading>();
+  } else {
+    update.last_reading = _snapshot.last_reading;
+  }
+  _snapshot = update;
+  portEXIT_CRITICAL(&_lock);
+}
+
+void DeviceStatus::write_json(JsonWriter& json) const {
+  // Copy first, the output can be slow (network)
+  portENTER_CRITICAL(&_lock);
+  Snapshot snapshot = _snapshot;
+  portEXIT_CRITICAL(&_lock);
+
+  uint32_t now = millis();
+  json.add("report_age", now - snapshot.updated_at);
+
+  json.begin_array("workers");
+  for(uint8_t i = 0; i < snapshot.worker_count; ++i) {
+    const auto& worker = snapshot.workers[i];
+    write_member(json, worker, name_of(worker_names, worker.id), false);
+  }
+  json.end_array();
+
+  json.begin_array("handlers");
+  for(uint8_t i = 0; i < snapshot.handler_count; ++i) {
+    const auto& handler = snapshot.handlers[i];
+    write_member(json, handler, name_of(handler_names, handler.id), true);
+  }
+  json.end_array();
+
+  if(!snapshot.has_reading) {
+    json.add_null("reading");
+    return;
+  }
+  json.begin_object("reading");
+  json.add("age", now - snapshot.reading_at);
+  write_reading(json, snapshot.last_reading);
+  json.end_object();
+}
+
+void DeviceStatus::write_reading(JsonWriter& json, const Reading& reading) {
+  json.add("valid", reading.valid_reading());
+  json.add("status", reading.get_status());
+  json.add("device_id", reading.get_device_id());
+  json.add("time", reading.get_iso_timestr());
+  json.add("cpm", reading.get_cpm());
+  json.add("cpb", reading.get_cpb());
+  json.add("total_count", reading.get_total_count());
+  json.add("latitude", reading.get_latitude(), 5);
+  json.add("longitude", reading.get_longitude(), 5);
+  json.add("altitude", reading.get_altitude(), 1);
+  json.add("sat_count", reading.get_sat_count());
+  json.add("precision", reading.get_precision(), 1);
+}
+
+void DeviceStatus::write_member(JsonWriter& json, const MemberStatus& member, const char* name, bool is_handler) {
+  json.begin_object();
+  json.add("id", member.id);
+  json.add("name", name);
+  json.add("state", state_names[member.active_state]);
+  json.add("status", member.status);
+  if(is_handler) {
+    json.add("deadline_misses", member.deadline_misses);
+    json.add("deferred", member.deferred);
+  }
+  json.end_object();
+}
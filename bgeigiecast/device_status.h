@@ -0,0 +1,68 @@
+#ifndef BGEIGIECAST_DEVICE_STATUS_H
+#define BGEIGIECAST_DEVICE_STATUS_H
+
+#include <Arduino.h>
+#include <Report.hpp>
+
+#include "reading.h"
+#include "json_writer.h"
+
+#ifndef DEVICE_STATUS_MAX_MEMBERS
+#define DEVICE_STATUS_MAX_MEMBERS 8
+#endif
+
+/**
+ * Copy of the latest report (states of all workers and handlers) and the last reading. Updated by the aggregator task,
+ * can be serialized from any other task.
+ */
+class DeviceStatus {
+ public:
+  struct MemberStatus {
+    uint8_t id;
+    _Status::State active_state;
+    int8_t status;
+    uint32_t deadline_misses;
+    uint32_t deferred;
+  };
+
+  DeviceStatus();
+  virtual ~DeviceStatus() = default;
+
+  /**
+   * Take over the states from the report, and the reading if the bGeigie connector has a fresh one
+   * @param report
+   */
+  void update(const Report& report);
+
+  /**
+   * Write the workers, handlers and last reading as members of the current json object
+   * @param json
+   */
+  void write_json(JsonWriter& json) const;
+
+  /**
+   * Write the values of a reading as members of the current json object
+   * @param json
+   * @param reading
+   */
+  static void write_reading(JsonWriter& json, const Reading& reading);
+
+ private:
+  struct Snapshot {
+    uint32_t updated_at;
+    uint8_t worker_count;
+    uint8_t handler_count;
+    MemberStatus workers[DEVICE_STATUS_MAX_MEMBERS];
+    MemberStatus handlers[DEVICE_STATUS_MAX_MEMBERS];
+    bool has_reading;
+    uint32_t reading_at;
+    Reading last_reading;
+  };
+
+  static void write_member(JsonWriter& json, const MemberStatus& member, const char* name, bool is_handler);
+
+  Snapshot _snapshot;
+  mutable portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif //BGEIGIECAST_DEVICE_STATUS_H
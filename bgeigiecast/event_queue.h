@@ -0,0 +1,110 @@
+#ifndef BGEIGIECAST_EVENT_QUEUE_H
+#define BGEIGIECAST_EVENT_QUEUE_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Bounded lock-free queue for many producers (tasks and interrupts) and a single consumer. Every item gets the time
+ * it was added. When the queue is full the new item is dropped and counted, items in the queue are never overwritten.
+ * @tparam T: Type of the items
+ * @tparam max: max items in the queue, must be a power of 2
+ */
+template<typename T, uint16_t max>
+class EventQueue {
+  static_assert(max > 0 && (max & (max - 1)) == 0, "EventQueue size must be a power of 2");
+
+ public:
+  EventQueue() : cells(), enqueue_pos(0), dequeue_pos(0), overflows(0) {
+    for(uint16_t i = 0; i < max; ++i) {
+      cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  };
+  virtual ~EventQueue() = default;
+
+  /**
+   * Producer: add an item to the queue, safe to call from an interrupt
+   * @param val
+   * @param timestamp: time the item was captured
+   * @return: false if the queue is full (item is dropped)
+   */
+  bool add(T val, uint32_t timestamp) {
+    uint32_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    Cell* cell;
+    for(;;) {
+      cell = &cells[pos % max];
+      auto diff = static_cast<int32_t>(cell->sequence.load(std::memory_order_acquire) - pos);
+      if(diff == 0) {
+        if(enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if(diff < 0) {
+        overflows.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    cell->value = val;
+    cell->timestamp = timestamp;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Consumer: get the oldest item from the queue
+   * @param out: the item
+   * @param timestamp: time the item was captured
+   * @return: false if the queue is empty
+   */
+  bool get(T& out, uint32_t& timestamp) {
+    Cell* cell = &cells[dequeue_pos % max];
+    if(static_cast<int32_t>(cell->sequence.load(std::memory_order_acquire) - (dequeue_pos + 1)) < 0) {
+      return false;
+    }
+    out = cell->value;
+    timestamp = cell->timestamp;
+    cell->sequence.store(dequeue_pos + max, std::memory_order_release);
+    ++dequeue_pos;
+    return true;
+  }
+
+  /**
+   * Consumer: check if the queue is empty
+   * @return: true if empty
+   */
+  bool empty() const {
+    const Cell& cell = cells[dequeue_pos % max];
+    return static_cast<int32_t>(cell.sequence.load(std::memory_order_acquire) - (dequeue_pos + 1)) < 0;
+  }
+
+  /**
+   * Consumer: remove all items from the queue
+   */
+  void clear() {
+    T val;
+    uint32_t timestamp;
+    while(get(val, timestamp)) {}
+  }
+
+  /**
+   * Get the amount of items that were dropped because the queue was full
+   */
+  uint32_t get_overflows() const {
+    return overflows.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Cell {
+    std::atomic<uint32_t> sequence;
+    T value;
+    uint32_t timestamp;
+  };
+
+  Cell cells[max];
+  std::atomic<uint32_t> enqueue_pos;
+  uint32_t dequeue_pos;
+  std::atomic<uint32_t> overflows;
+};
+
+#endif //BGEIGIECAST_EVENT_QUEUE_H
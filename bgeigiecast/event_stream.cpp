@@ -0,0 +1,152 @@
+#include <unistd.h>
+#include <lwip/sockets.h>
+#include "event_stream.h"
+#include "debugger.h"
+
+// Reconnect time for the browser
+const char* event_stream_start = "retry: 5000\n\n";
+
+// Comment line, keeps proxies and the browser from closing an idle stream
+const char* event_stream_keep_alive = ":\n\n";
+
+EventStream::EventStream() :
+    _clients_lock(),
+    _clients(),
+    _client_count(0),
+    _dropped_clients(0),
+    _message(),
+    _message_length(0),
+    _message_overflow(false) {
+}
+
+bool EventStream::add_client(int socket) {
+  std::lock_guard<std::mutex> lock(_clients_lock);
+  for(auto& c : _clients) {
+    if(c.connected) {
+      continue;
+    }
+    c.socket = socket;
+    c.connected = true;
+    c.length = 0;
+    c.last_send = millis();
+    enqueue(c, event_stream_start, strlen(event_stream_start));
+    ++_client_count;
+    DEBUG_PRINTF("Event stream: client connected (%d)\n", _client_count.load());
+    return true;
+  }
+  close(socket);
+  return false;
+}
+
+void EventStream::begin_event(const char* event) {
+  _message_length = 0;
+  _message_overflow = false;
+  print("event: ");
+  print(event);
+  print("\ndata: ");
+}
+
+void EventStream::end_event() {
+  print("\n\n");
+  if(_message_overflow) {
+    DEBUG_PRINTLN("Event stream: event too large, not sent");
+    return;
+  }
+  std::lock_guard<std::mutex> lock(_clients_lock);
+  for(auto& c : _clients) {
+    if(c.connected && !enqueue(c, _message, _message_length)) {
+      // Client can't keep up
+      ++_dropped_clients;
+      drop(c);
+    }
+  }
+}
+
+size_t EventStream::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t EventStream::write(const uint8_t* buffer, size_t size) {
+  if(_message_length + size > sizeof(_message)) {
+    _message_overflow = true;
+    return 0;
+  }
+  memcpy(&_message[_message_length], buffer, size);
+  _message_length += size;
+  return size;
+}
+
+void EventStream::loop() {
+  if(_client_count == 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(_clients_lock);
+  for(auto& c : _clients) {
+    if(!c.connected) {
+      continue;
+    }
+    if(c.length == 0 && millis() - c.last_send > EVENT_STREAM_KEEP_ALIVE_MILLIS) {
+      enqueue(c, event_stream_keep_alive, strlen(event_stream_keep_alive));
+    }
+    if(!flush(c) || is_closed(c)) {
+      drop(c);
+    }
+  }
+}
+
+void EventStream::close_all() {
+  std::lock_guard<std::mutex> lock(_clients_lock);
+  for(auto& c : _clients) {
+    if(c.connected) {
+      drop(c);
+    }
+  }
+}
+
+uint8_t EventStream::get_client_count() const {
+  return _client_count;
+}
+
+uint32_t EventStream::get_dropped_clients() const {
+  return _dropped_clients;
+}
+
+bool EventStream::enqueue(EventStream::Client& client, const char* data, size_t size) {
+  if(client.length + size > sizeof(client.buffer)) {
+    return false;
+  }
+  memcpy(&client.buffer[client.length], data, size);
+  client.length += size;
+  return true;
+}
+
+bool EventStream::flush(EventStream::Client& client) {
+  if(client.length == 0) {
+    return true;
+  }
+  auto sent = send(client.socket, client.buffer, client.length, MSG_DONTWAIT);
+  if(sent < 0) {
+    // Socket buffer full, try again next cycle
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+  }
+  client.length -= sent;
+  memmove(client.buffer, &client.buffer[sent], client.length);
+  client.last_send = millis();
+  return true;
+}
+
+bool EventStream::is_closed(const EventStream::Client& client) {
+  // Clients never send anything, a readable socket means it was closed
+  char c;
+  auto received = recv(client.socket, &c, 1, MSG_DONTWAIT | MSG_PEEK);
+  return received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK);
+}
+
+void EventStream::drop(EventStream::Client& client) {
+  close(client.socket);
+  client.socket = -1;
+  client.connected = false;
+  client.length = 0;
+  --_client_count;
+  DEBUG_PRINTF("Event stream: client disconnected (%d)\n", _client_count.load());
+}
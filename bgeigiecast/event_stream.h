@@ -0,0 +1,120 @@
+#ifndef BGEIGIECAST_EVENT_STREAM_H
+#define BGEIGIECAST_EVENT_STREAM_H
+
+#include <atomic>
+#include <mutex>
+#include <Arduino.h>
+
+#include "user_config.h"
+
+#ifndef EVENT_STREAM_MAX_CLIENTS
+#define EVENT_STREAM_MAX_CLIENTS 4
+#endif
+
+#ifndef EVENT_STREAM_CLIENT_BUFFER_SIZE
+#define EVENT_STREAM_CLIENT_BUFFER_SIZE 1024
+#endif
+
+#ifndef EVENT_STREAM_MESSAGE_SIZE
+#define EVENT_STREAM_MESSAGE_SIZE 384
+#endif
+
+#ifndef EVENT_STREAM_KEEP_ALIVE_MILLIS
+#define EVENT_STREAM_KEEP_ALIVE_MILLIS 15000
+#endif
+
+/**
+ * Server-sent events (text/event-stream) to a few clients that keep their connection open. Every client has its own
+ * send buffer which is flushed without blocking, a client that does not keep up (buffer full) is dropped. Clients can
+ * be added from any task, events must be published from a single task.
+ *
+ * Publishing an event:
+ *   stream.begin_event("reading");
+ *   stream.print(...); // data, single line
+ *   stream.end_event();
+ */
+class EventStream : public Print {
+ public:
+  EventStream();
+  virtual ~EventStream() = default;
+
+  /**
+   * Take over the connection of a request, the response headers must already be sent
+   * @param socket: detached connection of the request, closed if the max amount of clients is reached
+   * @return false if the max amount of clients is reached
+   */
+  bool add_client(int socket);
+
+  /**
+   * Start a new event, the data is written with the print functions
+   * @param event: event name
+   */
+  void begin_event(const char* event);
+
+  /**
+   * Queue the event for all clients
+   */
+  void end_event();
+
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+  /**
+   * Send the buffered data to the clients and remove disconnected clients, call every cycle
+   */
+  void loop();
+
+  /**
+   * Disconnect all clients
+   */
+  void close_all();
+
+  /**
+   * Get the amount of connected clients, can be called from any task
+   */
+  uint8_t get_client_count() const;
+
+  /**
+   * Get the amount of clients that were dropped because they did not keep up
+   */
+  uint32_t get_dropped_clients() const;
+
+ private:
+  struct Client {
+    int socket;
+    bool connected;
+    uint16_t length;
+    uint32_t last_send;
+    char buffer[EVENT_STREAM_CLIENT_BUFFER_SIZE];
+  };
+
+  /**
+   * Add data to the buffer of a client
+   * @return false if it does not fit
+   */
+  static bool enqueue(Client& client, const char* data, size_t size);
+
+  /**
+   * Send as much of the buffer as the connection accepts without blocking
+   * @return false if the connection failed
+   */
+  static bool flush(Client& client);
+
+  /**
+   * Check if the client closed the connection
+   */
+  static bool is_closed(const Client& client);
+
+  void drop(Client& client);
+
+  std::mutex _clients_lock;
+  Client _clients[EVENT_STREAM_MAX_CLIENTS];
+  std::atomic<uint8_t> _client_count;
+  uint32_t _dropped_clients;
+
+  char _message[EVENT_STREAM_MESSAGE_SIZE];
+  size_t _message_length;
+  bool _message_overflow;
+};
+
+#endif //BGEIGIECAST_EVENT_STREAM_H
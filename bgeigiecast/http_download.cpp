@@ -0,0 +1,251 @@
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#ifdef ESP_PLATFORM
+#include <lwip/sockets.h>
+#include <lwip/netdb.h>
+#else
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netdb.h>
+#endif
+
+#include "http_download.h"
+
+namespace {
+
+void set_timeout(int socket, int option, uint32_t millis) {
+  timeval timeout{};
+  timeout.tv_sec = millis / 1000;
+  timeout.tv_usec = (millis % 1000) * 1000;
+  setsockopt(socket, SOL_SOCKET, option, &timeout, sizeof(timeout));
+}
+
+bool send_all(int socket, const char* data, size_t size) {
+  while(size > 0) {
+    auto sent = send(socket, data, size, 0);
+    if(sent <= 0) {
+      return false;
+    }
+    data += sent;
+    size -= sent;
+  }
+  return true;
+}
+
+bool copy_string(char* destination, size_t destination_size, const char* source, size_t length) {
+  if(length >= destination_size) {
+    return false;
+  }
+  memcpy(destination, source, length);
+  destination[length] = '\0';
+  return true;
+}
+
+}
+
+bool HttpUrl::parse(const char* url, HttpUrl& out) {
+  const char* scheme = "http://";
+  if(!url || strncasecmp(url, scheme, strlen(scheme)) != 0) {
+    return false;
+  }
+  const char* host = url + strlen(scheme);
+  size_t host_length = strcspn(host, ":/");
+  if(host_length == 0 || !copy_string(out.host, sizeof(out.host), host, host_length)) {
+    return false;
+  }
+  const char* rest = host + host_length;
+  out.port = 80;
+  if(*rest == ':') {
+    char* end = nullptr;
+    long port = strtol(rest + 1, &end, 10);
+    if(end == rest + 1 || port <= 0 || port > 65535 || (*end != '/' && *end != '\0')) {
+      return false;
+    }
+    out.port = static_cast<uint16_t>(port);
+    rest = end;
+  }
+  if(*rest == '\0') {
+    rest = "/";
+  }
+  return copy_string(out.path, sizeof(out.path), rest, strlen(rest));
+}
+
+bool HttpUrl::resolve(const char* reference, HttpUrl& out) const {
+  if(!reference || *reference == '\0') {
+    return false;
+  }
+  if(strstr(reference, "://")) {
+    return parse(reference, out);
+  }
+  if(&out != this) {
+    memcpy(out.host, host, sizeof(host));
+    out.port = port;
+  }
+  if(*reference == '/') {
+    return copy_string(out.path, sizeof(out.path), reference, strlen(reference));
+  }
+  // Relative to the directory of this url
+  char directory[HTTP_URL_PATH_MAX];
+  size_t directory_length = strrchr(path, '/') - path + 1;
+  copy_string(directory, sizeof(directory), path, directory_length);
+  size_t reference_length = strlen(reference);
+  if(directory_length + reference_length >= sizeof(out.path)) {
+    return false;
+  }
+  memcpy(out.path, directory, directory_length);
+  memcpy(out.path + directory_length, reference, reference_length + 1);
+  return true;
+}
+
+HttpDownload::Result HttpDownload::get(const HttpUrl& url, size_t offset, const Sink& sink, const char* user_agent) {
+  Result result{-1, 0, 0, false, false};
+
+  addrinfo hints{};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  char port[6];
+  snprintf(port, sizeof(port), "%u", url.port);
+  addrinfo* address = nullptr;
+  if(getaddrinfo(url.host, port, &hints, &address) != 0 || !address) {
+    return result;
+  }
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  if(sock < 0) {
+    freeaddrinfo(address);
+    return result;
+  }
+  set_timeout(sock, SO_RCVTIMEO, HTTP_DOWNLOAD_TIMEOUT_MILLIS);
+  set_timeout(sock, SO_SNDTIMEO, HTTP_DOWNLOAD_TIMEOUT_MILLIS);
+  bool connected = connect(sock, address->ai_addr, address->ai_addrlen) == 0;
+  freeaddrinfo(address);
+
+  // Request, the same buffer is used for the response head and body
+  char buffer[HTTP_DOWNLOAD_HEAD_SIZE];
+  int length = snprintf(buffer, sizeof(buffer), "GET %s HTTP/1.1\r\nHost: %s:%u\r\nConnection: close\r\n",
+                        url.path, url.host, url.port);
+  if(user_agent) {
+    length += snprintf(buffer + length, sizeof(buffer) - length, "User-Agent: %s\r\n", user_agent);
+  }
+  if(offset > 0) {
+    length += snprintf(buffer + length, sizeof(buffer) - length, "Range: bytes=%u-\r\n", static_cast<unsigned>(offset));
+  }
+  length += snprintf(buffer + length, sizeof(buffer) - length, "\r\n");
+  if(!connected || length >= static_cast<int>(sizeof(buffer)) || !send_all(sock, buffer, length)) {
+    close(sock);
+    return result;
+  }
+
+  // Response head
+  size_t received = 0;
+  char* body = nullptr;
+  while(!body) {
+    if(received == sizeof(buffer) - 1) {
+      close(sock);
+      return result;
+    }
+    auto read_size = recv(sock, buffer + received, sizeof(buffer) - 1 - received, 0);
+    if(read_size <= 0) {
+      close(sock);
+      return result;
+    }
+    received += read_size;
+    buffer[received] = '\0';
+    body = strstr(buffer, "\r\n\r\n");
+  }
+  body[2] = '\0';
+  body += 4;
+  size_t pending = buffer + received - body;
+
+  int status = 0;
+  if(sscanf(buffer, "HTTP/%*d.%*d %d", &status) != 1) {
+    close(sock);
+    return result;
+  }
+  result.status = status;
+
+  long content_length = -1;
+  bool chunked = false;
+  size_t range_start = 0;
+  char* line = strstr(buffer, "\r\n") + 2;
+  while(*line) {
+    char* end = strstr(line, "\r\n");
+    *end = '\0';
+    char* value = strchr(line, ':');
+    if(value) {
+      *value++ = '\0';
+      value += strspn(value, " \t");
+      if(strcasecmp(line, "Content-Length") == 0) {
+        content_length = strtol(value, nullptr, 10);
+      } else if(strcasecmp(line, "Content-Range") == 0) {
+        // bytes <start>-<end>/<total>
+        unsigned long start = 0, last = 0, total = 0;
+        if(sscanf(value, "bytes %lu-%lu/%lu", &start, &last, &total) == 3) {
+          range_start = start;
+          result.total = total;
+        }
+      } else if(strcasecmp(line, "Transfer-Encoding") == 0) {
+        chunked = strcasecmp(value, "identity") != 0;
+      }
+    }
+    line = end + 2;
+  }
+
+  // Static files are never chunked, not supported
+  if((status != 200 && status != 206) || chunked || (status == 206 && range_start != offset)) {
+    close(sock);
+    return result;
+  }
+  size_t skip = 0;
+  if(status == 200) {
+    skip = offset;
+    result.total = content_length >= 0 ? content_length : 0;
+  }
+
+  // Body
+  size_t body_received = 0;
+  auto deliver = [&](const uint8_t* data, size_t size) {
+    body_received += size;
+    size_t skipped = size < skip ? size : skip;
+    data += skipped;
+    size -= skipped;
+    skip -= skipped;
+    if(size == 0) {
+      return true;
+    }
+    if(!sink(data, size)) {
+      result.stopped = true;
+      return false;
+    }
+    result.received += size;
+    return true;
+  };
+
+  if(content_length >= 0 && pending > static_cast<size_t>(content_length)) {
+    pending = content_length;
+  }
+  bool closed = false;
+  if(pending == 0 || deliver(reinterpret_cast<uint8_t*>(body), pending)) {
+    while(content_length < 0 || body_received < static_cast<size_t>(content_length)) {
+      size_t wanted = sizeof(buffer);
+      if(content_length >= 0 && content_length - body_received < wanted) {
+        wanted = content_length - body_received;
+      }
+      auto read_size = recv(sock, buffer, wanted, 0);
+      if(read_size <= 0) {
+        closed = read_size == 0;
+        break;
+      }
+      if(!deliver(reinterpret_cast<uint8_t*>(buffer), read_size)) {
+        break;
+      }
+    }
+  }
+  close(sock);
+
+  result.complete = !result.stopped
+      && (content_length >= 0 ? body_received == static_cast<size_t>(content_length) : closed);
+  return result;
+}
@@ -0,0 +1,72 @@
+#ifndef BGEIGIECAST_HTTP_DOWNLOAD_H
+#define BGEIGIECAST_HTTP_DOWNLOAD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+#ifndef HTTP_DOWNLOAD_TIMEOUT_MILLIS
+#define HTTP_DOWNLOAD_TIMEOUT_MILLIS 10000
+#endif
+
+#ifndef HTTP_DOWNLOAD_HEAD_SIZE
+#define HTTP_DOWNLOAD_HEAD_SIZE 1024
+#endif
+
+#define HTTP_URL_HOST_MAX 64
+#define HTTP_URL_PATH_MAX 160
+
+/**
+ * Parsed `http://host[:port]/path` url, https is not supported
+ */
+struct HttpUrl {
+  char host[HTTP_URL_HOST_MAX];
+  uint16_t port;
+  char path[HTTP_URL_PATH_MAX];
+
+  /**
+   * @return false if it is not a valid http url
+   */
+  static bool parse(const char* url, HttpUrl& out);
+
+  /**
+   * Resolve a reference relative to this url: a complete url, an absolute path or a path relative to the directory of
+   * this url
+   * @return false if the result is not valid
+   */
+  bool resolve(const char* reference, HttpUrl& out) const;
+};
+
+/**
+ * Minimal blocking http GET on plain sockets, streams the body to a sink so large files (firmware images) never have to
+ * fit in memory. Supports continuing a download from an offset with a range request.
+ */
+class HttpDownload {
+ public:
+  /**
+   * Receives the body in parts
+   * @return false to stop the download
+   */
+  typedef std::function<bool(const uint8_t* data, size_t size)> Sink;
+
+  struct Result {
+    int status; // http status code, -1 if the connection failed
+    size_t received; // body bytes passed to the sink
+    size_t total; // size of the complete resource, 0 if unknown
+    bool complete; // the whole (requested part of the) body was received
+    bool stopped; // the sink stopped the download
+  };
+
+  /**
+   * Get a resource
+   * @param url
+   * @param offset: start of the body, sent as range request if not 0. If the server ignores the range, the first
+   *  `offset` bytes are skipped.
+   * @param sink
+   * @param user_agent
+   * @return result, status 200 or 206 if the body was (partly) received
+   */
+  static Result get(const HttpUrl& url, size_t offset, const Sink& sink, const char* user_agent = nullptr);
+};
+
+#endif //BGEIGIECAST_HTTP_DOWNLOAD_H
@@ -1,6 +1,6 @@
-#include <WebServer.h>
 #include "http_pages.h"
 #include "user_config.h"
+#include "web_assets.h"
 
 #define TITLE_HOME "Home"
 #define TITLE_UPDATE "Update firmware"
@@ -12,7 +12,9 @@
 const char* success_message = "<p><em>Configurations saved!</em></p>";
 
 const char* local_resources =
-    "<link rel='stylesheet' href='/pure.css'>";
+    "<link rel='stylesheet' href='/pure.css?v=" ASSET_VERSION_PURE_CSS "'>"
+    "<link rel='stylesheet' href='/style.css?v=" ASSET_VERSION_STYLE_CSS "'>"
+    "<script src='/menu.js?v=" ASSET_VERSION_MENU_JS "' defer></script>";
 
 const char* online_resources =
     "<script src='https://ajax.googleapis.com/ajax/libs/jquery/3.2.1/jquery.min.js'></script>"
@@ -22,46 +24,20 @@ const char* online_resources =
 const char* fallback_resources =
     "";
 
-const char* update_firmware_script =
-    "(e=>{const t=(...t)=>e.querySelector(...t),n=t('form'),a=t('#status');n.addEventListener('submit',e=>{e.prevent"
-    "Default();const s=new FormData(n),o=t('#file').files[0],d=new XMLHttpRequest;o?(n.classList.add('uploading'),s."
-    "append('update',o),d.addEventListener('load',e=>{a.innerText='Applying update...';setTimeout(()=>{a.innerText='"
-    "Upload success! Restarting device to apply update.';const t=new XMLHttpRequest;t.open('get','/reboot'),t.send()"
-    "},2000)}),d.addEventListener('error',e=>{a.innerText='Upload failed... Try again or contact info@safecast.org',"
-    "n.classList.remove('uploading')}),d.addEventListener('abort',e=>{a.innerText='Upload cancelled...'}),d.upload.a"
-    "ddEventListener('progress',e=>{if(e.lengthComputable){a.innerText='Uploading new firmware... This can take up t"
-    "o 10 minutes.';const n=Math.round(e.loaded/e.total*100)+'%';t('#prg').innerText=n,t('#bar').style.width=n}}),d."
-    "open(n.method,n.action),d.send(s)):a.innerText='Please select a file...'})})(this.document);";
-
 /**
- * page format
- * %s - page name (page title)
- * %d - device id (page title)
- * %s - remote resources
- * %s - local resources
- * %d - device id (menu title)
- * %s - page content (main content)
+ * Page head, after the page title
  */
-const char* base_page_format_begin =
-    "<!DOCTYPE html>"
-    "<html lang='en'><head>"
-    "<meta name='viewport' content='width=device-width, initial-scale=1.0'>"
-    "<title>%s | bGeigieCast %d</title>"
-    "%s"
-    "%s"
-    "<style>"
-    "i{width: 25px;text-align: center;}"
-    "#layout{max-width: 680px;margin: auto;}"
-    "#main{padding:1em;}"
-    "input[type='text'],input[type='number']{max-width: 300px;width: 100%%;}"
-    ".pure-menu-link{padding: 1em .7em;}"
-    "</style>"
+const char* base_page_head =
     "</head>"
     "<body>"
     "<div id='layout'>"
     "<div id='header'>"
-    "<div class='pure-menu pure-menu-horizontal'>"
-    "<a href='/' class='pure-menu-heading'>bGeigieCast %d</a>"
+    "<div class='pure-menu pure-menu-horizontal'>";
+
+/**
+ * Page menu, after the menu title
+ */
+const char* base_page_menu =
     "<ul class='pure-menu-list'>"
     "<li class='pure-menu-item pure-menu-has-children pure-menu-allow-hover'>"
     "<a href='#' id='menuLink1' class='pure-menu-link'><i class='fa fa-cog'></i>Configure</a>"
@@ -71,27 +47,23 @@ const char* base_page_format_begin =
     "<li class='pure-menu-item'><a href='/location' class='pure-menu-link'><i class='fa fa-map-marker-alt'></i>Location</a></li>"
     "</ul></li>"
     "<li class='pure-menu-item'><a href='/update' class='pure-menu-link'><i class='fa fa-download'></i>Update firmware</a></li>"
-    "<!--<li class='pure-menu-item'><a href='/status' class='pure-menu-link'><i class='fas fa-info-circle'></i>Status</a></li>-->"  // TODO: comment this out once status page is done
+    "<li class='pure-menu-item'><a href='/status' class='pure-menu-link'><i class='fas fa-info-circle'></i>Status</a></li>"
     "<li class='pure-menu-item'><a target='_blank' href='https://github.com/Safecast/bGeigieCast/' class='pure-menu-link'><i class='fab fa-github'></i>Github</a></li>"
     "</ul>"
     "</div>"
     "</div>"
-    "<script>"
-    "document.querySelectorAll('.pure-menu-item').forEach((e)=>e.children[0].href===window.location.href?e.classList.add('pure-menu-selected'):0);"
-    "</script>"
     "<div id='main'>";
 
-const char* base_page_format_end =
+const char* base_page_end =
     "</div>"
     "</div>"
     "</body></html>";
 
-const char* HttpPages::get_home_page(uint32_t device_id) {
-  return render_full_page(
-      device_id,
-      TITLE_HOME,
+void HttpPages::render_home_page(Print& out, uint32_t device_id) {
+  render_page_begin(out, device_id, TITLE_HOME);
+  out.print(
       "<h1>Manage your bGeigieCast</h1>"
-      "<p class='pure-form-message'>bGeigieCast version %s</p>"
+      "<p class='pure-form-message'>bGeigieCast version " BGEIGIECAST_VERSION "</p>"
       "<p>"
       "<ul>"
       "<li><a href='/device'>Configure your device</a></li>"
@@ -100,24 +72,28 @@ const char* HttpPages::get_home_page(uint32_t device_id) {
       "<li><a href='/update'>Update the firmware</a></li>"
       "</ul>"
       "More information about configurations in the <a href='https://github.com/Safecast/bGeigieCast/wiki/User-manual#available-settings' target='_blank'>User manual</a>. "
-      "Or view your device on <a href='https://grafana.safecast.cc/d/DFSxrOLWk/safecast-device-details?orgId=1&from=now-7d&to=now&refresh=15m&var-device_urn=geigiecast:6%d&from=now-30m&to=now' target='_blank'>Grafana</a>."
-      "</p>",
-      BGEIGIECAST_VERSION,
-      device_id
+      "Or view your device on <a href='https://grafana.safecast.cc/d/DFSxrOLWk/safecast-device-details?orgId=1&from=now-7d&to=now&refresh=15m&var-device_urn=geigiecast:6"
+  );
+  out.print(device_id);
+  out.print(
+      "&from=now-30m&to=now' target='_blank'>Grafana</a>."
+      "</p>"
   );
+  render_page_end(out);
 }
 
-const char* HttpPages::get_update_page(uint32_t device_id) {
-  return render_full_page(
-      device_id,
-      TITLE_UPDATE,
+void HttpPages::render_update_page(Print& out, uint32_t device_id) {
+  render_page_begin(out, device_id, TITLE_UPDATE);
+  out.print(
       "<div id='update'>"
-      "<form class='pure-form pure-form-stacked' method='POST' enctype='multipart/form-data'>"
+      "<form class='pure-form pure-form-stacked' method='POST'>"
       "<fieldset>"
       "<legend><a href='/'>Home</a> / Update the firmware</legend>"
       "<div id='upload-inputs'>"
       "<p><em>Current version: v" BGEIGIECAST_VERSION "</em></p>"
       "<input type='file' name='update' id='file'><br>"
+      "<label for='sha256'>SHA-256 (optional)</label>"
+      "<input type='text' name='sha256' id='sha256' size='64' maxlength='64' pattern='[0-9a-fA-F]{64}'>"
       "<span class='pure-form-message'>The latest firmware can be found on <a target='_blank' href='https://github.com/Safecast/bGeigieCast/tree/development/firmware'>Github</a></span>"
       "<br>"
       "<input type='submit' class='pure-button pure-button-primary' value='Upload'>"
@@ -129,44 +105,49 @@ const char* HttpPages::get_update_page(uint32_t device_id) {
       "</div>"
       "</fieldset>"
       "</form>"
-      "<script>"
-      "%s"
-      "</script>"
-      "<style>"
-      "#upload-progress{display:none}"
-      "form.uploading #upload-inputs{display:none}"
-      "form.uploading #upload-progress{display:block}"
-      "</style>"
-      "</div>",
-      update_firmware_script
+      "<script src='/update.js?v=" ASSET_VERSION_UPDATE_JS "'></script>"
+      "</div>"
   );
+  render_page_end(out);
 }
 
-const char* HttpPages::get_config_device_page(
+void HttpPages::render_config_device_page(
+    Print& out,
     bool display_success,
     uint32_t device_id,
     uint8_t led_intensity,
     bool colorblind
 ) {
-  return render_full_page(
-      device_id,
-      TITLE_CONF_DEVICE,
+  render_page_begin(out, device_id, TITLE_CONF_DEVICE);
+  out.print(
       "<form class='pure-form pure-form-stacked' action='/save?next=/device' method='POST'>"
       "<fieldset>"
       "<legend><a href='/'>Home</a> / Device settings</legend>"
 
       // Led intensity
       "<label for='" FORM_NAME_LED_INTENSITY "'>Led intensity</label>"
-      "<input type='number' min='5' max='100' name='" FORM_NAME_LED_INTENSITY "' id='" FORM_NAME_LED_INTENSITY "' value='%d'>"
+      "<input type='number' min='5' max='100' name='" FORM_NAME_LED_INTENSITY "' id='" FORM_NAME_LED_INTENSITY "' value='"
+  );
+  out.print(led_intensity);
+  out.print(
+      "'>"
       "<span class='pure-form-message'>Value between 5 (very dim) and 100.(very bright).</span>"
 
       // Colorblind
       "<label>Color set</label>"
       "<label for='" FORM_NAME_LED_COLOR "0' class='pure-radio'>"
-      "<input id='" FORM_NAME_LED_COLOR "0' type='radio' name='" FORM_NAME_LED_COLOR "' value='0' %s>Default"
+      "<input id='" FORM_NAME_LED_COLOR "0' type='radio' name='" FORM_NAME_LED_COLOR "' value='0' "
+  );
+  out.print(colorblind ? "" : "checked");
+  out.print(
+      ">Default"
       "</label>"
       "<label for='" FORM_NAME_LED_COLOR "1' class='pure-radio'>"
-      "<input id='" FORM_NAME_LED_COLOR "1' type='radio' name='" FORM_NAME_LED_COLOR "' value='1' %s>Colorblind"
+      "<input id='" FORM_NAME_LED_COLOR "1' type='radio' name='" FORM_NAME_LED_COLOR "' value='1' "
+  );
+  out.print(colorblind ? "checked" : "");
+  out.print(
+      ">Colorblind"
       "</label>"
       "<span class='pure-form-message'></span>"
 
@@ -174,15 +155,13 @@ const char* HttpPages::get_config_device_page(
       "<button type='submit' class='pure-button pure-button-primary'>Save</button>"
       "</fieldset>"
       "</form>"
-      "%s", // Success message
-      led_intensity,
-      colorblind ? "" : "checked",
-      colorblind ? "checked" : "",
-      display_success ? success_message : ""
   );
+  out.print(display_success ? success_message : "");
+  render_page_end(out);
 }
 
-const char* HttpPages::get_config_location_page(
+void HttpPages::render_config_location_page(
+    Print& out,
     bool display_success,
     uint32_t device_id,
     bool use_home_location,
@@ -191,9 +170,8 @@ const char* HttpPages::get_config_location_page(
     double last_latitude,
     double last_longitude
 ) {
-  return render_full_page(
-      device_id,
-      TITLE_CONF_LOCATION,
+  render_page_begin(out, device_id, TITLE_CONF_LOCATION);
+  out.print(
       "<form class='pure-form pure-form-stacked' action='/save?next=/location' method='POST'>"
       "<fieldset>"
       "<legend><a href='/'>Home</a> / Location settings</legend>"
@@ -201,13 +179,21 @@ const char* HttpPages::get_config_location_page(
       // Use home location
       "<label>Location in fixed mode</label>"
       "<label for='" FORM_NAME_LOC_HOME "0' class='pure-radio'>"
-      "<input id='" FORM_NAME_LOC_HOME "0' type='radio' name='" FORM_NAME_LOC_HOME "' value='0' %s>Use GPS"
+      "<input id='" FORM_NAME_LOC_HOME "0' type='radio' name='" FORM_NAME_LOC_HOME "' value='0' "
+  );
+  out.print(use_home_location ? "" : "checked");
+  out.print(
+      ">Use GPS"
       "</label>"
       "<span class='pure-form-message'>"
       "Using GPS location: the bGeigieCast will upload measurements to the api using the last measured GPS location."
       "</span>"
       "<label for='" FORM_NAME_LOC_HOME "1' class='pure-radio'>"
-      "<input id='" FORM_NAME_LOC_HOME "1' type='radio' name='" FORM_NAME_LOC_HOME "' value='1' %s>Use fixed location"
+      "<input id='" FORM_NAME_LOC_HOME "1' type='radio' name='" FORM_NAME_LOC_HOME "' value='1' "
+  );
+  out.print(use_home_location ? "checked" : "");
+  out.print(
+      ">Use fixed location"
       "</label>"
       "<span class='pure-form-message'>"
       "Using fixed location: Use a single GPS location as the location for all your measurements. If incoming "
@@ -217,11 +203,19 @@ const char* HttpPages::get_config_location_page(
 
       // Home latitude
       "<label for='" FORM_NAME_LOC_HOME_LAT "'>Fixed latitude</label>"
-      "<input type='number' min='-90.0000' max='90.0000' name='" FORM_NAME_LOC_HOME_LAT "' id='" FORM_NAME_LOC_HOME_LAT "' value='%.5f' step='0.00001'>"
+      "<input type='number' min='-90.0000' max='90.0000' name='" FORM_NAME_LOC_HOME_LAT "' id='" FORM_NAME_LOC_HOME_LAT "' value='"
+  );
+  out.print(home_latitude, 5);
+  out.print(
+      "' step='0.00001'>"
 
       // Home longitude
       "<label for='" FORM_NAME_LOC_HOME_LON "'>Fixed longitude</label>"
-      "<input type='number' min='-180.0000' max='180.0000' name='" FORM_NAME_LOC_HOME_LON "' id='" FORM_NAME_LOC_HOME_LON "' value='%.5f' step='0.00001'>"
+      "<input type='number' min='-180.0000' max='180.0000' name='" FORM_NAME_LOC_HOME_LON "' id='" FORM_NAME_LOC_HOME_LON "' value='"
+  );
+  out.print(home_longitude, 5);
+  out.print(
+      "' step='0.00001'>"
 
       // Set last known location
       "<span class='pure-form-message'>"
@@ -230,64 +224,112 @@ const char* HttpPages::get_config_location_page(
       "document.getElementById('" FORM_NAME_LOC_HOME_LON "').value = document.getElementById('l_lo').innerHTML;"
       "return false;"
       "\">use this</a>):<br>"
-      "Latitude: <span id='l_la'>%.5f</span><br>"
-      "Longitude: <span id='l_lo'>%.5f</span><br>"
+      "Latitude: <span id='l_la'>"
+  );
+  out.print(last_latitude, 5);
+  out.print(
+      "</span><br>"
+      "Longitude: <span id='l_lo'>"
+  );
+  out.print(last_longitude, 5);
+  out.print(
+      "</span><br>"
       "</span>"
 
       "<br>"
       "<button type='submit' class='pure-button pure-button-primary'>Save</button>"
       "</fieldset>"
       "</form>"
-      "%s", // Success message
-      use_home_location ? "" : "checked",
-      use_home_location ? "checked" : "",
-      home_latitude,
-      home_longitude,
-      last_latitude,
-      last_longitude,
-      display_success ? success_message : ""
   );
+  out.print(display_success ? success_message : "");
+  render_page_end(out);
 }
 
-const char* HttpPages::get_config_connection_page(
+void HttpPages::render_config_connection_page(
+    Print& out,
     bool display_success,
     uint32_t device_id,
     const char* device_password,
-    const char* wifi_ssid,
-    const char* wifi_password,
+    const WiFiProfile* wifi_profiles,
     const char* api_key,
-    bool use_dev
+    bool use_dev,
+    const char* update_url
 ) {
-  char ssid[20];
-  sprintf(ssid, ACCESS_POINT_SSID, device_id);
-  return render_full_page(
-      device_id,
-      TITLE_CONF_CONNECTION,
+  render_page_begin(out, device_id, TITLE_CONF_CONNECTION);
+  out.print(
       "<form class='pure-form pure-form-stacked' action='/save?next=/connection' method='POST'>"
       "<fieldset>"
       "<legend><a href='/'>Home</a> / Connection settings</legend>"
 
       // bGeigie ap password
       "<label for='" FORM_NAME_AP_LOGIN "'>bGeigie password</label>"
-      "<input type='text' name='" FORM_NAME_AP_LOGIN "' id='" FORM_NAME_AP_LOGIN "' value='%s'>"
+      "<input type='text' name='" FORM_NAME_AP_LOGIN "' id='" FORM_NAME_AP_LOGIN "' value='"
+  );
+  out.print(device_password);
+  out.print(
+      "'>"
       "<span class='pure-form-message'>"
       "The password for the wifi connection access point when starting the bGeigieCast in configuration mode. "
-      "The SSID of the bGeigieCast: %s"
+      "The SSID of the bGeigieCast: "
+  );
+  out.printf(ACCESS_POINT_SSID, device_id);
+  out.print(
       "</span>"
 
       // WiFi ssid
       "<label for='" FORM_NAME_WIFI_SSID "'>WiFi network name</label>"
-      "<input type='text' name='" FORM_NAME_WIFI_SSID "' id='" FORM_NAME_WIFI_SSID "' value='%s'>"
+      "<input type='text' name='" FORM_NAME_WIFI_SSID "' id='" FORM_NAME_WIFI_SSID "' value='"
+  );
+  out.print(wifi_profiles[0].ssid);
+  out.print(
+      "'>"
       "<span class='pure-form-message'>Your WiFi network name</span>"
 
       // WiFi password
       "<label for='" FORM_NAME_WIFI_PASS "'>WiFi password</label>"
-      "<input type='text' name='" FORM_NAME_WIFI_PASS "' id='" FORM_NAME_WIFI_PASS "' value='%s'>"
+      "<input type='text' name='" FORM_NAME_WIFI_PASS "' id='" FORM_NAME_WIFI_PASS "' value='"
+  );
+  out.print(wifi_profiles[0].password);
+  out.print(
+      "'>"
       "<span class='pure-form-message'>Your WiFi network password</span>"
 
+      // WiFi priority
+      "<label for='" FORM_NAME_WIFI_PRIORITY "'>WiFi priority</label>"
+      "<input type='number' min='0' max='9' name='" FORM_NAME_WIFI_PRIORITY "' id='" FORM_NAME_WIFI_PRIORITY "' value='"
+  );
+  out.print(wifi_profiles[0].priority);
+  out.print("'>");
+
+  // Other networks
+  char ssid_name[8];
+  char pass_name[8];
+  char priority_name[8];
+  for(uint8_t i = 1; i < WIFI_PROFILE_COUNT; ++i) {
+    wifi_form_name(ssid_name, FORM_NAME_WIFI_SSID, i);
+    wifi_form_name(pass_name, FORM_NAME_WIFI_PASS, i);
+    wifi_form_name(priority_name, FORM_NAME_WIFI_PRIORITY, i);
+    out.printf("<label for='%s'>WiFi network %u</label>", ssid_name, i + 1);
+    out.printf("<input type='text' name='%s' id='%s' placeholder='Network name' value='", ssid_name, ssid_name);
+    out.print(wifi_profiles[i].ssid);
+    out.printf("'><input type='text' name='%s' placeholder='Password' value='", pass_name);
+    out.print(wifi_profiles[i].password);
+    out.printf("'><input type='number' min='0' max='9' name='%s' placeholder='Priority' value='%u'>",
+               priority_name, wifi_profiles[i].priority);
+  }
+  out.print(
+      "<span class='pure-form-message'>"
+      "Other networks to connect to, leave the name empty to remove a network. "
+      "Of the networks in range the one with the highest priority is used, the strongest signal if equal."
+      "</span>"
+
       // Api key
       "<label for='" FORM_NAME_API_KEY "'>API key</label>"
-      "<input type='text' name='" FORM_NAME_API_KEY "' id='" FORM_NAME_API_KEY "' value='%s'>"
+      "<input type='text' name='" FORM_NAME_API_KEY "' id='" FORM_NAME_API_KEY "' value='"
+  );
+  out.print(api_key);
+  out.print(
+      "'>"
       "<span class='pure-form-message'>"
       "Get your API key from <a target='_blank' href='https://api.safecast.org'>api.safecast.org</a>, Login -> Dashboard -> Retrieve your API key.<br>"
       "<em>Note: when using development server, get your API key from <a target='_blank' href='https://dev.safecast.org'>dev.safecast.org</a></em>"
@@ -296,406 +338,91 @@ const char* HttpPages::get_config_connection_page(
       // Use dev
       "<label>Safecast server</label>"
       "<label for='" FORM_NAME_USE_DEV "0' class='pure-radio'>"
-      "<input id='" FORM_NAME_USE_DEV "0' type='radio' name='" FORM_NAME_USE_DEV "' value='0' %s>Production"
+      "<input id='" FORM_NAME_USE_DEV "0' type='radio' name='" FORM_NAME_USE_DEV "' value='0' "
+  );
+  out.print(use_dev ? "" : "checked");
+  out.print(
+      ">Production"
       "</label>"
       "<label for='" FORM_NAME_USE_DEV "1' class='pure-radio'>"
-      "<input id='" FORM_NAME_USE_DEV "1' type='radio' name='" FORM_NAME_USE_DEV "' value='1' %s>Development"
+      "<input id='" FORM_NAME_USE_DEV "1' type='radio' name='" FORM_NAME_USE_DEV "' value='1' "
+  );
+  out.print(use_dev ? "checked" : "");
+  out.print(
+      ">Development"
       "</label>"
       "<span class='pure-form-message'>"
       "Use development for testing purposes. Double check your API key when changing this option!"
       "</span>"
 
+      // Firmware update server
+      "<label for='" FORM_NAME_UPDATE_URL "'>Update server</label>"
+      "<input type='url' name='" FORM_NAME_UPDATE_URL "' id='" FORM_NAME_UPDATE_URL "' maxlength='95' value='"
+  );
+  out.print(update_url);
+  out.print(
+      "'>"
+      "<span class='pure-form-message'>"
+      "Url of the firmware manifest on a local update server (http only), leave empty to disable automatic updates"
+      "</span>"
+
       "<br>"
       "<button type='submit' class='pure-button pure-button-primary'>Save</button>"
       "</fieldset>"
       "</form>"
-      "%s",
-      device_password,
-      ssid,
-      wifi_ssid,
-      wifi_password,
-      api_key,
-      use_dev ? "" : "checked",
-      use_dev ? "checked" : "",
-      display_success ? success_message : ""
   );
+  out.print(display_success ? success_message : "");
+  render_page_end(out);
 }
 
-const char* HttpPages::get_status_page(uint32_t device_id) {
-  return render_full_page(
-      device_id,
-      TITLE_STATUS,
+void HttpPages::wifi_form_name(char* out, const char* name, uint8_t profile) {
+  if(profile == 0) {
+    strcpy(out, name);
+  } else {
+    sprintf(out, "%s%u", name, profile);
+  }
+}
+
+void HttpPages::render_status_page(Print& out, uint32_t device_id) {
+  render_page_begin(out, device_id, TITLE_STATUS);
+  out.print(
       "<form class='pure-form'>"
       "<fieldset>"
       "<legend><a href='/'>Home</a> / Status</legend>"
-      "<pre style='background-color:#eee;padding:5px;font-size:12px;max-width:680px'>"
-      "bGeigieCast Version %s [%s]<br>"
-      " - Current mode: %s<br>"
-      "bGeigie data [%s]<br>"
-      " - Last data: %s<br>"
-      " - Valid: %s<br>"
-      "Configuration server [%s]<br>"
-      " - Status: %s<br>"
-      "Api connection [%s]<br>"
-      " - Status: %s<br>"
-      "Bluetooth connection [%s]<br>"
-      " - Status: %s<br>"
-      "</pre>"
+      "<pre id='status' style='background-color:#eee;padding:5px;font-size:12px;max-width:680px'>Loading...</pre>"
+      "<span class='pure-form-message'>Also available as <a href='/api/status'>json</a></span>"
       "</fieldset>"
-      "</form>",
-      BGEIGIECAST_VERSION,
-      "Active", // System state
-      "Fixed", // - System mode
-      "Active", // bGeigie state
-      "$BNRDD,2041,2012-09-20T16:53:58Z,776,63,33895,A,5641.7788,N,1411.8820,E,9861.20,A,109,9*46", // - bGeigie data
-      "Yes", // - bGeigie datavalid
-      "Active", // Server state
-      "Connected with wifi", // - Server status
-      "Active", // Api state
-      "Data posted", // - Api status
-      "Inactive", // BT state
-      "Idle"  // - BT status
+      "</form>"
+      "<script src='/status.js?v=" ASSET_VERSION_STATUS_JS "'></script>"
   );
+  render_page_end(out);
 }
 
-const char* HttpPages::render_full_page(uint32_t device_id, const char* page_name, const char* content_format, ...) {
-  sprintf(
-      transmission_buffer,
-      base_page_format_begin,
-      page_name,
-      device_id,
-      local_resources,
-      internet_access ? online_resources : fallback_resources,
-      device_id
+void HttpPages::render_page_begin(Print& out, uint32_t device_id, const char* page_name) {
+  out.print(
+      "<!DOCTYPE html>"
+      "<html lang='en'><head>"
+      "<meta name='viewport' content='width=device-width, initial-scale=1.0'>"
+      "<title>"
   );
-
-  va_list args;
-  va_start(args, content_format);
-  vsprintf(
-      &transmission_buffer[strlen(transmission_buffer)],
-      content_format,
-      args
-  );
-  va_end(args);
-
-  sprintf(
-      &transmission_buffer[strlen(transmission_buffer)],
-      base_page_format_end
-  );
-
-  return transmission_buffer;
+  out.print(page_name);
+  out.print(" | bGeigieCast ");
+  out.print(device_id);
+  out.print("</title>");
+  out.print(local_resources);
+  out.print(internet_access ? online_resources : fallback_resources);
+  out.print(base_page_head);
+  out.print("<a href='/' class='pure-menu-heading'>bGeigieCast ");
+  out.print(device_id);
+  out.print("</a>");
+  out.print(base_page_menu);
 }
 
-char HttpPages::transmission_buffer[] = "";
-
-const char* HttpPages::pure_js =
-    "(function (w,d){const a='active',l=d.getElementById('layout'),m=d.getElementById('menu'),n=d"
-    ".getElementById('menuLink'),c=d.getElementById('main'),tc=(e,b)=>{const r=e.className.split("
-    "/\\s+/),p=r.length;let i=0;while (i < p){if(r[i]===b){r.splice(i,1);break;}i++;}if(i===p){r."
-    "push(b);}e.className=r.join(' ');},ta=(e)=>{e.preventDefault();tc(l,a);tc(m,a);tc(n,a);};n.o"
-    "nclick=(e)=>ta(e);c.onclick=(e)=>m.className.indexOf(a)!==-1 && ta(e);}(this,this.document));";
+void HttpPages::render_page_end(Print& out) {
+  out.print(base_page_end);
+}
 
 /**
  *
  */
 bool HttpPages::internet_access = false;
-
-/**
- * Gzipped pure css library
- * https://purecss.io/
- */
-const uint8_t HttpPages::pure_css[PURE_CSS_SIZE] = {
-    0x1f, 0x8b, 0x08, 0x08, 0x56, 0xa2, 0xec, 0x5c, 0x00, 0x03, 0x70, 0x75, 0x72, 0x65, 0x2d, 0x6d,
-    0x69, 0x6e, 0x2e, 0x63, 0x73, 0x73, 0x00, 0xed, 0x1b, 0x6b, 0x8f, 0xe3, 0xb6, 0xf1, 0xfb, 0xfd,
-    0x0a, 0xe5, 0x0e, 0x07, 0xdc, 0x1e, 0x24, 0xaf, 0x2c, 0x3f, 0x57, 0x42, 0x82, 0x26, 0xcd, 0xa5,
-    0x4d, 0x91, 0x06, 0x05, 0xd2, 0x2f, 0xc5, 0x65, 0x0b, 0xd0, 0x12, 0x6d, 0xab, 0xab, 0x17, 0x24,
-    0x79, 0x1f, 0xe7, 0xfa, 0xbf, 0x77, 0xf8, 0x90, 0x34, 0x7c, 0xc8, 0xf6, 0xa6, 0x45, 0xd1, 0x0f,
-    0x8d, 0x73, 0x77, 0x12, 0x39, 0x1c, 0x0e, 0xe7, 0xc5, 0x99, 0x21, 0x75, 0xfb, 0xf1, 0xab, 0x37,
-    0x7f, 0x39, 0xd4, 0xd4, 0x79, 0x9c, 0x4e, 0xfc, 0x89, 0xff, 0xe6, 0xf7, 0x65, 0xf5, 0x52, 0xa7,
-    0xbb, 0x7d, 0xeb, 0x04, 0xfe, 0x74, 0xe6, 0xfc, 0x8d, 0xec, 0xcb, 0xf2, 0xab, 0x37, 0x3f, 0xa5,
-    0x31, 0x2d, 0x1a, 0x9a, 0x38, 0x87, 0x22, 0xa1, 0xb5, 0xd3, 0xee, 0xa9, 0xf3, 0xdd, 0x2f, 0xdf,
-    0x3b, 0xb2, 0x79, 0xf2, 0x66, 0xdf, 0xb6, 0x55, 0x13, 0xde, 0xde, 0xee, 0xd2, 0x76, 0x7f, 0xd8,
-    0x4c, 0xe2, 0x32, 0xbf, 0x7d, 0x61, 0x23, 0x6f, 0x2b, 0x40, 0x7d, 0xbb, 0xc9, 0xca, 0xcd, 0x6d,
-    0x4e, 0x9a, 0x96, 0xd6, 0xb7, 0x3f, 0xfd, 0xf8, 0xfb, 0x4f, 0x3f, 0xff, 0xf2, 0x69, 0x92, 0x27,
-    0x6f, 0x3e, 0xde, 0xbe, 0xb9, 0x85, 0xd9, 0x8b, 0xb2, 0xce, 0x49, 0x96, 0x7e, 0xa1, 0x93, 0xb8,
-    0x69, 0x9c, 0xc7, 0xbf, 0xcf, 0x26, 0xbe, 0xf3, 0x4f, 0xe7, 0xcf, 0x3f, 0xfe, 0xb5, 0x43, 0x0f,
-    0x6f, 0x80, 0x77, 0x92, 0x96, 0xb7, 0x3d, 0x28, 0x22, 0xf3, 0x43, 0x7c, 0xe3, 0xfc, 0x9c, 0xc6,
-    0x65, 0x46, 0x1a, 0xe7, 0x0f, 0x24, 0xcb, 0xc8, 0x6e, 0x0f, 0x14, 0x92, 0x22, 0x71, 0xfe, 0x54,
-    0x16, 0xa4, 0xdd, 0x93, 0xc2, 0xf9, 0x99, 0x92, 0x4c, 0xce, 0xe6, 0x68, 0xb3, 0xc1, 0x64, 0x93,
-    0x99, 0x6d, 0xba, 0x6e, 0x19, 0x05, 0xe5, 0xa8, 0x6f, 0xd5, 0x71, 0x1f, 0x6f, 0x27, 0x6c, 0x65,
-    0xde, 0xe6, 0xd0, 0xb6, 0x65, 0x11, 0x6e, 0xcb, 0xf8, 0xd0, 0xb8, 0x24, 0x24, 0x71, 0x9b, 0x3e,
-    0x52, 0x78, 0xd8, 0x97, 0x8f, 0xb4, 0x3e, 0x96, 0x87, 0x36, 0x4b, 0x0b, 0x1a, 0xfa, 0x27, 0x01,
-    0xdd, 0x92, 0x4d, 0x46, 0x5d, 0xfe, 0xf7, 0x71, 0x53, 0xd6, 0xc0, 0x49, 0x0f, 0x90, 0x67, 0xa4,
-    0x6a, 0x68, 0xd8, 0x3d, 0x44, 0xb2, 0xa3, 0xa9, 0x48, 0x9c, 0x16, 0x3b, 0x18, 0xbb, 0x6f, 0xf3,
-    0xec, 0xb8, 0x2d, 0x8b, 0xd6, 0xdb, 0x92, 0x3c, 0xcd, 0x5e, 0xc2, 0x86, 0x14, 0x8d, 0xd7, 0xd0,
-    0x3a, 0xdd, 0x46, 0x5e, 0xde, 0x78, 0x2d, 0x7d, 0x6e, 0xbd, 0x06, 0x28, 0xf3, 0x48, 0xf2, 0x8f,
-    0x43, 0xd3, 0x86, 0x53, 0xdf, 0x7f, 0x1f, 0x79, 0x4f, 0x74, 0xf3, 0x90, 0xb6, 0xf6, 0xde, 0xd3,
-    0xa6, 0x4c, 0x5e, 0x8e, 0x39, 0xa9, 0x77, 0x69, 0x01, 0x33, 0x90, 0xba, 0x4d, 0x63, 0xa0, 0x8c,
-    0x34, 0x69, 0x42, 0xdd, 0x84, 0xb6, 0x24, 0xcd, 0x1a, 0x77, 0x9b, 0xee, 0x62, 0x52, 0xb5, 0x69,
-    0x59, 0xb0, 0x47, 0xa0, 0xdf, 0xdd, 0x96, 0x25, 0x88, 0xd0, 0xdd, 0x53, 0x92, 0xb0, 0x7f, 0x76,
-    0x75, 0x79, 0xa8, 0xdc, 0x9c, 0xa4, 0x85, 0x9b, 0xd3, 0xe2, 0xe0, 0x16, 0xe4, 0xd1, 0x6d, 0x68,
-    0xcc, 0x47, 0x34, 0x87, 0x1c, 0xd0, 0xbf, 0x1c, 0x93, 0xb4, 0xa9, 0x32, 0xf2, 0x12, 0x82, 0x0a,
-    0xc4, 0x0f, 0x27, 0x72, 0x48, 0xd2, 0xd2, 0x8d, 0x49, 0xf1, 0x48, 0x1a, 0xb7, 0xaa, 0xcb, 0x5d,
-    0x4d, 0x9b, 0xc6, 0x7d, 0x84, 0x59, 0xcb, 0x1e, 0x32, 0x2d, 0x18, 0xcf, 0x3c, 0x3e, 0x20, 0x02,
-    0x2e, 0x02, 0x69, 0x24, 0xf3, 0x80, 0xf5, 0xbb, 0x22, 0xdc, 0x90, 0x86, 0xb2, 0x5e, 0x81, 0x28,
-    0x2c, 0xca, 0xf6, 0xc3, 0xe7, 0x18, 0x38, 0x53, 0x97, 0x59, 0x73, 0x7f, 0xd3, 0xa3, 0x28, 0xca,
-    0x82, 0x46, 0x7b, 0xca, 0xd4, 0x03, 0x56, 0xf7, 0x79, 0x9f, 0x26, 0x09, 0x2d, 0xee, 0xdd, 0x96,
-    0xe6, 0xd0, 0xdd, 0x52, 0x05, 0xee, 0x44, 0x8e, 0x1b, 0x12, 0x3f, 0xb0, 0xb5, 0x14, 0x09, 0x13,
-    0x47, 0x59, 0x87, 0x6d, 0x0d, 0x1c, 0xae, 0x48, 0x4d, 0x8b, 0xf6, 0x44, 0x36, 0x9b, 0xfa, 0x73,
-    0x9b, 0xb6, 0x19, 0xbd, 0xef, 0x64, 0xb6, 0x29, 0x41, 0xe8, 0x79, 0x38, 0xad, 0x9e, 0x9d, 0x04,
-    0x1e, 0x69, 0x72, 0xda, 0xb8, 0x65, 0xd5, 0x0a, 0x76, 0x34, 0x40, 0x4c, 0xb1, 0x13, 0xf2, 0x7a,
-    0x12, 0x24, 0xac, 0x7c, 0xff, 0x94, 0x6c, 0x0b, 0xd1, 0xd6, 0xb4, 0x2f, 0x19, 0x0d, 0xd3, 0x16,
-    0x16, 0x14, 0x9f, 0xf6, 0x53, 0xd9, 0x08, 0xf2, 0x09, 0x03, 0x9a, 0x47, 0x52, 0x24, 0x93, 0xe5,
-    0x8a, 0xe6, 0x8e, 0x7f, 0x82, 0xd7, 0x07, 0x44, 0x5e, 0xf8, 0x6e, 0xbb, 0xf5, 0x23, 0x41, 0xe3,
-    0x3b, 0x1f, 0xb0, 0x36, 0xa0, 0x92, 0x19, 0x42, 0xb1, 0x06, 0xd1, 0x36, 0x87, 0x0d, 0x70, 0xbf,
-    0x42, 0xad, 0xab, 0xc5, 0xfb, 0x88, 0xf3, 0xb4, 0x63, 0x49, 0x54, 0x95, 0x4d, 0xca, 0xc4, 0x14,
-    0xd6, 0x14, 0x18, 0x02, 0x2a, 0x3b, 0xca, 0x68, 0x86, 0xa9, 0x2d, 0xab, 0xd0, 0x9b, 0x2c, 0x68,
-    0xce, 0x70, 0x1f, 0xe5, 0xea, 0xbd, 0x49, 0xc0, 0x5a, 0xd2, 0x7c, 0x27, 0xd9, 0x02, 0x9c, 0x6e,
-    0x1e, 0x77, 0x5c, 0x26, 0x61, 0x0d, 0x8a, 0x72, 0x73, 0x64, 0x36, 0xb0, 0xcd, 0xca, 0xa7, 0x50,
-    0x08, 0xe0, 0x24, 0xb4, 0xa8, 0x53, 0xbb, 0x29, 0xac, 0x70, 0xee, 0x57, 0xcf, 0xa7, 0x7d, 0x0d,
-    0x18, 0x9e, 0x19, 0xa9, 0x4c, 0xdf, 0x99, 0x38, 0x81, 0xef, 0xc0, 0xe4, 0xe7, 0x41, 0x84, 0x15,
-    0x28, 0x1f, 0x53, 0x64, 0x10, 0x09, 0x19, 0xd0, 0x92, 0x43, 0x5b, 0x9e, 0xe2, 0x12, 0x54, 0xf6,
-    0x61, 0x93, 0xb8, 0x0c, 0xa6, 0x21, 0x79, 0xa5, 0x98, 0x4a, 0x5e, 0x16, 0x25, 0xb3, 0x24, 0xea,
-    0xf6, 0x4f, 0xd1, 0xc0, 0x18, 0x20, 0xe1, 0x24, 0x2c, 0xd8, 0x4d, 0x8b, 0xea, 0xd0, 0x22, 0x29,
-    0xd2, 0x0c, 0x14, 0x79, 0x98, 0x53, 0xf0, 0x3c, 0x2d, 0xc0, 0xb5, 0xa4, 0x2d, 0xc7, 0xd0, 0xbf,
-    0xf4, 0x56, 0x84, 0x3d, 0x82, 0xc0, 0x77, 0xc4, 0x5c, 0x17, 0x0e, 0x44, 0xce, 0x37, 0x2c, 0xe2,
-    0x31, 0x6d, 0x52, 0xf0, 0x07, 0x1d, 0x1d, 0x62, 0xe2, 0x23, 0xb7, 0x5a, 0xae, 0x86, 0x5b, 0x18,
-    0x26, 0x14, 0x55, 0x42, 0x30, 0x77, 0xe0, 0x70, 0xf4, 0x9f, 0xdb, 0x97, 0x8a, 0x7e, 0x2d, 0x9a,
-    0xef, 0x5d, 0xd4, 0x04, 0x56, 0x45, 0x5b, 0xa5, 0x05, 0x04, 0x97, 0xa7, 0xed, 0xfd, 0xb1, 0xf3,
-    0x0a, 0xa4, 0xaa, 0x28, 0x01, 0xf4, 0x31, 0x0d, 0xc5, 0xf8, 0x28, 0x3e, 0xd4, 0x0d, 0x2c, 0xb1,
-    0x2a, 0x53, 0xe0, 0x7f, 0x2d, 0x27, 0xfb, 0x0c, 0x96, 0xc2, 0xbc, 0x55, 0x72, 0x8f, 0xa7, 0xed,
-    0x1b, 0x8f, 0x72, 0x50, 0x42, 0xb7, 0xe4, 0x90, 0xb5, 0x72, 0x50, 0x18, 0x7a, 0x79, 0xf9, 0xc5,
-    0xe3, 0x3e, 0xd1, 0x4b, 0x8b, 0x02, 0x5c, 0x05, 0x1f, 0x67, 0xb6, 0xf7, 0x9a, 0x13, 0x55, 0x24,
-    0x49, 0x84, 0xb7, 0x43, 0x44, 0xc7, 0x7b, 0x1a, 0x3f, 0x80, 0x1e, 0xa8, 0x6b, 0x23, 0x60, 0xf9,
-    0xf7, 0x58, 0x63, 0x7a, 0xab, 0x7c, 0xb6, 0xa3, 0x29, 0x0e, 0xf9, 0x86, 0xd6, 0xf7, 0x30, 0xbd,
-    0x5c, 0x3c, 0x9f, 0x1b, 0x1c, 0x6c, 0x5a, 0x28, 0xd2, 0x1a, 0x81, 0x06, 0x27, 0xae, 0x42, 0x1f,
-    0xa5, 0x40, 0xb9, 0xfa, 0x61, 0x1e, 0x03, 0x47, 0xe3, 0xbd, 0x95, 0xc7, 0x4c, 0x9c, 0xdb, 0x94,
-    0x66, 0x49, 0x64, 0xd7, 0x74, 0x55, 0x77, 0xc4, 0x0b, 0x13, 0xbc, 0x60, 0xb8, 0xf0, 0x73, 0x6c,
-    0x8e, 0xfb, 0x1b, 0xd9, 0xc9, 0xfc, 0xad, 0x9d, 0x07, 0x16, 0x8a, 0x86, 0xb5, 0x88, 0x06, 0x2f,
-    0x66, 0x44, 0x65, 0x96, 0xc5, 0x8f, 0x0d, 0x48, 0x60, 0x13, 0xac, 0x09, 0xf3, 0x18, 0xb6, 0xd5,
-    0x71, 0xed, 0xe4, 0xcb, 0x03, 0xb5, 0xeb, 0x64, 0xca, 0xbc, 0x63, 0x53, 0x66, 0x69, 0xe2, 0x34,
-    0x69, 0x06, 0xca, 0xde, 0xdb, 0x89, 0x13, 0x54, 0x83, 0xa0, 0x26, 0x33, 0x70, 0x22, 0xce, 0x64,
-    0x19, 0xf0, 0x7f, 0x56, 0xcc, 0xa3, 0x64, 0x74, 0x47, 0x8b, 0xc4, 0x6d, 0xe1, 0xff, 0xfd, 0x71,
-    0x10, 0xa8, 0x68, 0x1e, 0x7c, 0xcd, 0x44, 0x38, 0x15, 0xb7, 0xf3, 0xee, 0x8a, 0x53, 0xff, 0x2a,
-    0xcd, 0xab, 0xb2, 0x6e, 0x09, 0xf8, 0x6f, 0xc1, 0x2f, 0xe6, 0xa6, 0x72, 0xf2, 0xec, 0x3d, 0xa5,
-    0x49, 0xbb, 0x17, 0x1b, 0x24, 0x92, 0x62, 0xa4, 0xee, 0x52, 0x62, 0xc8, 0xee, 0x98, 0xd1, 0xb6,
-    0x45, 0x3b, 0xb1, 0x37, 0x99, 0x81, 0xc3, 0x88, 0xb8, 0x69, 0xc2, 0xd6, 0x00, 0x64, 0xb0, 0x56,
-    0x70, 0x19, 0x69, 0x0e, 0xce, 0xa4, 0xa9, 0x28, 0x4d, 0x22, 0xec, 0x7b, 0x7e, 0xa8, 0x29, 0xfd,
-    0x05, 0x2c, 0xd8, 0xfd, 0xb6, 0x4e, 0xf3, 0xd2, 0x7d, 0xfb, 0x7d, 0x5d, 0x02, 0x37, 0x58, 0xcb,
-    0x5b, 0xf7, 0x8f, 0x14, 0x78, 0xc2, 0x1c, 0x2e, 0xeb, 0x24, 0x99, 0x8b, 0xb6, 0xf4, 0x8e, 0x96,
-    0x8e, 0xd1, 0x4c, 0xaf, 0xf5, 0xb6, 0x6d, 0x46, 0x51, 0x23, 0xc4, 0x00, 0xac, 0x01, 0x03, 0x72,
-    0x00, 0x0c, 0xed, 0x71, 0x67, 0x53, 0x97, 0x4f, 0xce, 0x53, 0x4d, 0xaa, 0xa8, 0x1b, 0xa3, 0x35,
-    0xdb, 0x20, 0x3b, 0x79, 0xb3, 0x7d, 0xc1, 0x93, 0x3a, 0xcb, 0xf1, 0xc3, 0x56, 0x06, 0x81, 0xc3,
-    0x80, 0x8a, 0x3b, 0x3b, 0xe0, 0xd5, 0x43, 0x28, 0x3a, 0xc6, 0x46, 0x9c, 0x7e, 0x97, 0xd3, 0x24,
-    0x25, 0x0e, 0x6c, 0x5d, 0x3c, 0x4c, 0xfb, 0xc0, 0x30, 0xec, 0x41, 0x18, 0x1c, 0xb6, 0x86, 0x30,
-    0x91, 0xcb, 0xf0, 0xc6, 0xb5, 0x74, 0x88, 0x00, 0xeb, 0xe6, 0xc8, 0x63, 0x28, 0xa7, 0x13, 0x94,
-    0x2a, 0xbe, 0xd3, 0xa4, 0xac, 0x68, 0x4d, 0xbc, 0xb2, 0xc8, 0x5e, 0x9c, 0xd0, 0x2b, 0x3d, 0xd8,
-    0x19, 0x44, 0x80, 0xd6, 0xc1, 0x3f, 0x81, 0x12, 0x21, 0xb1, 0xce, 0x67, 0xa0, 0x76, 0xa2, 0xef,
-    0x20, 0x61, 0x0e, 0xde, 0x74, 0x78, 0x52, 0x9f, 0x03, 0xf4, 0xa2, 0x3c, 0xcf, 0xd1, 0xcb, 0x0c,
-    0x3d, 0xe3, 0xf6, 0x05, 0x7a, 0x5e, 0xa2, 0xe7, 0xf5, 0xf0, 0xec, 0x2b, 0x98, 0xd4, 0x09, 0xd5,
-    0x59, 0x02, 0xe5, 0x6d, 0xa6, 0xbc, 0xcd, 0x95, 0xb7, 0x85, 0xf2, 0xb6, 0x54, 0xde, 0x56, 0xca,
-    0xdb, 0x5a, 0x79, 0xbb, 0xc3, 0x6f, 0x81, 0xfa, 0x32, 0x43, 0xcf, 0xc3, 0xb2, 0x02, 0x85, 0xfc,
-    0x40, 0x21, 0x38, 0x50, 0x31, 0x28, 0x04, 0x07, 0x0a, 0xc1, 0x33, 0xf5, 0x05, 0x3f, 0x2f, 0xd0,
-    0xf3, 0xc0, 0x35, 0x65, 0xf4, 0x1c, 0x01, 0x2d, 0x30, 0xff, 0x14, 0x36, 0x2c, 0x14, 0xa8, 0x25,
-    0x7a, 0x1e, 0xd0, 0x2a, 0x9c, 0x5a, 0x61, 0x54, 0x2b, 0xb5, 0x67, 0x18, 0xa2, 0x30, 0x90, 0xf1,
-    0x4f, 0x77, 0x23, 0x22, 0x0e, 0x88, 0x14, 0x1d, 0x94, 0x6d, 0x5a, 0x10, 0x06, 0x71, 0x97, 0xee,
-    0x6d, 0x14, 0x6f, 0xa5, 0x44, 0xca, 0x5f, 0x4a, 0x16, 0x92, 0x76, 0xbe, 0xcb, 0xf9, 0x1c, 0x43,
-    0xd2, 0xd2, 0x7c, 0xfc, 0x5a, 0x10, 0x72, 0x3f, 0x92, 0x3f, 0x9c, 0x7a, 0x49, 0x33, 0x42, 0x85,
-    0x73, 0x9c, 0x4f, 0xa6, 0xcb, 0xe5, 0xea, 0x3d, 0xea, 0x42, 0xcb, 0x0e, 0x06, 0xb8, 0xf5, 0x64,
-    0x06, 0xff, 0x61, 0xb8, 0xb5, 0x22, 0x3f, 0x09, 0x36, 0x0d, 0x26, 0x0b, 0x0c, 0xb4, 0x54, 0x64,
-    0xd6, 0x01, 0x2d, 0x27, 0x4b, 0x6d, 0xd2, 0x85, 0xec, 0x0a, 0xfc, 0xa1, 0x75, 0x31, 0x8c, 0x08,
-    0xfc, 0xc9, 0x5a, 0x9b, 0x7e, 0xae, 0x88, 0xad, 0x83, 0x43, 0x93, 0xaf, 0x50, 0xf3, 0x9d, 0xb1,
-    0xca, 0x99, 0x22, 0x42, 0x09, 0x37, 0x9b, 0x69, 0xab, 0xc4, 0x4a, 0x77, 0x87, 0xe0, 0x56, 0x78,
-    0x95, 0x41, 0x4f, 0xfd, 0x1c, 0x51, 0xaf, 0x5a, 0x36, 0x53, 0xcc, 0x0e, 0x68, 0xaa, 0xaf, 0x1e,
-    0x8b, 0x63, 0x61, 0x2c, 0x14, 0x39, 0x04, 0x24, 0x8f, 0x05, 0x9e, 0x0a, 0x09, 0x60, 0x61, 0x08,
-    0x74, 0xae, 0x6b, 0x75, 0x07, 0xa9, 0x8b, 0x74, 0xd6, 0xaf, 0x63, 0x89, 0x91, 0x6b, 0x66, 0xb4,
-    0xee, 0x60, 0x54, 0x49, 0x2f, 0x35, 0x77, 0xd1, 0x41, 0x19, 0xa2, 0x46, 0x62, 0x59, 0x19, 0x52,
-    0x5d, 0x6b, 0x9e, 0xa0, 0x03, 0xc4, 0x33, 0x21, 0x39, 0xac, 0x74, 0xb9, 0xce, 0xfb, 0x25, 0xac,
-    0xd1, 0x12, 0x02, 0x4d, 0x14, 0xcb, 0x0e, 0x46, 0x17, 0xb7, 0xea, 0xc0, 0x56, 0xfd, 0x5a, 0xd7,
-    0x8a, 0xbc, 0x55, 0x2f, 0x1d, 0x20, 0xa1, 0xdc, 0xe9, 0xa2, 0x0d, 0x90, 0x64, 0xee, 0x0c, 0xd1,
-    0x5a, 0xf7, 0x1c, 0xd5, 0x35, 0x2e, 0xfa, 0x05, 0xf1, 0x44, 0x1e, 0x07, 0x8e, 0xf6, 0x14, 0x5a,
-    0x38, 0x86, 0xe8, 0x69, 0x9f, 0xb6, 0x94, 0x3b, 0x1c, 0x16, 0xb0, 0xf1, 0xad, 0x5d, 0x73, 0x37,
-    0x39, 0x04, 0x52, 0x19, 0x15, 0x1e, 0x47, 0xb4, 0xc4, 0x94, 0xe5, 0x02, 0x5a, 0x6a, 0xd0, 0x47,
-    0x04, 0x07, 0x70, 0x21, 0x5e, 0x52, 0x93, 0x9d, 0xc8, 0xb7, 0x95, 0x66, 0x91, 0xc6, 0xc8, 0x0e,
-    0x16, 0xf5, 0x5b, 0x5a, 0x1b, 0xb3, 0x51, 0x6f, 0x50, 0x96, 0x67, 0xc9, 0x1f, 0xfa, 0xf0, 0x30,
-    0x1a, 0xe2, 0x42, 0x34, 0xc2, 0xe3, 0xc9, 0xdc, 0x6f, 0x88, 0xe3, 0x2e, 0x85, 0x10, 0x0a, 0xfa,
-    0xf1, 0x68, 0x42, 0x8a, 0x05, 0xfb, 0x5e, 0x9c, 0x42, 0xca, 0x24, 0x94, 0x05, 0xa3, 0x7d, 0x3c,
-    0xcc, 0xe2, 0x60, 0x46, 0x9d, 0x4c, 0xf2, 0xe7, 0xf3, 0xb9, 0x7c, 0xac, 0x77, 0x1b, 0xf2, 0xc1,
-    0x77, 0xd9, 0x6f, 0xb2, 0xbe, 0x89, 0x8c, 0x28, 0xfb, 0xdd, 0xdd, 0xdd, 0x5d, 0xd7, 0x8a, 0xea,
-    0x17, 0x91, 0x51, 0xdc, 0x78, 0xf7, 0x69, 0xc9, 0x7e, 0x62, 0xfd, 0x43, 0x60, 0x2f, 0x04, 0x20,
-    0xf3, 0x08, 0x96, 0x64, 0x1d, 0x9a, 0x10, 0x22, 0x75, 0x95, 0x9f, 0xbc, 0xac, 0xa5, 0xf0, 0x20,
-    0x34, 0xd9, 0x22, 0x8b, 0x5f, 0xdb, 0x34, 0x03, 0xae, 0x87, 0x24, 0xab, 0xf6, 0xe4, 0x43, 0xc9,
-    0xd8, 0xd3, 0xbe, 0x7c, 0x7d, 0xe7, 0xdf, 0x60, 0x8a, 0xd2, 0x9c, 0xec, 0x68, 0x1f, 0xd5, 0x32,
-    0xa5, 0x25, 0x35, 0x70, 0x15, 0x66, 0x07, 0xd2, 0x3f, 0xa0, 0x65, 0xb8, 0x78, 0xf9, 0xfe, 0xe2,
-    0xc6, 0x01, 0xc7, 0xaa, 0xb4, 0x4d, 0x6f, 0x2c, 0x88, 0xff, 0x4d, 0x84, 0xea, 0xda, 0x65, 0x6d,
-    0x4f, 0x59, 0xa9, 0x68, 0x13, 0x89, 0xd8, 0x9e, 0x24, 0x10, 0x37, 0xfb, 0x0e, 0xfb, 0x31, 0xb1,
-    0x28, 0xc8, 0x60, 0x82, 0xb4, 0x80, 0xec, 0xc8, 0x65, 0xbd, 0x4b, 0xad, 0x37, 0x90, 0x9d, 0xd1,
-    0x50, 0x13, 0x94, 0x05, 0x9e, 0x5f, 0xef, 0x54, 0x1a, 0xba, 0xcc, 0xdb, 0xb5, 0xb6, 0x86, 0x16,
-    0x12, 0x87, 0x4e, 0x8b, 0xfe, 0xf6, 0x7d, 0xa6, 0x5c, 0x51, 0x92, 0x2f, 0x95, 0x4a, 0xe8, 0x87,
-    0xce, 0x62, 0xde, 0x6a, 0x15, 0xf5, 0x1c, 0x44, 0x2d, 0x9f, 0xc3, 0xc9, 0xbc, 0x73, 0x22, 0x90,
-    0xca, 0x82, 0x73, 0x81, 0x0c, 0x83, 0xca, 0x5c, 0x58, 0xb0, 0x8d, 0xa3, 0x91, 0x0e, 0xc6, 0xa3,
-    0x8f, 0x20, 0xa0, 0xc6, 0x74, 0x00, 0x9e, 0x48, 0xf5, 0xd4, 0xf2, 0x9d, 0x02, 0x50, 0x41, 0xa6,
-    0x45, 0xea, 0x17, 0x75, 0x95, 0xc2, 0x9f, 0x00, 0xd3, 0x88, 0x15, 0x96, 0x58, 0x81, 0xcd, 0xa2,
-    0x20, 0xc8, 0x63, 0xb5, 0xa6, 0xab, 0xce, 0x32, 0xb7, 0xdb, 0xad, 0xc5, 0xd7, 0x38, 0x8a, 0xe1,
-    0xff, 0xc7, 0x23, 0xbf, 0x2e, 0x87, 0xd6, 0xec, 0x74, 0x78, 0xe7, 0x29, 0x2d, 0x72, 0x0a, 0xd3,
-    0xe9, 0x74, 0xac, 0x4f, 0xd5, 0xc0, 0x4b, 0x6b, 0x09, 0xb7, 0x69, 0xdd, 0xb4, 0x5e, 0xbc, 0x4f,
-    0xb3, 0x2e, 0x09, 0xf7, 0x80, 0x4a, 0x2f, 0xa3, 0xdb, 0x16, 0xb9, 0x8b, 0x48, 0x29, 0x91, 0xea,
-    0xbd, 0x17, 0x27, 0x81, 0x98, 0xd5, 0x32, 0x07, 0xa7, 0x7c, 0x7c, 0x92, 0xb1, 0xee, 0x5a, 0x96,
-    0xdd, 0x7a, 0x25, 0x19, 0x2a, 0x2a, 0xa2, 0xda, 0x51, 0x41, 0x84, 0xcc, 0x84, 0x71, 0x6f, 0x54,
-    0x5c, 0x44, 0x3f, 0xcd, 0x49, 0x9a, 0x8d, 0x75, 0x1e, 0xea, 0xd1, 0xae, 0x84, 0xb4, 0x74, 0xac,
-    0x2f, 0x07, 0xbf, 0xbf, 0x1f, 0xeb, 0x84, 0x1d, 0x68, 0x74, 0x20, 0x43, 0x7a, 0x4d, 0xbf, 0x07,
-    0x9b, 0x3e, 0x19, 0x25, 0xed, 0x89, 0xd2, 0x87, 0xd1, 0xd9, 0xe9, 0xe8, 0x30, 0xae, 0xf3, 0x63,
-    0x9d, 0xb2, 0x62, 0x36, 0xd2, 0x2b, 0x4b, 0x4a, 0xa3, 0x73, 0x3e, 0xb7, 0x4a, 0x9f, 0x2c, 0xbc,
-    0xa2, 0x96, 0xbe, 0x06, 0xab, 0xec, 0x91, 0x93, 0x25, 0x6c, 0x92, 0xd6, 0x78, 0xc7, 0xdc, 0x19,
-    0xe3, 0x38, 0xc6, 0xbe, 0x86, 0xfb, 0x5a, 0xe9, 0xa4, 0x67, 0xf0, 0xe7, 0x5d, 0x92, 0x24, 0x9a,
-    0x41, 0xcd, 0x41, 0x8b, 0xec, 0xd1, 0x91, 0xbd, 0xe6, 0xa6, 0x2f, 0x0e, 0x57, 0xec, 0xfe, 0xcb,
-    0x74, 0x8f, 0xe8, 0xba, 0x90, 0xe0, 0x40, 0x4b, 0xc0, 0x68, 0x59, 0xf4, 0x91, 0x8a, 0x9d, 0x74,
-    0x65, 0xcf, 0x18, 0xb5, 0x9e, 0xb3, 0x50, 0xc2, 0x86, 0xce, 0x82, 0x30, 0x4b, 0x3a, 0x0b, 0xc0,
-    0xed, 0xe9, 0x2c, 0x84, 0xb0, 0xaa, 0xb3, 0x20, 0xdc, 0x76, 0x2e, 0x4e, 0x73, 0x3d, 0x94, 0xb4,
-    0xb3, 0xb3, 0xb0, 0xdc, 0xda, 0xce, 0x53, 0x45, 0x2f, 0xa0, 0x10, 0x72, 0x3b, 0x0b, 0xd2, 0x55,
-    0xac, 0xcf, 0xc1, 0x74, 0x85, 0xdd, 0xf3, 0xb4, 0x80, 0x2d, 0x9a, 0x10, 0x32, 0x1c, 0x37, 0xda,
-    0x3b, 0xbb, 0x14, 0x3d, 0xc3, 0x59, 0xa7, 0x16, 0xc5, 0x4c, 0x83, 0xbb, 0x1f, 0x3e, 0x7d, 0x3b,
-    0xa2, 0x95, 0x10, 0x38, 0x5c, 0x60, 0x77, 0x7f, 0x06, 0x70, 0x16, 0x4a, 0x1c, 0x0a, 0x68, 0x94,
-    0xc8, 0xa9, 0x1d, 0xb6, 0x73, 0x32, 0xa3, 0xc1, 0x34, 0x88, 0xc7, 0x0e, 0xb9, 0x6b, 0xf4, 0x70,
-    0x84, 0xdd, 0x49, 0x15, 0x37, 0x5c, 0xdf, 0x5a, 0x24, 0xb6, 0xdb, 0x0d, 0x3a, 0x36, 0xb9, 0x60,
-    0x3b, 0x17, 0x21, 0x85, 0xfd, 0x5c, 0x04, 0x63, 0x36, 0x74, 0x11, 0x88, 0xdb, 0xd1, 0x45, 0x28,
-    0x61, 0x4b, 0x17, 0xc1, 0xb8, 0xa5, 0x5c, 0x35, 0xe5, 0xeb, 0x20, 0xa5, 0x5d, 0x5d, 0x84, 0xe7,
-    0xb6, 0x75, 0x99, 0x4a, 0x7a, 0x05, 0x2a, 0x61, 0x63, 0x17, 0xc1, 0xa4, 0x9d, 0x5d, 0x84, 0x93,
-    0xb6, 0x76, 0x05, 0x6d, 0x60, 0x6f, 0x76, 0x28, 0x61, 0x73, 0xf6, 0xbe, 0xce, 0xee, 0xcc, 0x63,
-    0x38, 0x25, 0xb6, 0x36, 0xc2, 0x57, 0x4a, 0x68, 0x02, 0x1d, 0xf2, 0x2d, 0x26, 0x49, 0x90, 0xcc,
-    0x4c, 0xb3, 0x04, 0xc4, 0x09, 0xcb, 0x7a, 0x6d, 0xe4, 0x58, 0xfb, 0x7a, 0x72, 0xfa, 0x5e, 0x4b,
-    0xe8, 0x4c, 0x29, 0xed, 0x26, 0x5e, 0xad, 0x56, 0x9a, 0x87, 0x80, 0x6d, 0xce, 0xb4, 0x26, 0x6e,
-    0xca, 0xb0, 0xe5, 0x3d, 0xc2, 0xee, 0x9b, 0x8c, 0xb9, 0x23, 0x5b, 0xbf, 0xea, 0x96, 0x3a, 0x08,
-    0x79, 0x80, 0xfb, 0x6e, 0x73, 0x37, 0x27, 0xf3, 0xb5, 0x46, 0x00, 0xbd, 0x9b, 0x05, 0x41, 0x72,
-    0xd9, 0x45, 0x75, 0xc8, 0x5e, 0xe3, 0xb0, 0xae, 0x1a, 0x83, 0xdd, 0x97, 0x3a, 0xa0, 0x73, 0x66,
-    0xe3, 0xa4, 0xca, 0x03, 0x63, 0x79, 0x9a, 0x15, 0xf0, 0x53, 0xf9, 0xb1, 0x58, 0xc2, 0x90, 0xcb,
-    0x90, 0xc4, 0x60, 0x39, 0xe7, 0x87, 0xac, 0x4d, 0x2b, 0x76, 0xe1, 0x01, 0x9f, 0x74, 0x22, 0xb8,
-    0x8c, 0x6c, 0x68, 0xa6, 0x7a, 0x47, 0x87, 0x45, 0x14, 0x18, 0xa6, 0x3f, 0x0f, 0xec, 0x73, 0x16,
-    0xf5, 0xcc, 0xcf, 0x17, 0xc7, 0x7d, 0x7a, 0xe1, 0x46, 0xe0, 0x17, 0x67, 0x7d, 0x8a, 0xc3, 0x8d,
-    0xd0, 0xd1, 0xdd, 0x80, 0x89, 0x3b, 0x66, 0x31, 0x43, 0x77, 0x2d, 0x83, 0x35, 0x76, 0xca, 0x36,
-    0x9b, 0xcd, 0x22, 0xf3, 0xd2, 0x86, 0x64, 0x09, 0x5d, 0xb0, 0x1f, 0x9a, 0x97, 0x1d, 0x4f, 0xc5,
-    0x0f, 0x34, 0x19, 0x3d, 0x75, 0x35, 0x81, 0xc6, 0x13, 0x09, 0x1b, 0x9c, 0x91, 0x50, 0xd8, 0x80,
-    0xb4, 0xc4, 0xc2, 0x06, 0xa2, 0x27, 0x18, 0x36, 0x18, 0x23, 0xd1, 0xb0, 0x01, 0xe9, 0x09, 0xc5,
-    0xd8, 0x64, 0xaf, 0x81, 0x33, 0x13, 0x10, 0x1b, 0xb4, 0x9e, 0x88, 0x58, 0xa9, 0xa3, 0x17, 0xd1,
-    0x18, 0x89, 0x89, 0x0d, 0x88, 0x9b, 0xf0, 0x05, 0x18, 0x33, 0x89, 0xb1, 0x41, 0x99, 0xc9, 0x8c,
-    0x9d, 0x6e, 0x35, 0xa9, 0xe9, 0x61, 0xb8, 0xdd, 0xd8, 0x3a, 0x8c, 0xac, 0xa7, 0xef, 0xe9, 0xb3,
-    0x1f, 0xd5, 0x18, 0x3a, 0xdb, 0xe3, 0xe7, 0xe6, 0xd8, 0x76, 0x44, 0xb6, 0x02, 0x03, 0x45, 0xd3,
-    0x9e, 0x66, 0x95, 0x27, 0xd2, 0x0c, 0xd7, 0x02, 0x24, 0x6e, 0xbd, 0x58, 0x3a, 0x4c, 0x82, 0xba,
-    0x9e, 0x8e, 0x20, 0xdc, 0x97, 0xd3, 0xa6, 0x21, 0x3b, 0x2a, 0x27, 0xba, 0xea, 0x26, 0x97, 0x48,
-    0xa7, 0x6c, 0x84, 0xf7, 0x2b, 0x36, 0x6b, 0x22, 0xe3, 0xeb, 0x94, 0x97, 0xc0, 0x64, 0x45, 0x56,
-    0x73, 0x08, 0x6a, 0x9a, 0x73, 0x6e, 0xa4, 0xf4, 0x6c, 0xa8, 0x04, 0xce, 0x8b, 0x08, 0xf6, 0x84,
-    0xcd, 0x9e, 0x20, 0x76, 0x6e, 0x6a, 0xb8, 0xcc, 0xe5, 0xb3, 0x82, 0x2e, 0x2b, 0x0b, 0x5e, 0x24,
-    0xa2, 0xe9, 0xef, 0x46, 0x49, 0xa7, 0x0a, 0x43, 0xa7, 0xaa, 0x5b, 0x15, 0x8f, 0x5c, 0x6e, 0x1e,
-    0x77, 0xe5, 0x34, 0x31, 0x36, 0x15, 0x0b, 0xcc, 0x51, 0x2b, 0xec, 0x02, 0x75, 0x7a, 0xc9, 0xd9,
-    0x9c, 0x45, 0xb0, 0x44, 0x73, 0xe4, 0xbd, 0x23, 0xf5, 0x6d, 0x11, 0xb5, 0x18, 0xa2, 0xab, 0x95,
-    0xd2, 0x39, 0xa2, 0xd1, 0x1d, 0x39, 0x0c, 0xef, 0xc0, 0x39, 0xdf, 0xf1, 0xa6, 0xa8, 0xa2, 0xd3,
-    0x95, 0xbb, 0xcc, 0xfb, 0x6b, 0xfc, 0x8e, 0x9a, 0x35, 0xc8, 0x47, 0x24, 0x99, 0x9b, 0xb0, 0x8d,
-    0x30, 0xb9, 0xf3, 0x7e, 0x01, 0x0e, 0x26, 0xf4, 0x39, 0x9c, 0x5d, 0x40, 0x39, 0xd4, 0xc5, 0x2e,
-    0x23, 0x46, 0x35, 0x34, 0x46, 0xb0, 0xb9, 0x34, 0x48, 0xe0, 0x1d, 0xf6, 0xc7, 0xef, 0xb7, 0x35,
-    0x75, 0x67, 0x3c, 0x3b, 0x3f, 0x2a, 0x9f, 0xbd, 0x86, 0x14, 0x5c, 0x75, 0x1b, 0xa5, 0xea, 0x4a,
-    0x6a, 0x5e, 0x41, 0x81, 0x36, 0xab, 0x17, 0x98, 0x72, 0x06, 0x36, 0x48, 0x86, 0x5c, 0x9c, 0x5e,
-    0x56, 0x5c, 0x3b, 0xbf, 0x38, 0xd3, 0xfd, 0xa2, 0x62, 0x38, 0x53, 0xf3, 0x04, 0xcd, 0x80, 0xb1,
-    0x9d, 0x35, 0x1a, 0x40, 0xf8, 0x58, 0x73, 0x14, 0x68, 0xea, 0x05, 0xc6, 0x11, 0xad, 0x05, 0x68,
-    0xd6, 0x1f, 0x39, 0x9f, 0x01, 0x32, 0x8f, 0xb5, 0x11, 0xd0, 0x88, 0xb3, 0xbf, 0xc6, 0x3b, 0x4b,
-    0xeb, 0xe3, 0x05, 0x5b, 0x25, 0x82, 0x5a, 0x2e, 0x97, 0x23, 0x8e, 0x6e, 0x38, 0xc1, 0x9a, 0xac,
-    0x57, 0x9a, 0x8b, 0x95, 0x53, 0x6a, 0x26, 0x8e, 0x50, 0x1a, 0x83, 0xe5, 0x9d, 0x20, 0x7e, 0xe0,
-    0xd6, 0xc4, 0x35, 0xa5, 0x85, 0xb8, 0x1b, 0xd4, 0x5f, 0xda, 0x72, 0xc2, 0xf9, 0x1a, 0x5c, 0xc3,
-    0xcd, 0x11, 0x2d, 0x5b, 0x1e, 0x55, 0x28, 0x37, 0x1c, 0x3b, 0x0d, 0x58, 0x19, 0x3e, 0xf7, 0x6c,
-    0x58, 0xf7, 0xff, 0xba, 0xf0, 0xff, 0x76, 0x5d, 0x18, 0xa7, 0x1c, 0x4a, 0xa4, 0x6f, 0xbd, 0xba,
-    0x87, 0x3c, 0x92, 0x29, 0x6e, 0xd4, 0x6b, 0x97, 0xb7, 0x01, 0xa0, 0x08, 0xdc, 0xe8, 0x45, 0x12,
-    0x37, 0xfa, 0xb0, 0xc8, 0x8d, 0x4e, 0x45, 0xe6, 0x46, 0x2f, 0x16, 0xaa, 0x15, 0xef, 0x55, 0x00,
-    0xaa, 0xd8, 0x0d, 0x30, 0x2c, 0x77, 0x93, 0x02, 0x3a, 0x3e, 0x50, 0x91, 0xbc, 0xd1, 0xab, 0x8a,
-    0xde, 0xe8, 0x56, 0x65, 0x6f, 0x99, 0xf7, 0xb9, 0x37, 0xe4, 0x4e, 0xd6, 0x97, 0x83, 0x27, 0x25,
-    0x82, 0xb3, 0x28, 0x0a, 0x0a, 0xea, 0x98, 0x97, 0x8b, 0xc6, 0xb2, 0xcb, 0xdf, 0x10, 0xa5, 0xbd,
-    0xd6, 0x15, 0x5f, 0xe1, 0x9d, 0x05, 0x55, 0xc8, 0x4d, 0xf2, 0x64, 0x59, 0x29, 0xdf, 0x43, 0x06,
-    0xbd, 0x06, 0xcf, 0x29, 0x27, 0x67, 0x37, 0x82, 0xbd, 0x6d, 0xfa, 0x0c, 0xb1, 0x5e, 0x1f, 0x1d,
-    0xf1, 0xd7, 0x88, 0xfb, 0x74, 0x9f, 0x47, 0x48, 0x7e, 0xa4, 0x47, 0x35, 0x7c, 0x58, 0xda, 0xd2,
-    0xdc, 0x45, 0xef, 0x59, 0xda, 0xb4, 0x47, 0x23, 0xc6, 0x3a, 0xe9, 0x10, 0xec, 0x2f, 0xf9, 0x3d,
-    0x03, 0x3f, 0xbf, 0x35, 0x32, 0x7d, 0x5f, 0x9f, 0x04, 0x5d, 0xd8, 0xe8, 0x81, 0x65, 0x8d, 0x01,
-    0xb1, 0x9e, 0x83, 0xb3, 0x8f, 0x4c, 0x00, 0x52, 0x25, 0xab, 0x78, 0xd0, 0x18, 0x64, 0xbd, 0xc4,
-    0x60, 0x5e, 0x75, 0x51, 0x10, 0x97, 0x75, 0xfa, 0x05, 0xf8, 0x4a, 0x32, 0x14, 0x05, 0x5c, 0x3d,
-    0xc6, 0xd1, 0x99, 0x60, 0xdb, 0x4e, 0x2f, 0x0f, 0xb5, 0xac, 0xce, 0x0e, 0xa8, 0x8b, 0xc6, 0x0e,
-    0xd5, 0xd0, 0x8a, 0x00, 0x07, 0xca, 0xfa, 0xec, 0x15, 0xa0, 0x73, 0x29, 0x58, 0x3f, 0x99, 0x3e,
-    0xf9, 0xd1, 0xe6, 0x60, 0x79, 0x2f, 0x8f, 0xdd, 0x6a, 0xed, 0x3c, 0x7e, 0x08, 0xcd, 0xc9, 0xa6,
-    0x29, 0xb3, 0x43, 0x4b, 0x85, 0xfe, 0x71, 0x26, 0x0b, 0x15, 0x34, 0xd5, 0xc4, 0xae, 0x95, 0xf6,
-    0xa5, 0xf6, 0xb3, 0x22, 0xb5, 0xe6, 0x67, 0xe3, 0x42, 0x98, 0xf2, 0x7e, 0x0d, 0xc6, 0x23, 0x6e,
-    0x45, 0x7c, 0x63, 0xc1, 0x81, 0x19, 0xcb, 0x0b, 0xa7, 0xe2, 0x82, 0x8b, 0xb8, 0x0e, 0x61, 0x1b,
-    0xa0, 0xe7, 0x2c, 0xfa, 0x5a, 0x15, 0xf2, 0x49, 0xd3, 0x8f, 0xfb, 0x46, 0xd3, 0xe2, 0x90, 0x6c,
-    0xdb, 0xe1, 0xfa, 0x92, 0x8c, 0xba, 0x16, 0x3c, 0xea, 0x12, 0xb7, 0xa5, 0xdf, 0xfe, 0x1a, 0x2c,
-    0xbe, 0x5b, 0xbf, 0x45, 0x0e, 0x80, 0x7f, 0xea, 0x73, 0x85, 0x62, 0x5d, 0x9e, 0x55, 0x99, 0xe3,
-    0xd3, 0x5b, 0x8c, 0x13, 0x22, 0x2f, 0xf6, 0x19, 0x1a, 0xfb, 0x3e, 0xad, 0xfb, 0x40, 0xc5, 0x7b,
-    0x09, 0x45, 0x6b, 0xd4, 0xb7, 0x3c, 0x77, 0x1f, 0xf4, 0x58, 0x47, 0x8e, 0x5a, 0xc8, 0x19, 0xd3,
-    0x78, 0x1d, 0xa2, 0xcb, 0xa6, 0x66, 0x5f, 0x92, 0xe5, 0x0a, 0x1c, 0x5a, 0xa5, 0x58, 0x13, 0x5e,
-    0x25, 0x57, 0x2b, 0x76, 0x4f, 0xad, 0x6f, 0x43, 0xce, 0xae, 0xff, 0x3c, 0xa4, 0xef, 0xe3, 0x13,
-    0x31, 0x7d, 0x6e, 0xcb, 0x43, 0xbc, 0x57, 0xf3, 0x6b, 0xff, 0x15, 0x74, 0xa2, 0xaf, 0x2f, 0x78,
-    0xdb, 0x86, 0xd4, 0x8a, 0x89, 0x5d, 0x6f, 0x23, 0x56, 0x17, 0xe1, 0x5a, 0xfd, 0x86, 0x59, 0x1b,
-    0x66, 0x15, 0xe3, 0xce, 0x37, 0x0f, 0x09, 0x98, 0x28, 0xb9, 0x5e, 0x26, 0x61, 0xc0, 0x2c, 0x9d,
-    0x6c, 0xd5, 0x7f, 0xce, 0x35, 0xe5, 0xdb, 0x71, 0x9f, 0xe2, 0x4f, 0x86, 0xfb, 0x72, 0xbf, 0x75,
-    0x49, 0xd6, 0x4a, 0x31, 0x2a, 0x5a, 0x63, 0x97, 0xab, 0x7f, 0x5a, 0x75, 0xa8, 0x2a, 0x5a, 0xc7,
-    0xa4, 0xe9, 0x0f, 0x28, 0x16, 0xcb, 0x45, 0xb2, 0x9c, 0x9f, 0x34, 0xdb, 0x39, 0x0e, 0xc7, 0x17,
-    0x56, 0x1f, 0x78, 0xae, 0xb6, 0xce, 0x21, 0xb5, 0xab, 0x5b, 0x67, 0xf7, 0xb8, 0x91, 0xd2, 0x8c,
-    0x82, 0xe7, 0xd8, 0xdf, 0xad, 0x5a, 0xd8, 0xba, 0x1d, 0xdd, 0xf6, 0xc5, 0xa5, 0xbc, 0xb3, 0x9f,
-    0x3a, 0x9e, 0xf5, 0x99, 0x0c, 0x89, 0x4e, 0xa8, 0x52, 0x4f, 0xb9, 0x38, 0x15, 0x3b, 0x05, 0x52,
-    0x5c, 0x86, 0xbc, 0x6a, 0xa5, 0x93, 0xea, 0x5e, 0x01, 0xc3, 0x3f, 0x9b, 0x63, 0xd7, 0xb4, 0xd0,
-    0xc7, 0x90, 0x02, 0x44, 0x7c, 0x5d, 0x4b, 0xf3, 0xaa, 0x7d, 0xf1, 0x62, 0x9a, 0x65, 0x4d, 0xd8,
-    0xec, 0xcb, 0x27, 0xdb, 0x89, 0xc8, 0x86, 0xfd, 0xf0, 0x28, 0x47, 0x7e, 0xee, 0x8a, 0x90, 0xca,
-    0x4f, 0xfd, 0xf8, 0xd7, 0x9a, 0xce, 0x7a, 0xf1, 0xfe, 0x76, 0xea, 0x10, 0xfd, 0x83, 0x9d, 0xbe,
-    0x72, 0xc5, 0x0f, 0x23, 0x8c, 0xeb, 0xb3, 0xca, 0x0c, 0x6d, 0x27, 0x7f, 0xf9, 0xba, 0xef, 0x0a,
-    0x73, 0x62, 0x93, 0xd4, 0xa9, 0xeb, 0x0a, 0x22, 0x42, 0xa3, 0xfb, 0xbb, 0x85, 0x68, 0x5b, 0xd0,
-    0xbf, 0x42, 0x8c, 0xf4, 0x0f, 0x0b, 0xc7, 0xea, 0x7c, 0x1d, 0x3d, 0x96, 0x02, 0x56, 0x47, 0x9b,
-    0xed, 0xce, 0x17, 0xbf, 0xd1, 0x25, 0xc9, 0x51, 0x31, 0x31, 0x65, 0xb6, 0x09, 0xdd, 0x67, 0x3f,
-    0xf4, 0xd1, 0xaa, 0x11, 0x88, 0xeb, 0x9f, 0x9e, 0xf2, 0x98, 0x5d, 0xa3, 0xf2, 0x1a, 0xc5, 0xe5,
-    0xb0, 0x5e, 0x99, 0x24, 0x1a, 0x97, 0xc1, 0x6b, 0xd7, 0x69, 0xc5, 0x2a, 0xcb, 0x75, 0x08, 0x09,
-    0x97, 0x58, 0xcf, 0x87, 0xa0, 0xf0, 0xa6, 0x37, 0x56, 0xcc, 0xef, 0xb6, 0x01, 0xfb, 0x29, 0x58,
-    0xc5, 0xea, 0x19, 0x8e, 0x9e, 0x13, 0xe6, 0x81, 0x92, 0xa9, 0x51, 0x68, 0x1c, 0xfb, 0xe2, 0xfa,
-    0x1b, 0xa0, 0x60, 0x28, 0x7b, 0x7d, 0xa3, 0xe3, 0xb2, 0xf1, 0x15, 0xbb, 0x43, 0x6d, 0x59, 0xb8,
-    0xa7, 0xd7, 0xa3, 0x41, 0x53, 0xa6, 0xfa, 0x45, 0xb9, 0x0b, 0xa4, 0x62, 0x74, 0xaf, 0x21, 0xf6,
-    0x5f, 0x54, 0xa5, 0x44, 0xa9, 0x41, 0x40, 0x00, 0x00
-};
-
-const uint8_t HttpPages::favicon[FAVICON_SIZE] = {
-    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
-    0x61, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x6d, 0x75, 0x00, 0x00, 0x73,
-    0xa0, 0x00, 0x00, 0xfc, 0xdd, 0x00, 0x00, 0x83, 0x64, 0x00, 0x00, 0x70, 0xe8, 0x00, 0x00, 0xec,
-    0x68, 0x00, 0x00, 0x30, 0x3e, 0x00, 0x00, 0x10, 0x90, 0xe4, 0xec, 0x99, 0xea, 0x00, 0x00, 0x00,
-    0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x43, 0xbb, 0x7f, 0x00,
-    0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01,
-    0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x09, 0x76, 0x70, 0x41, 0x67, 0x00, 0x00, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x5c, 0xc6, 0xad, 0xc3, 0x00, 0x00, 0x02, 0x17, 0x49, 0x44, 0x41,
-    0x54, 0x38, 0xcb, 0x8d, 0x90, 0x4f, 0x48, 0x93, 0x71, 0x1c, 0xc6, 0x9f, 0xdf, 0xbf, 0xf7, 0xf5,
-    0x5d, 0x8e, 0x35, 0x27, 0x94, 0xa7, 0x12, 0x8a, 0x4e, 0x05, 0x32, 0x50, 0x90, 0xfe, 0x30, 0xa1,
-    0x4b, 0x78, 0xe8, 0x14, 0xa4, 0xa6, 0xd0, 0x25, 0x6f, 0x19, 0x12, 0x42, 0x98, 0x21, 0xe9, 0x76,
-    0xd8, 0xa9, 0x43, 0x5e, 0x3a, 0x74, 0x75, 0xd0, 0x84, 0x6c, 0xa7, 0x4e, 0x91, 0x90, 0x87, 0x3c,
-    0x28, 0x83, 0xa2, 0xe5, 0x66, 0x46, 0xb2, 0x06, 0x19, 0x6e, 0x2e, 0x77, 0xd9, 0xde, 0xa7, 0x43,
-    0xfa, 0xe2, 0xf0, 0x4f, 0xfb, 0xc0, 0xf7, 0xf0, 0x85, 0xdf, 0xef, 0xc3, 0xf3, 0x7c, 0x21, 0x8d,
-    0xe1, 0xc9, 0x50, 0x88, 0xd1, 0x58, 0x8c, 0x97, 0x3a, 0x3a, 0x08, 0x80, 0x42, 0x6b, 0x6a, 0xdb,
-    0x6e, 0x68, 0x20, 0x8d, 0x61, 0xa0, 0xa5, 0x85, 0x85, 0x42, 0x81, 0xa5, 0x52, 0x89, 0xd1, 0x58,
-    0x8c, 0xa7, 0xda, 0xda, 0x08, 0x80, 0xd2, 0x98, 0xff, 0x0b, 0x94, 0x65, 0xb1, 0xc9, 0xe7, 0x63,
-    0x22, 0x91, 0xe0, 0x1e, 0xb9, 0xb5, 0x35, 0xde, 0x1b, 0x1e, 0xa6, 0xe3, 0xf3, 0x11, 0x00, 0x95,
-    0x65, 0x1d, 0x2d, 0xd0, 0xb6, 0x4d, 0x69, 0x0c, 0x95, 0x31, 0xbc, 0xdd, 0xd7, 0xc7, 0x74, 0x3a,
-    0xed, 0x89, 0x3e, 0x2c, 0x2e, 0xf2, 0x46, 0x6f, 0x2f, 0x21, 0x25, 0x21, 0xc4, 0xd1, 0x02, 0xa7,
-    0xb9, 0xd9, 0x8b, 0xed, 0x0f, 0x04, 0xf8, 0x70, 0x6c, 0x8c, 0xf9, 0x7c, 0xde, 0x13, 0xbd, 0x4a,
-    0x26, 0xd9, 0x11, 0x0e, 0x1f, 0x5a, 0x0b, 0xd2, 0x18, 0x06, 0x5b, 0x5b, 0xf9, 0x71, 0x69, 0x89,
-    0x4f, 0x26, 0x27, 0x19, 0x08, 0x06, 0x09, 0x80, 0x67, 0xda, 0xdb, 0xf9, 0x7c, 0x66, 0x86, 0x95,
-    0x4a, 0x85, 0x24, 0x59, 0x2e, 0x97, 0x19, 0x8f, 0xc7, 0x79, 0xc2, 0xef, 0xaf, 0xab, 0xe4, 0xdd,
-    0xe0, 0xf5, 0xfc, 0x3c, 0x49, 0x32, 0x93, 0xc9, 0xf0, 0xce, 0xe0, 0x20, 0x85, 0x52, 0x04, 0xc0,
-    0xce, 0xae, 0x2e, 0xbe, 0x49, 0xa5, 0xbc, 0x34, 0x0f, 0x46, 0x47, 0x09, 0xa0, 0xbe, 0x82, 0x32,
-    0x86, 0x4d, 0x3e, 0x1f, 0x07, 0x87, 0x86, 0xf8, 0x75, 0x75, 0x95, 0x24, 0xf9, 0x7e, 0x61, 0x81,
-    0x91, 0x9e, 0x9e, 0x7f, 0xb1, 0xb5, 0x66, 0x6a, 0x57, 0x32, 0x9b, 0x48, 0x1c, 0x14, 0x68, 0xdb,
-    0xa6, 0xb2, 0x2c, 0x02, 0x60, 0x30, 0x14, 0xe2, 0xa3, 0xf1, 0x71, 0x16, 0x8b, 0x45, 0x56, 0x6b,
-    0x35, 0xde, 0x1f, 0x19, 0x21, 0x00, 0x3e, 0x9d, 0x9e, 0x3e, 0x54, 0x20, 0xb1, 0x8b, 0x10, 0x02,
-    0xda, 0xb6, 0xb1, 0x55, 0x2c, 0x22, 0x3a, 0x35, 0x85, 0x6b, 0x91, 0x08, 0xfe, 0x94, 0xcb, 0x18,
-    0xe8, 0xef, 0x07, 0x00, 0x48, 0xe9, 0x3d, 0xad, 0x43, 0xef, 0x5f, 0x48, 0x42, 0x29, 0x05, 0x4a,
-    0x89, 0xe5, 0x95, 0x15, 0x7c, 0x5b, 0x5f, 0x87, 0xd2, 0x1a, 0xc7, 0xe1, 0x69, 0xdd, 0x6a, 0x15,
-    0x5a, 0x6b, 0x90, 0x2e, 0xe8, 0xba, 0x50, 0x4a, 0x79, 0xd2, 0xe3, 0xd0, 0x7b, 0x9f, 0xcf, 0x85,
-    0xbb, 0x71, 0xf5, 0xd6, 0x5d, 0xfc, 0xce, 0xff, 0xc0, 0xdb, 0x97, 0xcf, 0xb0, 0x53, 0xda, 0x42,
-    0x23, 0x48, 0x90, 0x90, 0x5a, 0xa3, 0xfb, 0xe6, 0x00, 0x4e, 0x9f, 0x3d, 0x8f, 0x8b, 0x97, 0xaf,
-    0xe3, 0x42, 0xe7, 0x15, 0xb8, 0xd5, 0x6a, 0x83, 0x02, 0x21, 0xe0, 0xd6, 0xaa, 0xf8, 0x99, 0xfb,
-    0x02, 0x21, 0x25, 0x76, 0xb6, 0xb7, 0xb0, 0xb9, 0xb1, 0x0e, 0x08, 0x01, 0xc7, 0x71, 0xe0, 0x38,
-    0x0e, 0x00, 0xc0, 0xb2, 0x2c, 0x00, 0x80, 0x6d, 0xdb, 0x07, 0x2b, 0x08, 0xa9, 0xf0, 0x6e, 0xf6,
-    0x05, 0xbe, 0x7f, 0x5e, 0xc6, 0xf6, 0xe6, 0x2f, 0x6c, 0x64, 0x3f, 0x41, 0x19, 0x83, 0xc7, 0x13,
-    0x13, 0x70, 0x5d, 0x17, 0x52, 0x6b, 0x24, 0xe7, 0xe6, 0x90, 0xcb, 0xe5, 0x90, 0xcd, 0x66, 0x21,
-    0xf7, 0x1d, 0xf6, 0x2f, 0x5c, 0x10, 0x5a, 0xa6, 0x1c, 0x58, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00,
-    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
@@ -1,15 +1,16 @@
 #ifndef BGEIGIECAST_HTTP_PAGES_H
 #define BGEIGIECAST_HTTP_PAGES_H
 
-#define TRANMISSION_SIZE 4098
+#include <Arduino.h>
 
-#define PURE_CSS_SIZE 3929
-#define FAVICON_SIZE 696
+#include "wifi_profiles.h"
 
 #define FORM_NAME_WIFI_SSID "c_ws"
 #define FORM_NAME_WIFI_PASS "c_wp"
+#define FORM_NAME_WIFI_PRIORITY "c_wr"
 #define FORM_NAME_API_KEY "c_ak"
 #define FORM_NAME_USE_DEV "c_ud"
+#define FORM_NAME_UPDATE_URL "c_uu"
 #define FORM_NAME_AP_LOGIN "d_ap"
 #define FORM_NAME_LED_INTENSITY "d_li"
 #define FORM_NAME_LED_COLOR "d_lc"
@@ -17,37 +18,44 @@
 #define FORM_NAME_LOC_HOME_LAT "l_ha"
 #define FORM_NAME_LOC_HOME_LON "l_ho"
 
+/**
+ * Renders the pages of the configuration server directly to an output (e.g. a chunked http response), no page is
+ * ever completely in memory.
+ */
 class HttpPages {
  public:
   HttpPages() = delete;
 
   /**
    * Render the home page
+   * @param out : Output to render to
    * @param device_id : To display the device id on the page
-   * @return complete page rendered
    */
-  static const char* get_home_page(
+  static void render_home_page(
+      Print& out,
       uint32_t device_id
   );
 
   /**
    * Render the update firmware page
+   * @param out : Output to render to
    * @param device_id : To display the device id on the page
-   * @return complete page rendered
    */
-  static const char* get_update_page(
+  static void render_update_page(
+      Print& out,
       uint32_t device_id
   );
 
   /**
    * Render the configuration page for device settings
+   * @param out : Output to render to
    * @param display_success 
    * @param device_id 
    * @param led_intensity 
    * @param colorblind 
-   * @return complete page rendered
    */
-  static const char* get_config_device_page(
+  static void render_config_device_page(
+      Print& out,
       bool display_success,
       uint32_t device_id,
       uint8_t led_intensity,
@@ -56,27 +64,29 @@ class HttpPages {
 
   /**
    * Render the configuration page for connection settings
+   * @param out : Output to render to
    * @param display_success 
    * @param device_id 
    * @param device_password 
-   * @param wifi_ssid 
-   * @param wifi_password 
+   * @param wifi_profiles: WIFI_PROFILE_COUNT stored networks
    * @param api_key 
    * @param use_dev
-   * @return complete page rendered
+   * @param update_url: manifest of the firmware update server
    */
-  static const char* get_config_connection_page(
+  static void render_config_connection_page(
+      Print& out,
       bool display_success,
       uint32_t device_id,
       const char* device_password,
-      const char* wifi_ssid,
-      const char* wifi_password,
+      const WiFiProfile* wifi_profiles,
       const char* api_key,
-      bool use_dev
+      bool use_dev,
+      const char* update_url
   );
 
   /**
    * Render the configuration page for location settings
+   * @param out : Output to render to
    * @param display_success
    * @param device_id
    * @param use_home_location
@@ -84,9 +94,9 @@ class HttpPages {
    * @param home_longitude
    * @param last_latitude
    * @param last_longitude
-   * @return complete page rendered
    */
-  static const char* get_config_location_page(
+  static void render_config_location_page(
+      Print& out,
       bool display_success,
       uint32_t device_id,
       bool use_home_location,
@@ -97,25 +107,41 @@ class HttpPages {
   );
 
   /**
-   * Render status page from report
-   * TODO: implement the report itself
+   * Render status page, the status itself is loaded from `/api/status`
+   * @param out : Output to render to
    * @param device_id : To display the device id on the page
-   * @return complete page rendered
    */
-  static const char* get_status_page(
+  static void render_status_page(
+      Print& out,
       uint32_t device_id
   );
 
-  static const uint8_t pure_css[PURE_CSS_SIZE];
-  static const uint8_t favicon[FAVICON_SIZE];
-  static const char* pure_js;
+  /**
+   * Get the form field name of a stored network, the first network uses the plain name, the others get their index
+   * appended
+   * @param out: at least 8 characters
+   * @param name: FORM_NAME_WIFI_*
+   * @param profile
+   */
+  static void wifi_form_name(char* out, const char* name, uint8_t profile);
 
   static bool internet_access;
 
  private:
 
-  static const char* render_full_page(uint32_t device_id, const char* page_name, const char* content_format, ...);
-  static char transmission_buffer[TRANMISSION_SIZE];
+  /**
+   * Render the page head and menu, to be followed by the page content
+   * @param out : Output to render to
+   * @param device_id : To display the device id on the page
+   * @param page_name : Title of the page
+   */
+  static void render_page_begin(Print& out, uint32_t device_id, const char* page_name);
+
+  /**
+   * Render the closing part of the page, after the content
+   * @param out : Output to render to
+   */
+  static void render_page_end(Print& out);
 
 };
 
@@ -0,0 +1,619 @@
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
+#ifdef ESP_PLATFORM
+#include <lwip/sockets.h>
+#include <esp_pthread.h>
+#include "user_config.h"
+#else
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#endif
+
+#include "http_server.h"
+
+#ifndef HTTP_SERVER_PRIORITY
+#define HTTP_SERVER_PRIORITY 1
+#endif
+
+// Short poll on accept, to see when the server is stopped
+#define HTTP_SERVER_ACCEPT_TIMEOUT_MILLIS 500
+
+namespace {
+
+const char* reason_phrase(int code) {
+  switch(code) {
+    case 200:
+      return "OK";
+    case 204:
+      return "No Content";
+    case 206:
+      return "Partial Content";
+    case 302:
+      return "Found";
+    case 304:
+      return "Not Modified";
+    case 400:
+      return "Bad Request";
+    case 404:
+      return "Not Found";
+    case 409:
+      return "Conflict";
+    case 413:
+      return "Payload Too Large";
+    case 416:
+      return "Range Not Satisfiable";
+    case 431:
+      return "Request Header Fields Too Large";
+    case 500:
+      return "Internal Server Error";
+    case 503:
+      return "Service Unavailable";
+    default:
+      return "";
+  }
+}
+
+void set_timeout(int socket, int option, uint32_t millis) {
+  timeval timeout{};
+  timeout.tv_sec = millis / 1000;
+  timeout.tv_usec = (millis % 1000) * 1000;
+  setsockopt(socket, SOL_SOCKET, option, &timeout, sizeof(timeout));
+}
+
+bool send_all(int socket, const char* data, size_t size) {
+  while(size > 0) {
+    auto sent = send(socket, data, size, 0);
+    if(sent <= 0) {
+      return false;
+    }
+    data += sent;
+    size -= sent;
+  }
+  return true;
+}
+
+int hex_value(char c) {
+  if(c >= '0' && c <= '9') return c - '0';
+  if(c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if(c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+/**
+ * Decode an url encoded string in place
+ */
+void url_decode(char* str) {
+  char* out = str;
+  for(char* in = str; *in; ++in, ++out) {
+    if(*in == '+') {
+      *out = ' ';
+    } else if(*in == '%' && hex_value(in[1]) >= 0 && hex_value(in[2]) >= 0) {
+      *out = static_cast<char>(hex_value(in[1]) << 4 | hex_value(in[2]));
+      in += 2;
+    } else {
+      *out = *in;
+    }
+  }
+  *out = '\0';
+}
+
+char* trim(char* str) {
+  while(*str == ' ' || *str == '\t') {
+    ++str;
+  }
+  auto end = str + strlen(str);
+  while(end > str && (end[-1] == ' ' || end[-1] == '\t')) {
+    *--end = '\0';
+  }
+  return str;
+}
+
+}
+
+HttpRequest::HttpRequest() :
+    _socket(-1),
+    _method(e_http_get),
+    _path(""),
+    _content_length(0),
+    _body_read(0),
+    _args(),
+    _arg_count(0),
+    _headers(),
+    _header_count(0),
+    _head(),
+    _body(),
+    _pending_offset(0),
+    _pending_length(0) {
+}
+
+HttpMethod HttpRequest::method() const {
+  return _method;
+}
+
+const char* HttpRequest::path() const {
+  return _path;
+}
+
+bool HttpRequest::has_arg(const char* name) const {
+  for(uint8_t i = 0; i < _arg_count; ++i) {
+    if(strcmp(_args[i].name, name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+const char* HttpRequest::arg(const char* name) const {
+  for(uint8_t i = 0; i < _arg_count; ++i) {
+    if(strcmp(_args[i].name, name) == 0) {
+      return _args[i].value;
+    }
+  }
+  return "";
+}
+
+const char* HttpRequest::header(const char* name) const {
+  for(uint8_t i = 0; i < _header_count; ++i) {
+    if(strcasecmp(_headers[i].name, name) == 0) {
+      return _headers[i].value;
+    }
+  }
+  return nullptr;
+}
+
+size_t HttpRequest::content_length() const {
+  return _content_length;
+}
+
+int HttpRequest::read(uint8_t* buffer, size_t size) {
+  size_t remaining = _content_length - _body_read;
+  if(remaining == 0) {
+    return 0;
+  }
+  if(size > remaining) {
+    size = remaining;
+  }
+  if(_pending_length > 0) {
+    if(size > _pending_length) {
+      size = _pending_length;
+    }
+    memcpy(buffer, &_head[_pending_offset], size);
+    _pending_offset += size;
+    _pending_length -= size;
+    _body_read += size;
+    return static_cast<int>(size);
+  }
+  auto received = recv(_socket, buffer, size, 0);
+  if(received <= 0) {
+    // Closed or timed out before the body was complete
+    return -1;
+  }
+  _body_read += received;
+  return static_cast<int>(received);
+}
+
+bool HttpRequest::parse_head(size_t head_length) {
+  _head[head_length] = '\0';
+  _arg_count = 0;
+  _header_count = 0;
+  _content_length = 0;
+  _body_read = 0;
+
+  // Request line: METHOD target HTTP/1.x
+  char* line_end = strstr(_head, "\r\n");
+  if(!line_end) {
+    return false;
+  }
+  *line_end = '\0';
+  char* target = strchr(_head, ' ');
+  if(!target) {
+    return false;
+  }
+  *target++ = '\0';
+  char* version = strchr(target, ' ');
+  if(!version) {
+    return false;
+  }
+  *version = '\0';
+
+  if(strcmp(_head, "GET") == 0 || strcmp(_head, "HEAD") == 0) {
+    _method = e_http_get;
+  } else if(strcmp(_head, "POST") == 0) {
+    _method = e_http_post;
+  } else {
+    _method = e_http_any;
+  }
+
+  char* query = strchr(target, '?');
+  if(query) {
+    *query++ = '\0';
+  }
+  _path = target;
+
+  // Headers
+  char* line = line_end + 2;
+  while(*line) {
+    line_end = strstr(line, "\r\n");
+    if(!line_end || line_end == line) {
+      break;
+    }
+    *line_end = '\0';
+    char* separator = strchr(line, ':');
+    if(separator && _header_count < HTTP_SERVER_MAX_HEADERS) {
+      *separator = '\0';
+      _headers[_header_count++] = {trim(line), trim(separator + 1)};
+    }
+    line = line_end + 2;
+  }
+
+  auto length = header("Content-Length");
+  if(length) {
+    _content_length = strtoul(length, nullptr, 10);
+  }
+
+  if(query) {
+    parse_args(query);
+  }
+  return true;
+}
+
+void HttpRequest::parse_args(char* query) {
+  char* save = nullptr;
+  for(char* pair = strtok_r(query, "&", &save); pair && _arg_count < HTTP_SERVER_MAX_ARGS;
+      pair = strtok_r(nullptr, "&", &save)) {
+    char* value = strchr(pair, '=');
+    if(value) {
+      *value++ = '\0';
+      url_decode(value);
+    } else {
+      value = pair + strlen(pair);
+    }
+    url_decode(pair);
+    _args[_arg_count++] = {pair, value};
+  }
+}
+
+HttpResponse::HttpResponse() :
+    _socket(-1),
+    _started(false),
+    _failed(false),
+    _detached(false),
+    _headers_length(0),
+    _headers() {
+}
+
+void HttpResponse::add_header(const char* name, const char* value) {
+  if(_started) {
+    return;
+  }
+  auto written = snprintf(&_headers[_headers_length], sizeof(_headers) - _headers_length, "%s: %s\r\n", name, value);
+  if(written > 0 && _headers_length + written < sizeof(_headers)) {
+    _headers_length += written;
+  } else {
+    // Does not fit, leave it out
+    _headers[_headers_length] = '\0';
+  }
+}
+
+void HttpResponse::send(int code, const char* content_type, const char* body) {
+  send(code, content_type, reinterpret_cast<const uint8_t*>(body), body ? strlen(body) : 0);
+}
+
+void HttpResponse::send(int code, const char* content_type, const uint8_t* body, size_t size) {
+  write_head(code, content_type, static_cast<long>(size), false);
+  if(size > 0) {
+    write(reinterpret_cast<const char*>(body), size);
+  }
+}
+
+void HttpResponse::begin_chunked(int code, const char* content_type) {
+  write_head(code, content_type, -1, true);
+}
+
+bool HttpResponse::write_chunk(const char* data, size_t size) {
+  if(size == 0) {
+    // Would end the response
+    return true;
+  }
+  char frame[HTTP_SERVER_CHUNK_FRAME_SIZE];
+  auto header_length = snprintf(frame, sizeof(frame), "%x\r\n", static_cast<unsigned int>(size));
+  if(header_length + size + 2 <= sizeof(frame)) {
+    // Small chunks go out in one send
+    memcpy(&frame[header_length], data, size);
+    memcpy(&frame[header_length + size], "\r\n", 2);
+    return write(frame, header_length + size + 2);
+  }
+  return write(frame, header_length) && write(data, size) && write("\r\n", 2);
+}
+
+void HttpResponse::end_chunked() {
+  write("0\r\n\r\n", 5);
+}
+
+void HttpResponse::begin_stream(int code, const char* content_type) {
+  write_head(code, content_type, -1, false);
+}
+
+int HttpResponse::detach() {
+  _detached = true;
+  return _socket;
+}
+
+bool HttpResponse::write(const char* data, size_t size) {
+  if(_failed || !send_all(_socket, data, size)) {
+    _failed = true;
+    return false;
+  }
+  return true;
+}
+
+bool HttpResponse::is_started() const {
+  return _started;
+}
+
+void HttpResponse::write_head(int code, const char* content_type, long content_length, bool chunked) {
+  if(_started) {
+    return;
+  }
+  _started = true;
+  char head[HTTP_SERVER_RESPONSE_HEADERS_SIZE + 160];
+  auto length = snprintf(head, sizeof(head), "HTTP/1.1 %d %s\r\n", code, reason_phrase(code));
+  if(content_type) {
+    length += snprintf(&head[length], sizeof(head) - length, "Content-Type: %s\r\n", content_type);
+  }
+  if(content_length >= 0) {
+    length += snprintf(&head[length], sizeof(head) - length, "Content-Length: %ld\r\n", content_length);
+  }
+  if(chunked) {
+    length += snprintf(&head[length], sizeof(head) - length, "Transfer-Encoding: chunked\r\n");
+  }
+  length += snprintf(&head[length], sizeof(head) - length, "Connection: close\r\n%s\r\n", _headers);
+  write(head, length);
+}
+
+HttpServer::HttpServer() :
+    _routes(),
+    _route_count(0),
+    _listen_socket(-1),
+    _running(false),
+    _refused(0),
+    _active(0),
+    _accept_thread(),
+    _workers(),
+    _queue_lock(),
+    _queue_signal(),
+    _queue(),
+    _queue_head(0),
+    _queue_count(0) {
+}
+
+HttpServer::~HttpServer() {
+  stop();
+}
+
+bool HttpServer::on(const char* path, HttpMethod method, HttpServer::Handler handler, bool raw_body) {
+  if(_route_count == HTTP_SERVER_MAX_ROUTES || _running) {
+    return false;
+  }
+  _routes[_route_count++] = {path, method, handler, raw_body};
+  return true;
+}
+
+bool HttpServer::begin(uint16_t port) {
+  if(_running) {
+    return true;
+  }
+  _listen_socket = socket(AF_INET, SOCK_STREAM, 0);
+  if(_listen_socket < 0) {
+    return false;
+  }
+  int enable = 1;
+  setsockopt(_listen_socket, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  set_timeout(_listen_socket, SO_RCVTIMEO, HTTP_SERVER_ACCEPT_TIMEOUT_MILLIS);
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  if(bind(_listen_socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0
+      || listen(_listen_socket, HTTP_SERVER_QUEUE_SIZE) < 0) {
+    close(_listen_socket);
+    _listen_socket = -1;
+    return false;
+  }
+
+#ifdef ESP_PLATFORM
+  // Tasks for the threads below, on the network core with the priority of the main loop. Requests never preempt the
+  // sensor path, which runs on the other core
+  esp_pthread_cfg_t config = esp_pthread_get_default_config();
+  config.stack_size = HTTP_SERVER_STACK_SIZE;
+  config.prio = HTTP_SERVER_PRIORITY;
+  config.thread_name = "HttpServer";
+  config.pin_to_core = NETWORK_TASK_CORE;
+  esp_pthread_set_cfg(&config);
+#endif
+
+  _running = true;
+  _accept_thread = std::thread(&HttpServer::accept_loop, this);
+  for(auto& worker : _workers) {
+    worker = std::thread(&HttpServer::worker_loop, this);
+  }
+  return true;
+}
+
+void HttpServer::stop() {
+  if(!_running) {
+    return;
+  }
+  _running = false;
+  _queue_signal.notify_all();
+  _accept_thread.join();
+  for(auto& worker : _workers) {
+    worker.join();
+  }
+  close(_listen_socket);
+  _listen_socket = -1;
+  // Connections that were never handled
+  while(_queue_count > 0) {
+    close(_queue[_queue_head]);
+    _queue_head = (_queue_head + 1) % HTTP_SERVER_QUEUE_SIZE;
+    --_queue_count;
+  }
+}
+
+bool HttpServer::is_running() const {
+  return _running;
+}
+
+uint32_t HttpServer::get_refused() const {
+  return _refused;
+}
+
+uint8_t HttpServer::get_active() const {
+  return _active;
+}
+
+void HttpServer::accept_loop() {
+  while(_running) {
+    int client = accept(_listen_socket, nullptr, nullptr);
+    if(client < 0) {
+      // Timeout, check if still running
+      continue;
+    }
+    set_timeout(client, SO_RCVTIMEO, HTTP_SERVER_TIMEOUT_MILLIS);
+    set_timeout(client, SO_SNDTIMEO, HTTP_SERVER_TIMEOUT_MILLIS);
+    int enable = 1;
+    setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+    std::unique_lock<std::mutex> lock(_queue_lock);
+    if(_queue_count == HTTP_SERVER_QUEUE_SIZE) {
+      lock.unlock();
+      ++_refused;
+      const char* busy = "HTTP/1.1 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+      send_all(client, busy, strlen(busy));
+      close(client);
+      continue;
+    }
+    _queue[(_queue_head + _queue_count) % HTTP_SERVER_QUEUE_SIZE] = client;
+    ++_queue_count;
+    lock.unlock();
+    _queue_signal.notify_one();
+  }
+}
+
+void HttpServer::worker_loop() {
+  // Large, one per worker on its own stack
+  HttpRequest request;
+  HttpResponse response;
+  for(;;) {
+    int client;
+    {
+      std::unique_lock<std::mutex> lock(_queue_lock);
+      _queue_signal.wait(lock, [this]() { return _queue_count > 0 || !_running; });
+      if(!_running) {
+        return;
+      }
+      client = _queue[_queue_head];
+      _queue_head = (_queue_head + 1) % HTTP_SERVER_QUEUE_SIZE;
+      --_queue_count;
+    }
+    ++_active;
+    handle_connection(client, request, response);
+    --_active;
+  }
+}
+
+void HttpServer::handle_connection(int socket, HttpRequest& request, HttpResponse& response) {
+  request._socket = socket;
+  request._pending_offset = 0;
+  request._pending_length = 0;
+  response._socket = socket;
+  response._started = false;
+  response._failed = false;
+  response._detached = false;
+  response._headers_length = 0;
+  response._headers[0] = '\0';
+
+  // Read until the end of the headers
+  size_t received = 0;
+  char* head_end = nullptr;
+  while(!head_end) {
+    if(received == sizeof(request._head) - 1) {
+      response.send(431);
+      close(socket);
+      return;
+    }
+    auto count = recv(socket, &request._head[received], sizeof(request._head) - 1 - received, 0);
+    if(count <= 0) {
+      close(socket);
+      return;
+    }
+    received += count;
+    request._head[received] = '\0';
+    head_end = strstr(request._head, "\r\n\r\n");
+  }
+  size_t head_length = head_end + 4 - request._head;
+  request._pending_offset = head_length;
+  request._pending_length = received - head_length;
+
+  if(!request.parse_head(head_length - 2)) {
+    response.send(400);
+    close(socket);
+    return;
+  }
+
+  auto route = find_route(request._path, request._method);
+  if(!route) {
+    response.send(404, "text/plain", "Not found");
+    close(socket);
+    return;
+  }
+
+  auto content_type = request.header("Content-Type");
+  if(!route->raw_body && request._content_length > 0
+      && content_type && strncmp(content_type, "application/x-www-form-urlencoded", 33) == 0) {
+    // Form post, parse the body as args
+    if(request._content_length >= sizeof(request._body)) {
+      response.send(413);
+      close(socket);
+      return;
+    }
+    size_t length = 0;
+    while(length < request._content_length) {
+      auto count = request.read(reinterpret_cast<uint8_t*>(&request._body[length]), request._content_length - length);
+      if(count <= 0) {
+        close(socket);
+        return;
+      }
+      length += count;
+    }
+    request._body[length] = '\0';
+    request.parse_args(request._body);
+  }
+
+  route->handler(request, response);
+
+  if(response._detached) {
+    return;
+  }
+  if(!response._started) {
+    response.send(500, "text/plain", "No response");
+  }
+  close(socket);
+}
+
+const HttpServer::Route* HttpServer::find_route(const char* path, HttpMethod method) const {
+  for(uint8_t i = 0; i < _route_count; ++i) {
+    const auto& route = _routes[i];
+    if((route.method == e_http_any || route.method == method) && strcmp(route.path, path) == 0) {
+      return &route;
+    }
+  }
+  return nullptr;
+}
@@ -0,0 +1,257 @@
+#ifndef BGEIGIECAST_HTTP_SERVER_H
+#define BGEIGIECAST_HTTP_SERVER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#ifndef HTTP_SERVER_WORKERS
+#define HTTP_SERVER_WORKERS 3
+#endif
+
+#ifndef HTTP_SERVER_QUEUE_SIZE
+#define HTTP_SERVER_QUEUE_SIZE 4
+#endif
+
+#ifndef HTTP_SERVER_MAX_ROUTES
+#define HTTP_SERVER_MAX_ROUTES 24
+#endif
+
+#ifndef HTTP_SERVER_HEAD_SIZE
+#define HTTP_SERVER_HEAD_SIZE 1024
+#endif
+
+#ifndef HTTP_SERVER_BODY_SIZE
+#define HTTP_SERVER_BODY_SIZE 1024
+#endif
+
+#ifndef HTTP_SERVER_MAX_ARGS
+#define HTTP_SERVER_MAX_ARGS 16
+#endif
+
+#ifndef HTTP_SERVER_MAX_HEADERS
+#define HTTP_SERVER_MAX_HEADERS 12
+#endif
+
+#ifndef HTTP_SERVER_RESPONSE_HEADERS_SIZE
+#define HTTP_SERVER_RESPONSE_HEADERS_SIZE 384
+#endif
+
+#ifndef HTTP_SERVER_CHUNK_FRAME_SIZE
+#define HTTP_SERVER_CHUNK_FRAME_SIZE 300 // Chunks up to this size (with framing) are sent in one piece
+#endif
+
+#ifndef HTTP_SERVER_TIMEOUT_MILLIS
+#define HTTP_SERVER_TIMEOUT_MILLIS 5000
+#endif
+
+#ifndef HTTP_SERVER_STACK_SIZE
+#define HTTP_SERVER_STACK_SIZE 8192
+#endif
+
+enum HttpMethod {
+  e_http_get,
+  e_http_post,
+  e_http_any,
+};
+
+/**
+ * Request that is being handled. Query arguments and url encoded form bodies are available as args, other bodies
+ * (routes added with `raw_body`) can be read with `read`.
+ */
+class HttpRequest {
+ public:
+  HttpRequest();
+  virtual ~HttpRequest() = default;
+
+  HttpMethod method() const;
+  const char* path() const;
+
+  bool has_arg(const char* name) const;
+
+  /**
+   * Get a query or form argument
+   * @return the value, "" if not set
+   */
+  const char* arg(const char* name) const;
+
+  /**
+   * Get a request header (case insensitive name)
+   * @return the value, nullptr if not set
+   */
+  const char* header(const char* name) const;
+
+  size_t content_length() const;
+
+  /**
+   * Read the raw body, only for routes with a raw body
+   * @return bytes read, 0 when the body is complete, -1 on a connection error
+   */
+  int read(uint8_t* buffer, size_t size);
+
+ private:
+  friend class HttpServer;
+
+  struct Pair {
+    const char* name;
+    const char* value;
+  };
+
+  /**
+   * Parse the request line and headers in `_head`
+   * @return false for a malformed request
+   */
+  bool parse_head(size_t head_length);
+  void parse_args(char* query);
+
+  int _socket;
+  HttpMethod _method;
+  const char* _path;
+  size_t _content_length;
+  size_t _body_read;
+  Pair _args[HTTP_SERVER_MAX_ARGS];
+  uint8_t _arg_count;
+  Pair _headers[HTTP_SERVER_MAX_HEADERS];
+  uint8_t _header_count;
+  char _head[HTTP_SERVER_HEAD_SIZE];
+  char _body[HTTP_SERVER_BODY_SIZE];
+  // Part of the body that was received together with the head
+  size_t _pending_offset;
+  size_t _pending_length;
+};
+
+/**
+ * Response to a request, writes directly to the connection. The connection is closed after the response.
+ */
+class HttpResponse {
+ public:
+  HttpResponse();
+  virtual ~HttpResponse() = default;
+
+  /**
+   * Add a header, before the response is started
+   */
+  void add_header(const char* name, const char* value);
+
+  /**
+   * Send a complete response
+   */
+  void send(int code, const char* content_type = nullptr, const char* body = nullptr);
+  void send(int code, const char* content_type, const uint8_t* body, size_t size);
+
+  /**
+   * Start a response with chunked transfer encoding, followed by `write_chunk` and `end_chunked`
+   */
+  void begin_chunked(int code, const char* content_type);
+  bool write_chunk(const char* data, size_t size);
+  void end_chunked();
+
+  /**
+   * Start a response with unknown length, the body is written with `write` until the connection is closed
+   */
+  void begin_stream(int code, const char* content_type);
+
+  /**
+   * Take over the connection, the server will not close it. Used for long living responses (event streams).
+   * @return socket of the connection
+   */
+  int detach();
+
+  bool write(const char* data, size_t size);
+
+  bool is_started() const;
+
+ private:
+  friend class HttpServer;
+
+  void write_head(int code, const char* content_type, long content_length, bool chunked);
+
+  int _socket;
+  bool _started;
+  bool _failed;
+  bool _detached;
+  size_t _headers_length;
+  char _headers[HTTP_SERVER_RESPONSE_HEADERS_SIZE];
+};
+
+/**
+ * Small http server on plain sockets. Connections are accepted by a dedicated task and handled concurrently by a
+ * pool of HTTP_SERVER_WORKERS tasks, so a slow request (e.g. an upload) never blocks other requests or the caller.
+ * Handlers run in the worker tasks and must be thread safe. Routes must be added before `begin`.
+ */
+class HttpServer {
+ public:
+  typedef std::function<void(HttpRequest&, HttpResponse&)> Handler;
+
+  HttpServer();
+  virtual ~HttpServer();
+
+  /**
+   * Add a route
+   * @param path: exact path (without query)
+   * @param method
+   * @param handler
+   * @param raw_body: handler reads the body itself, instead of it being parsed as form
+   * @return false if there are too many routes
+   */
+  bool on(const char* path, HttpMethod method, Handler handler, bool raw_body = false);
+
+  /**
+   * Start listening
+   * @return true if the server is running
+   */
+  bool begin(uint16_t port);
+
+  /**
+   * Stop listening and wait for all requests to complete
+   */
+  void stop();
+
+  bool is_running() const;
+
+  /**
+   * Get the amount of connections refused because all workers were busy
+   */
+  uint32_t get_refused() const;
+
+  /**
+   * Get the amount of requests being handled right now
+   */
+  uint8_t get_active() const;
+
+ private:
+  struct Route {
+    const char* path;
+    HttpMethod method;
+    Handler handler;
+    bool raw_body;
+  };
+
+  void accept_loop();
+  void worker_loop();
+  void handle_connection(int socket, HttpRequest& request, HttpResponse& response);
+  const Route* find_route(const char* path, HttpMethod method) const;
+
+  Route _routes[HTTP_SERVER_MAX_ROUTES];
+  uint8_t _route_count;
+
+  int _listen_socket;
+  std::atomic<bool> _running;
+  std::atomic<uint32_t> _refused;
+  std::atomic<uint8_t> _active;
+  std::thread _accept_thread;
+  std::thread _workers[HTTP_SERVER_WORKERS];
+
+  // Accepted connections waiting for a worker
+  std::mutex _queue_lock;
+  std::condition_variable _queue_signal;
+  int _queue[HTTP_SERVER_QUEUE_SIZE];
+  uint8_t _queue_head;
+  uint8_t _queue_count;
+};
+
+#endif //BGEIGIECAST_HTTP_SERVER_H
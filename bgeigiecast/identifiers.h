@@ -6,6 +6,8 @@ enum DataWorkers {
   k_worker_configuration_server,
   k_worker_wifi_access_point,
   k_worker_controller_state_changer,
+  k_worker_bluetooth_transfer,
+  k_worker_count,
 };
 
 enum DataHandlers {
@@ -13,6 +15,13 @@ enum DataHandlers {
   k_handler_storage_handler,
   k_handler_bluetooth_reporter,
   k_handler_api_reporter,
+  k_handler_ota_puller,
+  k_handler_count,
+};
+
+enum ExecutionGroups {
+  k_group_sensor = 0, // Main loop: serial, button, LED and storage
+  k_group_network, // WiFi, HTTP and BLE
 };
 
 
@@ -0,0 +1,140 @@
+#include <math.h>
+#include "json_writer.h"
+
+JsonWriter::JsonWriter(Print& out) : _out(out), _depth(0), _overflow(false), _has_values() {
+}
+
+void JsonWriter::begin_object(const char* key) {
+  begin(key, '{');
+}
+
+void JsonWriter::end_object() {
+  end('}');
+}
+
+void JsonWriter::begin_array(const char* key) {
+  begin(key, '[');
+}
+
+void JsonWriter::end_array() {
+  end(']');
+}
+
+void JsonWriter::add(const char* key, const char* value) {
+  if(!next_value(key)) {
+    return;
+  }
+  if(value) {
+    write_string(value);
+  } else {
+    _out.print("null");
+  }
+}
+
+void JsonWriter::add(const char* key, bool value) {
+  if(next_value(key)) {
+    _out.print(value ? "true" : "false");
+  }
+}
+
+void JsonWriter::add(const char* key, long value) {
+  if(next_value(key)) {
+    _out.printf("%ld", value);
+  }
+}
+
+void JsonWriter::add(const char* key, unsigned long value) {
+  if(next_value(key)) {
+    _out.printf("%lu", value);
+  }
+}
+
+void JsonWriter::add(const char* key, double value, uint8_t decimals) {
+  if(!next_value(key)) {
+    return;
+  }
+  if(isnan(value) || isinf(value)) {
+    _out.print("null");
+  } else {
+    _out.printf("%.*f", decimals, value);
+  }
+}
+
+void JsonWriter::add_null(const char* key) {
+  if(next_value(key)) {
+    _out.print("null");
+  }
+}
+
+bool JsonWriter::is_complete() const {
+  return _depth == 0 && !_overflow;
+}
+
+bool JsonWriter::next_value(const char* key) {
+  if(_depth > JSON_WRITER_MAX_DEPTH) {
+    return false;
+  }
+  if(_has_values[_depth]) {
+    _out.write(',');
+  }
+  _has_values[_depth] = true;
+  if(key) {
+    write_string(key);
+    _out.write(':');
+  }
+  return true;
+}
+
+void JsonWriter::begin(const char* key, char open) {
+  if(_depth >= JSON_WRITER_MAX_DEPTH) {
+    _overflow = true;
+    ++_depth;
+    return;
+  }
+  next_value(key);
+  _out.write(open);
+  ++_depth;
+  _has_values[_depth] = false;
+}
+
+void JsonWriter::end(char close) {
+  if(_depth == 0) {
+    return;
+  }
+  if(_depth > JSON_WRITER_MAX_DEPTH) {
+    --_depth;
+    return;
+  }
+  --_depth;
+  _out.write(close);
+}
+
+void JsonWriter::write_string(const char* str) {
+  _out.write('"');
+  for(const char* c = str; *c; ++c) {
+    switch(*c) {
+      case '"':
+        _out.print("\\\"");
+        break;
+      case '\\':
+        _out.print("\\\\");
+        break;
+      case '\n':
+        _out.print("\\n");
+        break;
+      case '\r':
+        _out.print("\\r");
+        break;
+      case '\t':
+        _out.print("\\t");
+        break;
+      default:
+        if(static_cast<uint8_t>(*c) < 0x20) {
+          _out.printf("\\u%04x", *c);
+        } else {
+          _out.write(*c);
+        }
+    }
+  }
+  _out.write('"');
+}
@@ -0,0 +1,61 @@
+#ifndef BGEIGIECAST_JSON_WRITER_H
+#define BGEIGIECAST_JSON_WRITER_H
+
+#include <Arduino.h>
+
+#ifndef JSON_WRITER_MAX_DEPTH
+#define JSON_WRITER_MAX_DEPTH 8
+#endif
+
+/**
+ * Writes JSON straight to an output, without building a document in memory. Keys are given with each value when
+ * inside an object and must be nullptr inside an array. Does not allocate, nesting is limited to
+ * JSON_WRITER_MAX_DEPTH (deeper values are ignored).
+ */
+class JsonWriter {
+ public:
+  explicit JsonWriter(Print& out);
+  virtual ~JsonWriter() = default;
+
+  void begin_object(const char* key = nullptr);
+  void end_object();
+  void begin_array(const char* key = nullptr);
+  void end_array();
+
+  void add(const char* key, const char* value);
+  void add(const char* key, bool value);
+  void add(const char* key, long value);
+  void add(const char* key, unsigned long value);
+  void add(const char* key, int value) { add(key, static_cast<long>(value)); }
+  void add(const char* key, unsigned int value) { add(key, static_cast<unsigned long>(value)); }
+
+  /**
+   * Add a number, NaN and infinity are written as null
+   * @param decimals: amount of decimals to write
+   */
+  void add(const char* key, double value, uint8_t decimals = 2);
+
+  void add_null(const char* key);
+
+  /**
+   * Check if all opened objects and arrays are closed and nesting was never too deep
+   */
+  bool is_complete() const;
+
+ private:
+  /**
+   * Writes the separator and key for the next value
+   * @return false if the value should not be written
+   */
+  bool next_value(const char* key);
+  void begin(const char* key, char open);
+  void end(char close);
+  void write_string(const char* str);
+
+  Print& _out;
+  uint8_t _depth;
+  bool _overflow;
+  bool _has_values[JSON_WRITER_MAX_DEPTH + 1];
+};
+
+#endif //BGEIGIECAST_JSON_WRITER_H
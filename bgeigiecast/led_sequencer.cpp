@@ -0,0 +1,37 @@
+#include "led_sequencer.h"
+
+LedSequencer::LedSequencer() : _pattern(nullptr), _step(0), _elapsed(0) {
+}
+
+void LedSequencer::start(const LedPattern& pattern) {
+  _pattern = &pattern;
+  _step = 0;
+  _elapsed = 0;
+}
+
+uint32_t LedSequencer::update(LedFrame& frame) {
+  if(!_pattern || !_pattern->step_count) {
+    frame = {0, 0, 0};
+    return 0;
+  }
+  const LedStep* step = &_pattern->steps[_step];
+  if(step->duration && _elapsed >= step->duration) {
+    _step = _step + 1 == _pattern->step_count ? 0 : _step + 1;
+    _elapsed = 0;
+    step = &_pattern->steps[_step];
+  }
+
+  frame.color = step->color;
+  frame.next_color = _pattern->steps[_step + 1 == _pattern->step_count ? 0 : _step + 1].color;
+  frame.blend = step->fade && step->duration ? _elapsed * 255u / step->duration : 0;
+  if(!step->duration) {
+    return 0;
+  }
+
+  uint32_t delay = step->duration - _elapsed;
+  if(step->fade && delay > LED_SEQUENCER_FADE_TICK_MILLIS) {
+    delay = LED_SEQUENCER_FADE_TICK_MILLIS;
+  }
+  _elapsed += delay;
+  return delay;
+}
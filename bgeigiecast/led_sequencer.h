@@ -0,0 +1,65 @@
+#ifndef BGEIGIECAST_LED_SEQUENCER_H
+#define BGEIGIECAST_LED_SEQUENCER_H
+
+#include <stdint.h>
+
+#ifndef LED_SEQUENCER_FADE_TICK_MILLIS
+#define LED_SEQUENCER_FADE_TICK_MILLIS 20 // Update interval during a fade, 50 Hz
+#endif
+
+/**
+ * Step of a LED pattern, the color is an index in the color table of the user of the sequencer
+ */
+struct LedStep {
+  uint8_t color;
+  uint16_t duration; // millis, 0 to hold the color until another pattern is started
+  bool fade; // fade to the color of the next step during the duration
+};
+
+/**
+ * Pattern of steps, played in a loop
+ */
+struct LedPattern {
+  const LedStep* steps;
+  uint8_t step_count;
+};
+
+#define LED_PATTERN(steps) {steps, sizeof(steps) / sizeof(LedStep)}
+
+/**
+ * What the LED shows: `color` blended towards `next_color`
+ */
+struct LedFrame {
+  uint8_t color;
+  uint8_t next_color;
+  uint8_t blend; // 0 is `color`, 255 is `next_color`
+};
+
+/**
+ * Plays LED patterns. The owner calls `update` when the previous update asked for it, usually from a one-shot timer.
+ * Every update takes constant time, steps without a fade need one update only.
+ */
+class LedSequencer {
+ public:
+  LedSequencer();
+  virtual ~LedSequencer() = default;
+
+  /**
+   * Start a pattern from its first step
+   */
+  void start(const LedPattern& pattern);
+
+  /**
+   * Get the frame to show now
+   * @param frame: filled with what to show
+   * @return millis until the next update, 0 if the frame holds until another pattern is started
+   */
+  uint32_t update(LedFrame& frame);
+
+ private:
+  const LedPattern* _pattern;
+  uint8_t _step;
+  uint16_t _elapsed; // millis of the current step
+};
+
+#endif //BGEIGIECAST_LED_SEQUENCER_H
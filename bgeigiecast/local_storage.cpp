@@ -1,4 +1,6 @@
 
+#include <esp_system.h>
+
 #include "local_storage.h"
 #include "debugger.h"
 #include "identifiers.h"
@@ -8,29 +10,65 @@
 #define D_SAVED_STATE Controller::k_savable_MobileMode
 
 const char* memory_name = "data";
-
-// Keys for config
-const char* key_device_id = "ap_ssid";
-const char* key_ap_password = "ap_password";
-const char* key_wifi_ssid = "wifi_ssid";
-const char* key_wifi_password = "wifi_password";
-const char* key_api_key = "api_key";
-const char* key_use_dev = "use_dev";
-const char* key_led_color_blind = "led_color_blind";
-const char* key_led_color_intensity = "led_intensity";
-const char* key_saved_state = "saved_state";
-const char* key_home_longtitude = "home_longtitude";
-const char* key_home_latitude = "home_latitude";
-const char* key_last_longtitude = "last_longtitude";
-const char* key_last_latitude = "last_latitude";
+const char* config_blob_key = "config";
+
+// Keys of the old layout with a key per value, in order of LocalStorage::ConfigKey
+const char* config_keys[LocalStorage::k_key_count] = {
+    "ap_ssid",
+    "ap_password",
+    "wifi_ssid",
+    "wifi_password",
+    "api_key",
+    "use_dev",
+    "led_color_blind",
+    "led_intensity",
+    "saved_state",
+    "led_color_blind", // The old layout wrote use home location to the led color blind key, loaded the same way
+    "home_longtitude",
+    "home_latitude",
+    "last_longtitude",
+    "last_latitude",
+    "update_url", // Never stored with the old layout
+    "wifi_profiles", // Never stored with the old layout
+};
+
+static_assert(WIFI_PROFILE_VAL_MAX == CONFIG_VAL_MAX, "The first wifi profile is stored as the wifi ssid / password");
+
+// Values which change with (almost) every reading, only committed on interval
+const uint16_t k_interval_keys =
+    (1u << LocalStorage::k_key_device_id)
+        | (1u << LocalStorage::k_key_last_longitude)
+        | (1u << LocalStorage::k_key_last_latitude);
+
+// To commit on shutdown
+LocalStorage* storage_instance = nullptr;
+
+/**
+ * CRC-32 (IEEE 802.3)
+ */
+uint32_t config_crc(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for(size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
 
 LocalStorage::LocalStorage() :
-    Handler(k_handler_storage_handler),
+    Handler(k_handler_storage_handler, k_group_sensor, e_priority_low),
     _memory(),
+    _dirty(0),
+    _commit_lock(),
+    _last_commit(0),
+    _metrics(),
+    _load_status(e_config_not_loaded),
+    _led_settings_revision(1),
     _device_id(0),
     _ap_password(""),
-    _wifi_ssid(""),
-    _wifi_password(""),
+    _wifi_profiles(),
     _api_key(""),
     _use_dev(D_USE_DEV_SERVER),
     _led_color_blind(D_LED_COLOR_BLIND),
@@ -40,15 +78,15 @@ LocalStorage::LocalStorage() :
     _home_longitude(0),
     _home_latitude(0),
     _last_longitude(0),
-    _last_latitude(0) {
+    _last_latitude(0),
+    _update_url("") {
 }
 
 void LocalStorage::reset_defaults() {
   if(clear()) {
     set_device_id(D_DEVICE_ID, true);
     set_ap_password(D_ACCESS_POINT_PASSWORD, true);
-    set_wifi_ssid(D_WIFI_SSID, true);
-    set_wifi_password(D_WIFI_PASSWORD, true);
+    set_wifi_profile(0, D_WIFI_SSID, D_WIFI_PASSWORD, 0, true);
     set_api_key(D_APIKEY, true);
     set_use_dev(D_USE_DEV_SERVER, true);
     set_led_color_blind(D_LED_COLOR_BLIND, true);
@@ -59,226 +97,362 @@ void LocalStorage::reset_defaults() {
     set_home_latitude(0, true);
     set_last_longitude(0, true);
     set_last_latitude(0, true);
+    set_update_url(D_UPDATE_URL, true);
+    for(uint8_t i = 1; i < WIFI_PROFILE_COUNT; ++i) {
+      set_wifi_profile(i, "", "", 0, true);
+    }
+    commit();
   }
 }
 
 uint16_t LocalStorage::get_device_id() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _device_id;
 }
 
 const char* LocalStorage::get_ap_password() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _ap_password;
 }
 
 const char* LocalStorage::get_wifi_ssid() const {
-  return _wifi_ssid;
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  return _wifi_profiles[0].ssid;
 }
 
 const char* LocalStorage::get_wifi_password() const {
-  return _wifi_password;
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  return _wifi_profiles[0].password;
 }
 
 const char* LocalStorage::get_api_key() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _api_key;
 }
 
 int8_t LocalStorage::get_saved_state() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _saved_state;
 }
 
 bool LocalStorage::is_led_color_blind() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _led_color_blind;
 }
 
 uint8_t LocalStorage::get_led_color_intensity() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _led_color_intensity;
 }
 
 bool LocalStorage::get_use_dev() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _use_dev;
 }
 
 bool LocalStorage::get_use_home_location() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _use_home_location;
 }
 
 double LocalStorage::get_home_longitude() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _home_longitude;
 }
 
 double LocalStorage::get_home_latitude() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _home_latitude;
 }
 
 double LocalStorage::get_last_longitude() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _last_longitude;
 }
 
 double LocalStorage::get_last_latitude() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
   return _last_latitude;
 }
 
+const char* LocalStorage::get_update_url() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  return _update_url;
+}
+
+const WiFiProfile* LocalStorage::get_wifi_profiles() const {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  return _wifi_profiles;
+}
+
 void LocalStorage::set_device_id(uint16_t device_id, bool force) {
-  if(force || (device_id != _device_id)) {
-    if(_memory.begin(memory_name)) {
-      _device_id = device_id;
-      _memory.putUShort(key_device_id, _device_id);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for device_id");
-    }
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (device_id != _device_id);
+  _device_id = device_id;
+  write_back(k_key_device_id, changed);
 }
 
 void LocalStorage::set_ap_password(const char* ap_password, bool force) {
-  if(force || (ap_password != nullptr && strlen(ap_password) < CONFIG_VAL_MAX)) {
-    if(_memory.begin(memory_name)) {
-      strcpy(_ap_password, ap_password);
-      _memory.putString(key_ap_password, _ap_password);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for ap_password");
-    }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  if(ap_password != nullptr && strlen(ap_password) < CONFIG_VAL_MAX) {
+    bool changed = force || strcmp(ap_password, _ap_password) != 0;
+    strcpy(_ap_password, ap_password);
+    write_back(k_key_ap_password, changed);
   }
 }
 
 void LocalStorage::set_wifi_ssid(const char* wifi_ssid, bool force) {
-  if(force || (wifi_ssid != nullptr && strlen(wifi_ssid) < CONFIG_VAL_MAX)) {
-    if(_memory.begin(memory_name)) {
-      strcpy(_wifi_ssid, wifi_ssid);
-      _memory.putString(key_wifi_ssid, _wifi_ssid);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for wifi_ssid");
-    }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  if(wifi_ssid != nullptr && strlen(wifi_ssid) < CONFIG_VAL_MAX) {
+    bool changed = force || strcmp(wifi_ssid, _wifi_profiles[0].ssid) != 0;
+    strcpy(_wifi_profiles[0].ssid, wifi_ssid);
+    write_back(k_key_wifi_ssid, changed);
   }
 }
 
 void LocalStorage::set_wifi_password(const char* wifi_password, bool force) {
-  if(force || (wifi_password != nullptr && strlen(wifi_password) < CONFIG_VAL_MAX)) {
-    if(_memory.begin(memory_name)) {
-      strcpy(_wifi_password, wifi_password);
-      _memory.putString(key_wifi_password, _wifi_password);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for wifi_password");
-    }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  if(wifi_password != nullptr && strlen(wifi_password) < CONFIG_VAL_MAX) {
+    bool changed = force || strcmp(wifi_password, _wifi_profiles[0].password) != 0;
+    strcpy(_wifi_profiles[0].password, wifi_password);
+    write_back(k_key_wifi_password, changed);
   }
 }
 
 void LocalStorage::set_api_key(const char* api_key, bool force) {
-  if(force || (api_key != nullptr && strlen(api_key) < CONFIG_VAL_MAX)) {
-    if(_memory.begin(memory_name)) {
-      strcpy(_api_key, api_key);
-      _memory.putString(key_api_key, _api_key);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for api_key");
-    }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  if(api_key != nullptr && strlen(api_key) < CONFIG_VAL_MAX) {
+    bool changed = force || strcmp(api_key, _api_key) != 0;
+    strcpy(_api_key, api_key);
+    write_back(k_key_api_key, changed);
   }
 }
 
 void LocalStorage::set_use_dev(bool use_dev, bool force) {
-  if(force || (use_dev != _use_dev)) {
-    if(_memory.begin(memory_name)) {
-      _use_dev = use_dev;
-      _memory.putBool(key_use_dev, use_dev);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for use_dev");
-    }
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (use_dev != _use_dev);
+  _use_dev = use_dev;
+  write_back(k_key_use_dev, changed);
 }
 
 void LocalStorage::set_led_color_blind(bool led_color_blind, bool force) {
-  if(force || (led_color_blind != _led_color_blind)) {
-    if(_memory.begin(memory_name)) {
-      _led_color_blind = led_color_blind;
-      _memory.putBool(key_led_color_blind, led_color_blind);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for key_led_color_blind");
-    }
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (led_color_blind != _led_color_blind);
+  _led_color_blind = led_color_blind;
+  write_back(k_key_led_color_blind, changed);
 }
 
 void LocalStorage::set_led_color_intensity(uint8_t led_color_intensity, bool force) {
-  if(force || (led_color_intensity != _led_color_intensity)) {
-    if(_memory.begin(memory_name)) {
-      _led_color_intensity = led_color_intensity;
-      _memory.putUChar(key_led_color_intensity, led_color_intensity);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for key_led_color_intensity");
-    }
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (led_color_intensity != _led_color_intensity);
+  _led_color_intensity = led_color_intensity;
+  write_back(k_key_led_color_intensity, changed);
 }
 
 void LocalStorage::set_saved_state(uint8_t saved_state, bool force) {
-  if(force || (saved_state != _saved_state)) {
-    if(_memory.begin(memory_name)) {
-      _saved_state = saved_state;
-      _memory.putChar(key_saved_state, saved_state);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for init_fixed");
-    }
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (saved_state != _saved_state);
+  _saved_state = saved_state;
+  write_back(k_key_saved_state, changed);
 }
 
 void LocalStorage::set_use_home_location(bool use_home_location, bool force) {
-  if(force || (use_home_location != _use_home_location)) {
-    if(_memory.begin(memory_name)) {
-      _use_home_location = use_home_location;
-      _memory.putBool(key_led_color_blind, use_home_location);
-      _memory.end();
-    } else {
-      DEBUG_PRINTLN("unable to save new value for key_led_color_blind");
-    }
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (use_home_location != _use_home_location);
+  _use_home_location = use_home_location;
+  write_back(k_key_use_home_location, changed);
 }
 
 void LocalStorage::set_home_longitude(double home_longtitude, bool force) {
-  if(_memory.begin(memory_name)) {
-    _home_longitude = home_longtitude;
-    _memory.putDouble(key_home_longtitude, home_longtitude);
-    _memory.end();
-  } else {
-    DEBUG_PRINTLN("unable to save new value for key_home_longtitude");
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (home_longtitude != _home_longitude);
+  _home_longitude = home_longtitude;
+  write_back(k_key_home_longitude, changed);
 }
 
 void LocalStorage::set_home_latitude(double home_latitude, bool force) {
-  if(_memory.begin(memory_name)) {
-    _home_latitude = home_latitude;
-    _memory.putDouble(key_home_latitude, home_latitude);
-    _memory.end();
-  } else {
-    DEBUG_PRINTLN("unable to save new value for key_home_latitude");
-  }
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (home_latitude != _home_latitude);
+  _home_latitude = home_latitude;
+  write_back(k_key_home_latitude, changed);
 }
 
 void LocalStorage::set_last_longitude(double last_longitude, bool force) {
-  if(_memory.begin(memory_name)) {
-    _last_longitude = last_longitude;
-    _memory.putDouble(key_last_longtitude, last_longitude);
-    _memory.end();
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (last_longitude != _last_longitude);
+  _last_longitude = last_longitude;
+  write_back(k_key_last_longitude, changed);
+}
+
+void LocalStorage::set_last_latitude(double last_latitude, bool force) {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  bool changed = force || (last_latitude != _last_latitude);
+  _last_latitude = last_latitude;
+  write_back(k_key_last_latitude, changed);
+}
+
+void LocalStorage::set_update_url(const char* update_url, bool force) {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  if(update_url != nullptr && strlen(update_url) < CONFIG_URL_MAX) {
+    bool changed = force || strcmp(update_url, _update_url) != 0;
+    strcpy(_update_url, update_url);
+    write_back(k_key_update_url, changed);
+  }
+}
+
+void LocalStorage::set_wifi_profile(uint8_t index,
+                                    const char* ssid,
+                                    const char* password,
+                                    uint8_t priority,
+                                    bool force) {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  if(index >= WIFI_PROFILE_COUNT || ssid == nullptr || password == nullptr
+      || strlen(ssid) >= CONFIG_VAL_MAX || strlen(password) >= CONFIG_VAL_MAX) {
+    return;
+  }
+  WiFiProfile& profile = _wifi_profiles[index];
+  priority = priority > WIFI_PRIORITY_MAX ? WIFI_PRIORITY_MAX : priority;
+  bool changed = force || priority != profile.priority;
+  if(index == 0) {
+    // Same keys as the wifi ssid / password settings
+    if(ssid != profile.ssid) {
+      set_wifi_ssid(ssid, force);
+    }
+    if(password != profile.password) {
+      set_wifi_password(password, force);
+    }
   } else {
-    DEBUG_PRINTLN("unable to save new value for key_last_longtitude");
+    changed = changed || strcmp(ssid, profile.ssid) != 0 || strcmp(password, profile.password) != 0;
+    if(ssid != profile.ssid) {
+      strcpy(profile.ssid, ssid);
+    }
+    if(password != profile.password) {
+      strcpy(profile.password, password);
+    }
   }
+  profile.priority = priority;
+  write_back(k_key_wifi_profiles, changed);
 }
 
-void LocalStorage::set_last_latitude(double last_latitude, bool force) {
-  if(_memory.begin(memory_name)) {
-    _last_latitude = last_latitude;
-    _memory.putDouble(key_last_latitude, last_latitude);
-    _memory.end();
+void LocalStorage::write_back(ConfigKey key, bool changed) {
+  ++_metrics.updates;
+  if(!changed) {
+    ++_metrics.unchanged;
+    return;
+  }
+  uint16_t bit = 1u << key;
+  if(_dirty.fetch_or(bit) & bit) {
+    ++_metrics.coalesced;
+  }
+}
+
+bool LocalStorage::is_dirty() const {
+  return _dirty.load() != 0;
+}
+
+const LocalStorage::StorageMetrics& LocalStorage::get_metrics() const {
+  return _metrics;
+}
+
+LocalStorage::LoadStatus LocalStorage::get_load_status() const {
+  return _load_status;
+}
+
+uint32_t LocalStorage::get_led_settings_revision() const {
+  return _led_settings_revision.load();
+}
+
+void LocalStorage::lock() const {
+  _values_lock.lock();
+}
+
+void LocalStorage::unlock() const {
+  _values_lock.unlock();
+}
+
+void LocalStorage::print_metrics(Print& out) const {
+  out.printf(
+      "Storage:\n"
+      "- updates: %u, unchanged: %u, coalesced: %u\n"
+      "- commits: %u, keys written: %u\n"
+      "- commit duration: %u us (max %u us)\n"
+      "- load status: %d, load duration: %u us (old layout: %u us)\n",
+      _metrics.updates, _metrics.unchanged, _metrics.coalesced,
+      _metrics.commits, _metrics.keys_written,
+      _metrics.last_commit_duration, _metrics.max_commit_duration,
+      _load_status, _metrics.load_duration, _metrics.legacy_load_duration
+  );
+}
+
+bool LocalStorage::commit() {
+  std::lock_guard<std::mutex> lock(_commit_lock);
+  uint16_t dirty = _dirty.exchange(0);
+  if(!dirty) {
+    return true;
+  }
+  uint32_t start = micros();
+  nvs_handle handle;
+  if(nvs_open(memory_name, NVS_READWRITE, &handle) != ESP_OK) {
+    DEBUG_PRINTLN("unable to open memory to save config");
+    _dirty.fetch_or(dirty);
+    return false;
+  }
+  StoredConfig config{};
+  {
+    // A setter on another task would write half of a string
+    std::lock_guard<std::recursive_mutex> guard(_values_lock);
+    get_values(config.values);
+  }
+  config.header.version = CONFIG_BLOB_VERSION;
+  config.header.size = sizeof(ConfigValues);
+  config.header.crc = config_crc(reinterpret_cast<const uint8_t*>(&config.values), sizeof(ConfigValues));
+
+  bool success = nvs_set_blob(handle, config_blob_key, &config, sizeof(config)) == ESP_OK
+      && nvs_commit(handle) == ESP_OK;
+  nvs_close(handle);
+  if(success) {
+    if(dirty & ((1u << k_key_led_color_blind) | (1u << k_key_led_color_intensity))) {
+      ++_led_settings_revision;
+    }
+    for(uint8_t key = 0; key < k_key_count; ++key) {
+      if(dirty & (1u << key)) {
+        ++_metrics.keys_written;
+      }
+    }
   } else {
-    DEBUG_PRINTLN("unable to save new value for key_last_latitude");
+    DEBUG_PRINTLN("unable to save config");
+    // Try again next commit
+    _dirty.fetch_or(dirty);
+  }
+
+  _last_commit = millis();
+  ++_metrics.commits;
+  _metrics.last_commit_duration = micros() - start;
+  if(_metrics.last_commit_duration > _metrics.max_commit_duration) {
+    _metrics.max_commit_duration = _metrics.last_commit_duration;
+  }
+  return success;
+}
+
+void LocalStorage::commit_if_due() {
+  uint16_t dirty = _dirty.load();
+  if(!dirty) {
+    return;
+  }
+  if((dirty & ~k_interval_keys) || millis() - _last_commit > STORAGE_COMMIT_INTERVAL_SECONDS * 1000) {
+    commit();
+  }
+}
+
+void LocalStorage::commit_on_shutdown() {
+  if(storage_instance) {
+    storage_instance->commit();
   }
 }
 
 bool LocalStorage::clear() {
+  std::lock_guard<std::mutex> lock(_commit_lock);
+  _dirty = 0;
   if(_memory.begin(memory_name)) {
     _memory.clear();
     _memory.end();
@@ -287,36 +461,203 @@ bool LocalStorage::clear() {
   return false;
 }
 
-bool LocalStorage::activate(bool) {
-  _memory.begin(memory_name, true);
-  _device_id = _memory.getUShort(key_device_id, D_DEVICE_ID);
-  if(_memory.getString(key_ap_password, _ap_password, CONFIG_VAL_MAX) == 0) {
+void LocalStorage::default_values(ConfigValues& values) {
+  memset(&values, 0, sizeof(ConfigValues));
+  values.device_id = D_DEVICE_ID;
+  strcpy(values.ap_password, D_ACCESS_POINT_PASSWORD);
+  strcpy(values.wifi_ssid, D_WIFI_SSID);
+  strcpy(values.wifi_password, D_WIFI_PASSWORD);
+  strcpy(values.api_key, D_APIKEY);
+  values.use_dev = D_USE_DEV_SERVER;
+  values.led_color_blind = D_LED_COLOR_BLIND;
+  values.led_color_intensity = D_LED_COLOR_INTENSITY;
+  values.saved_state = D_SAVED_STATE;
+  strcpy(values.update_url, D_UPDATE_URL);
+}
+
+void LocalStorage::get_values(ConfigValues& values) const {
+  memset(&values, 0, sizeof(ConfigValues));
+  values.device_id = _device_id;
+  strcpy(values.ap_password, _ap_password);
+  strcpy(values.wifi_ssid, _wifi_profiles[0].ssid);
+  strcpy(values.wifi_password, _wifi_profiles[0].password);
+  strcpy(values.api_key, _api_key);
+  values.use_dev = _use_dev;
+  values.led_color_blind = _led_color_blind;
+  values.led_color_intensity = _led_color_intensity;
+  values.saved_state = _saved_state;
+  values.use_home_location = _use_home_location;
+  values.home_longitude = _home_longitude;
+  values.home_latitude = _home_latitude;
+  values.last_longitude = _last_longitude;
+  values.last_latitude = _last_latitude;
+  strcpy(values.update_url, _update_url);
+  values.wifi_priority = _wifi_profiles[0].priority;
+  memcpy(values.wifi_profiles, _wifi_profiles + 1, sizeof(values.wifi_profiles));
+}
+
+void LocalStorage::set_values(const ConfigValues& values) {
+  std::lock_guard<std::recursive_mutex> guard(_values_lock);
+  _device_id = values.device_id;
+  strncpy(_ap_password, values.ap_password, CONFIG_VAL_MAX - 1);
+  strncpy(_wifi_profiles[0].ssid, values.wifi_ssid, CONFIG_VAL_MAX - 1);
+  strncpy(_wifi_profiles[0].password, values.wifi_password, CONFIG_VAL_MAX - 1);
+  strncpy(_api_key, values.api_key, CONFIG_VAL_MAX - 1);
+  _use_dev = values.use_dev;
+  _led_color_blind = values.led_color_blind;
+  _led_color_intensity = values.led_color_intensity;
+  _saved_state = values.saved_state;
+  _use_home_location = values.use_home_location;
+  _home_longitude = values.home_longitude;
+  _home_latitude = values.home_latitude;
+  _last_longitude = values.last_longitude;
+  _last_latitude = values.last_latitude;
+  strncpy(_update_url, values.update_url, CONFIG_URL_MAX - 1);
+  _wifi_profiles[0].priority = values.wifi_priority;
+  memcpy(_wifi_profiles + 1, values.wifi_profiles, sizeof(values.wifi_profiles));
+}
+
+LocalStorage::LoadStatus LocalStorage::load_blob() {
+  nvs_handle handle;
+  if(nvs_open(memory_name, NVS_READONLY, &handle) != ESP_OK) {
+    // Nothing stored yet
+    return e_config_defaults;
+  }
+  static_assert(sizeof(StoredConfig) <= CONFIG_BLOB_MAX_SIZE, "Config blob does not fit the load buffer");
+  static_assert(k_key_count <= 16, "Dirty flags are 16 bit");
+  static uint8_t buffer[CONFIG_BLOB_MAX_SIZE];
+  size_t length = sizeof(buffer);
+  esp_err_t result = nvs_get_blob(handle, config_blob_key, buffer, &length);
+  nvs_close(handle);
+  if(result == ESP_ERR_NVS_NOT_FOUND) {
+    return e_config_defaults;
+  }
+
+  ConfigHeader header{};
+  if(result != ESP_OK || length < sizeof(ConfigHeader)) {
+    return e_config_corrupted;
+  }
+  memcpy(&header, buffer, sizeof(ConfigHeader));
+  const uint8_t* stored_values = buffer + sizeof(ConfigHeader);
+  if(header.version == 0 || header.size != length - sizeof(ConfigHeader)
+      || header.crc != config_crc(stored_values, header.size)) {
+    return e_config_corrupted;
+  }
+
+  // Older versions only miss the values at the end, those keep their default
+  ConfigValues values{};
+  default_values(values);
+  memcpy(&values, stored_values, header.size < sizeof(ConfigValues) ? header.size : sizeof(ConfigValues));
+  values.ap_password[CONFIG_VAL_MAX - 1] = '\0';
+  values.wifi_ssid[CONFIG_VAL_MAX - 1] = '\0';
+  values.wifi_password[CONFIG_VAL_MAX - 1] = '\0';
+  values.api_key[CONFIG_VAL_MAX - 1] = '\0';
+  values.update_url[CONFIG_URL_MAX - 1] = '\0';
+  for(auto& profile : values.wifi_profiles) {
+    profile.ssid[CONFIG_VAL_MAX - 1] = '\0';
+    profile.password[CONFIG_VAL_MAX - 1] = '\0';
+  }
+  set_values(values);
+  return header.version < CONFIG_BLOB_VERSION ? e_config_upgraded : e_config_loaded;
+}
+
+LocalStorage::LoadStatus LocalStorage::load_legacy() {
+  if(!_memory.begin(memory_name, true)) {
+    return e_config_defaults;
+  }
+  bool found = false;
+  for(const auto& key : config_keys) {
+    if(_memory.isKey(key)) {
+      found = true;
+      break;
+    }
+  }
+  _device_id = _memory.getUShort(config_keys[k_key_device_id], D_DEVICE_ID);
+  if(_memory.getString(config_keys[k_key_ap_password], _ap_password, CONFIG_VAL_MAX) == 0) {
     strcpy(_ap_password, D_ACCESS_POINT_PASSWORD);
   }
-  if(_memory.getString(key_wifi_ssid, _wifi_ssid, CONFIG_VAL_MAX) == 0) {
-    strcpy(_wifi_ssid, D_WIFI_SSID);
+  if(_memory.getString(config_keys[k_key_wifi_ssid], _wifi_profiles[0].ssid, CONFIG_VAL_MAX) == 0) {
+    strcpy(_wifi_profiles[0].ssid, D_WIFI_SSID);
   }
-  if(_memory.getString(key_wifi_password, _wifi_password, CONFIG_VAL_MAX) == 0) {
-    strcpy(_wifi_password, D_WIFI_PASSWORD);
+  if(_memory.getString(config_keys[k_key_wifi_password], _wifi_profiles[0].password, CONFIG_VAL_MAX) == 0) {
+    strcpy(_wifi_profiles[0].password, D_WIFI_PASSWORD);
   }
-  if(_memory.getString(key_api_key, _api_key, CONFIG_VAL_MAX) == 0) {
+  if(_memory.getString(config_keys[k_key_api_key], _api_key, CONFIG_VAL_MAX) == 0) {
     strcpy(_api_key, D_APIKEY);
   }
-  _use_dev = _memory.getBool(key_use_dev, D_USE_DEV_SERVER);
-  _led_color_blind = _memory.getBool(key_led_color_blind, D_LED_COLOR_BLIND);
-  _led_color_intensity = _memory.getUChar(key_led_color_intensity, D_LED_COLOR_INTENSITY);
-  _saved_state = _memory.getChar(key_saved_state, D_SAVED_STATE);
-  _use_home_location = _memory.getBool(key_led_color_blind, false);
-  _home_longitude = _memory.getDouble(key_home_longtitude, 0);
-  _home_latitude = _memory.getDouble(key_home_latitude, 0);
-  _last_longitude = _memory.getDouble(key_last_longtitude, 0);
-  _last_latitude = _memory.getDouble(key_last_latitude, 0);
+  _use_dev = _memory.getBool(config_keys[k_key_use_dev], D_USE_DEV_SERVER);
+  _led_color_blind = _memory.getBool(config_keys[k_key_led_color_blind], D_LED_COLOR_BLIND);
+  _led_color_intensity = _memory.getUChar(config_keys[k_key_led_color_intensity], D_LED_COLOR_INTENSITY);
+  _saved_state = _memory.getChar(config_keys[k_key_saved_state], D_SAVED_STATE);
+  _use_home_location = _memory.getBool(config_keys[k_key_use_home_location], false);
+  _home_longitude = _memory.getDouble(config_keys[k_key_home_longitude], 0);
+  _home_latitude = _memory.getDouble(config_keys[k_key_home_latitude], 0);
+  _last_longitude = _memory.getDouble(config_keys[k_key_last_longitude], 0);
+  _last_latitude = _memory.getDouble(config_keys[k_key_last_latitude], 0);
+  strcpy(_update_url, D_UPDATE_URL);
   _memory.end();
+  return found ? e_config_migrated : e_config_defaults;
+}
+
+void LocalStorage::erase_legacy() {
+  if(_memory.begin(memory_name)) {
+    for(const auto& key : config_keys) {
+      _memory.remove(key);
+    }
+    _memory.end();
+  }
+}
+
+bool LocalStorage::activate(bool) {
+  uint32_t start = micros();
+  _load_status = load_blob();
+  _metrics.load_duration = micros() - start;
+
+  switch(_load_status) {
+    case e_config_defaults: {
+      // No blob yet, migrate the old layout if there is any
+      start = micros();
+      _load_status = load_legacy();
+      _metrics.legacy_load_duration = micros() - start;
+      if(_load_status == e_config_migrated) {
+        _dirty = (1u << k_key_count) - 1;
+        if(commit()) {
+          erase_legacy();
+        }
+        DEBUG_PRINTF("Config migrated to version %d\n", CONFIG_BLOB_VERSION);
+      }
+      break;
+    }
+    case e_config_upgraded:
+      _dirty = (1u << k_key_count) - 1;
+      commit();
+      DEBUG_PRINTF("Config upgraded to version %d\n", CONFIG_BLOB_VERSION);
+      break;
+    case e_config_corrupted: {
+      DEBUG_PRINTLN("Stored config is corrupted, using defaults");
+      ConfigValues values{};
+      default_values(values);
+      set_values(values);
+      // Overwritten with a valid config on the next commit
+      _dirty = (1u << k_key_count) - 1;
+      break;
+    }
+    default:
+      break;
+  }
+  _last_commit = millis();
+  ++_led_settings_revision;
+
+  if(!storage_instance) {
+    storage_instance = this;
+    esp_register_shutdown_handler(commit_on_shutdown);
+  }
   return true;
 }
 
 int8_t LocalStorage::handle_produced_work(const worker_status_t& worker_reports) {
   // Get reading data to store
+  int8_t status = HandlerStatus::e_handler_idle;
   const auto& reader = worker_reports.at(k_worker_bgeigie_connector);
   if(reader.is_fresh()) {
     const auto& reading = reader.get<Reading>();
@@ -325,7 +666,8 @@ int8_t LocalStorage::handle_produced_work(const worker_status_t& worker_reports)
       set_last_latitude(reading.get_latitude(), false);
       set_last_longitude(reading.get_longitude(), false);
     }
-    return HandlerStatus::e_handler_data_handled;
+    status = HandlerStatus::e_handler_data_handled;
   }
-  return HandlerStatus::e_handler_idle;
+  commit_if_due();
+  return status;
 }
@@ -1,25 +1,123 @@
 #ifndef BGEIGIECAST_ESP_CONFIG_H
 #define BGEIGIECAST_ESP_CONFIG_H
 
+#include <atomic>
+#include <mutex>
+#include <nvs.h>
 #include <Preferences.h>
 
 #include <Handler.hpp>
 
+#include "wifi_profiles.h"
+
 #define CONFIG_VAL_MAX 32
+#define CONFIG_URL_MAX 96
+
+// Version of the stored config layout, new fields are only added at the end of ConfigValues
+#define CONFIG_BLOB_VERSION 3 // 2: update_url, 3: wifi profiles
+#define CONFIG_BLOB_MAX_SIZE 512
 
 /**
- * Configurations for the ESP32, stored in the flash memory
+ * Configurations for the ESP32, stored in the flash memory as a single versioned blob with a CRC. Setters only update
+ * the cached value and mark it dirty, dirty values are written to the flash together by `commit()`. The handler
+ * commits settings on the next cycle and the frequently changing values (device id, last location) on an interval,
+ * see STORAGE_COMMIT_INTERVAL_SECONDS.
+ * Dirty values are also committed when the system restarts.
+ *
+ * The values are shared by the tasks, getters, setters and commits take the same lock. The strings and profiles of the
+ * getters can change after the getter returns, other tasks than the one that sets them copy them while holding the
+ * lock (`std::lock_guard<LocalStorage>`). The lock is not held during network or file I/O.
  */
 class LocalStorage : public Handler{
  public:
+  typedef enum ConfigKey {
+    k_key_device_id = 0,
+    k_key_ap_password,
+    k_key_wifi_ssid,
+    k_key_wifi_password,
+    k_key_api_key,
+    k_key_use_dev,
+    k_key_led_color_blind,
+    k_key_led_color_intensity,
+    k_key_saved_state,
+    k_key_use_home_location,
+    k_key_home_longitude,
+    k_key_home_latitude,
+    k_key_last_longitude,
+    k_key_last_latitude,
+    k_key_update_url,
+    k_key_wifi_profiles, // Priority of the first network and the other networks
+    k_key_count,
+  } ConfigKey;
+
+  typedef enum LoadStatus {
+    e_config_not_loaded,
+    e_config_loaded,
+    e_config_upgraded, // Loaded from an older version of the blob
+    e_config_migrated, // Loaded from the old layout with a key per value
+    e_config_defaults, // Nothing stored yet
+    e_config_corrupted, // Stored config is invalid, defaults are used
+  } LoadStatus;
+
+  struct StorageMetrics {
+    uint32_t updates; // Setter calls
+    uint32_t unchanged; // Setter calls with the current value, nothing to write
+    uint32_t coalesced; // Setter calls on a value that was already dirty, written once
+    uint32_t commits;
+    uint32_t keys_written;
+    uint32_t last_commit_duration; // micros
+    uint32_t max_commit_duration; // micros
+    uint32_t load_duration; // micros, loading the config at boot
+    uint32_t legacy_load_duration; // micros, loading the old layout (only when migrating)
+  };
+
   LocalStorage();
   virtual ~LocalStorage() = default;
 
   /**
-   * Reset settings to default (defined in user_config)
+   * Reset settings to default (defined in user_config), committed immediately
    */
   void reset_defaults();
 
+  /**
+   * Write all dirty values to the flash in a single transaction
+   * @return true if success (or nothing to write)
+   */
+  bool commit();
+
+  /**
+   * Check if there are values which are not written to the flash yet
+   */
+  bool is_dirty() const;
+
+  /**
+   * Get write metrics since boot, writes avoided by the cache is `unchanged + coalesced`
+   */
+  const StorageMetrics& get_metrics() const;
+
+  /**
+   * Get the result of loading the config at activation
+   */
+  LoadStatus get_load_status() const;
+
+  /**
+   * Changes when the LED settings were loaded or committed, so the LED only rebuilds its duty cycle table after a
+   * change
+   */
+  uint32_t get_led_settings_revision() const;
+
+  /**
+   * Print the write metrics
+   * @param out
+   */
+  void print_metrics(Print& out) const;
+
+  /**
+   * Lock the values, to read several values or copy the strings consistently. Can be nested.
+   */
+  void lock() const;
+  void unlock() const;
+
   // Getters and setters
   virtual uint16_t get_device_id() const final;
   virtual const char* get_ap_password() const final;
@@ -36,6 +134,13 @@ class LocalStorage : public Handler{
   virtual double get_home_latitude() const final;
   virtual double get_last_longitude() const final;
   virtual double get_last_latitude() const final;
+  virtual const char* get_update_url() const final;
+
+  /**
+   * Get the stored networks, the first is the network of `get_wifi_ssid` / `get_wifi_password`
+   * @return WIFI_PROFILE_COUNT profiles, unused profiles have an empty ssid
+   */
+  virtual const WiFiProfile* get_wifi_profiles() const final;
 
   virtual void set_device_id(uint16_t device_id, bool force);
   virtual void set_ap_password(const char* ap_password, bool force);
@@ -51,6 +156,8 @@ class LocalStorage : public Handler{
   virtual void set_home_latitude(double home_latitude, bool force);
   virtual void set_last_longitude(double last_longitude, bool force);
   virtual void set_last_latitude(double last_latitude, bool force);
+  virtual void set_update_url(const char* update_url, bool force);
+  virtual void set_wifi_profile(uint8_t index, const char* ssid, const char* password, uint8_t priority, bool force);
 
  protected:
   virtual bool clear();
@@ -61,7 +168,80 @@ class LocalStorage : public Handler{
   bool activate(bool) override;
   int8_t handle_produced_work(const worker_status_t& worker_reports) override;
  private:
+  struct __attribute__((packed)) ConfigHeader {
+    uint32_t crc; // of the values
+    uint16_t version;
+    uint16_t size; // of the values
+  };
+
+  struct __attribute__((packed)) ConfigValues {
+    uint16_t device_id;
+    char ap_password[CONFIG_VAL_MAX];
+    char wifi_ssid[CONFIG_VAL_MAX];
+    char wifi_password[CONFIG_VAL_MAX];
+    char api_key[CONFIG_VAL_MAX];
+    uint8_t use_dev;
+    uint8_t led_color_blind;
+    uint8_t led_color_intensity;
+    int8_t saved_state;
+    uint8_t use_home_location;
+    double home_longitude;
+    double home_latitude;
+    double last_longitude;
+    double last_latitude;
+    char update_url[CONFIG_URL_MAX];
+    uint8_t wifi_priority;
+    WiFiProfile wifi_profiles[WIFI_PROFILE_COUNT - 1]; // The networks after the first
+  };
+
+  struct __attribute__((packed)) StoredConfig {
+    ConfigHeader header;
+    ConfigValues values;
+  };
+
+  /**
+   * Mark a value as changed, to be written on the next commit
+   * @param key
+   * @param changed: false if the setter was called with the current value
+   */
+  void write_back(ConfigKey key, bool changed);
+
+  /**
+   * Load the config blob
+   * @return e_config_loaded / e_config_upgraded if success, e_config_defaults if there is no blob yet
+   */
+  LoadStatus load_blob();
+
+  /**
+   * Load the config from the old layout with a key per value
+   * @return e_config_migrated if any key was found, else e_config_defaults
+   */
+  LoadStatus load_legacy();
+
+  /**
+   * Remove the keys of the old layout
+   */
+  void erase_legacy();
+
+  static void default_values(ConfigValues& values);
+  void get_values(ConfigValues& values) const;
+  void set_values(const ConfigValues& values);
+
+  /**
+   * Commit dirty values if needed (settings immediately, frequently changing values on interval)
+   */
+  void commit_if_due();
+
+  static void commit_on_shutdown();
+
   Preferences _memory;
+  std::atomic<uint16_t> _dirty;
+  std::mutex _commit_lock;
+  mutable std::recursive_mutex _values_lock; // Setters call each other, taken after _commit_lock
+  uint32_t _last_commit;
+  StorageMetrics _metrics;
+  LoadStatus _load_status;
+  std::atomic<uint32_t> _led_settings_revision;
 
   // Device
   uint16_t _device_id;
@@ -69,9 +249,8 @@ class LocalStorage : public Handler{
   // Access point config (for web _ap_server)
   char _ap_password[CONFIG_VAL_MAX];
 
-  // Wifi config (to connect to the internet)
-  char _wifi_ssid[CONFIG_VAL_MAX];
-  char _wifi_password[CONFIG_VAL_MAX];
+  // Wifi config (to connect to the internet), the first network is the wifi_ssid / wifi_password setting
+  WiFiProfile _wifi_profiles[WIFI_PROFILE_COUNT];
 
   // API config (to connect to the API)
   char _api_key[CONFIG_VAL_MAX];
@@ -91,6 +270,9 @@ class LocalStorage : public Handler{
 
   double _last_longitude;
   double _last_latitude;
+
+  // Manifest of the firmware update server, empty to disable pulling updates
+  char _update_url[CONFIG_URL_MAX];
 };
 
 #endif //BGEIGIECAST_ESP_CONFIG_H
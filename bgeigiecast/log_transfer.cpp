@@ -0,0 +1,217 @@
+#include <string.h>
+
+#include "log_transfer.h"
+
+#define LOG_TRANSFER_REQUEST 'R'
+#define LOG_TRANSFER_ACK 'A'
+#define LOG_TRANSFER_NACK 'N'
+#define LOG_TRANSFER_CANCEL 'X'
+#define LOG_TRANSFER_INFO 'I'
+#define LOG_TRANSFER_DATA 'D'
+#define LOG_TRANSFER_END 'E'
+
+#define LOG_TRANSFER_DEFAULT_PACKET 20 // Default MTU of 23
+
+namespace {
+
+void write_u32(uint8_t* out, uint32_t value) {
+  out[0] = value & 0xFFu;
+  out[1] = (value >> 8u) & 0xFFu;
+  out[2] = (value >> 16u) & 0xFFu;
+  out[3] = value >> 24u;
+}
+
+uint32_t read_u32(const uint8_t* data) {
+  return data[0] | (data[1] << 8u) | (data[2] << 16u) | (static_cast<uint32_t>(data[3]) << 24u);
+}
+
+}
+
+LogTransfer::LogTransfer(LogSource& source, const Sender& sender) :
+    _source(source),
+    _sender(sender),
+    _state(e_transfer_idle),
+    _packet_size(LOG_TRANSFER_DEFAULT_PACKET),
+    _window(1),
+    _start(0),
+    _end(0),
+    _next(0),
+    _sent(0),
+    _acked(0),
+    _started_at(0),
+    _last_progress(0),
+    _packet(),
+    _metrics() {
+}
+
+void LogTransfer::set_packet_size(uint16_t size) {
+  if(size > LOG_TRANSFER_MAX_PACKET) {
+    size = LOG_TRANSFER_MAX_PACKET;
+  } else if(size <= LOG_TRANSFER_DATA_OVERHEAD) {
+    size = LOG_TRANSFER_DATA_OVERHEAD + 1;
+  }
+  _packet_size = size;
+}
+
+bool LogTransfer::handle_command(const uint8_t* command, size_t size, uint32_t now) {
+  if(size == 0) {
+    return false;
+  }
+  switch(command[0]) {
+    case LOG_TRANSFER_REQUEST: {
+      if(size != 6) {
+        return false;
+      }
+      uint32_t start = read_u32(command + 1);
+      _window = command[5] == 0 ? 1 : command[5] > LOG_TRANSFER_MAX_WINDOW ? LOG_TRANSFER_MAX_WINDOW : command[5];
+      _end = _source.get_end();
+      _start = start < _source.get_start() ? _source.get_start() : start > _end ? _end : start;
+      _next = _sent = _acked = _start;
+      _started_at = _last_progress = now;
+      _state = e_transfer_info;
+      ++_metrics.transfers;
+      return true;
+    }
+    case LOG_TRANSFER_ACK:
+    case LOG_TRANSFER_NACK: {
+      if(size != 5) {
+        return false;
+      }
+      uint32_t offset = read_u32(command + 1);
+      if(offset > _sent) {
+        return false;
+      }
+      if(_state != e_transfer_sending || offset < _acked) {
+        // Late, a newer acknowledgement already covered it
+        return true;
+      }
+      if(offset > _acked) {
+        _acked = offset;
+        _last_progress = now;
+        if(_next < _acked) {
+          // Went back after a timeout, but the client already had the data
+          go_back(_acked);
+        }
+      }
+      if(command[0] == LOG_TRANSFER_NACK) {
+        ++_metrics.gaps;
+        _last_progress = now;
+        go_back(offset);
+      }
+      return true;
+    }
+    case LOG_TRANSFER_CANCEL:
+      cancel();
+      return true;
+    default:
+      return false;
+  }
+}
+
+uint16_t LogTransfer::poll(uint32_t now) {
+  uint16_t sent = 0;
+  if(_state == e_transfer_info) {
+    if(!send_info()) {
+      return sent;
+    }
+    ++sent;
+    _state = e_transfer_sending;
+  }
+
+  if(_state == e_transfer_sending) {
+    uint32_t window_size = static_cast<uint32_t>(_window) * (_packet_size - LOG_TRANSFER_DATA_OVERHEAD);
+    while(_next < _end && _next - _acked < window_size && send_data()) {
+      ++sent;
+    }
+    if(_acked >= _end) {
+      _state = e_transfer_end;
+    } else if(now - _last_progress > LOG_TRANSFER_ACK_TIMEOUT_MILLIS) {
+      // Packets or acknowledgements were lost
+      ++_metrics.timeouts;
+      _last_progress = now;
+      go_back(_acked);
+    }
+  }
+
+  if(_state == e_transfer_end && send_end(now)) {
+    ++sent;
+    _state = e_transfer_idle;
+  }
+  return sent;
+}
+
+void LogTransfer::cancel() {
+  _state = e_transfer_idle;
+}
+
+bool LogTransfer::is_active() const {
+  return _state != e_transfer_idle;
+}
+
+const LogTransferMetrics& LogTransfer::get_metrics() const {
+  return _metrics;
+}
+
+uint16_t LogTransfer::crc16(const uint8_t* data, size_t size, uint16_t crc) {
+  while(size--) {
+    crc ^= static_cast<uint16_t>(*data++) << 8u;
+    for(uint8_t bit = 0; bit < 8; ++bit) {
+      crc = crc & 0x8000u ? (crc << 1u) ^ 0x1021u : crc << 1u;
+    }
+  }
+  return crc;
+}
+
+bool LogTransfer::send_info() {
+  _packet[0] = LOG_TRANSFER_INFO;
+  write_u32(_packet + 1, _start);
+  write_u32(_packet + 5, _end);
+  return _sender(_packet, 9);
+}
+
+bool LogTransfer::send_data() {
+  size_t size = _packet_size - LOG_TRANSFER_DATA_OVERHEAD;
+  if(size > _end - _next) {
+    size = _end - _next;
+  }
+  size = _source.read(_next, _packet + 5, size);
+  if(size == 0) {
+    // Removed from the log while sending, the client has to request again
+    cancel();
+    return false;
+  }
+  _packet[0] = LOG_TRANSFER_DATA;
+  write_u32(_packet + 1, _next);
+  uint16_t crc = crc16(_packet, size + 5);
+  _packet[size + 5] = crc & 0xFFu;
+  _packet[size + 6] = crc >> 8u;
+  if(!_sender(_packet, size + LOG_TRANSFER_DATA_OVERHEAD)) {
+    ++_metrics.congested;
+    return false;
+  }
+  if(_next < _sent) {
+    ++_metrics.resent;
+  }
+  _next += size;
+  if(_next > _sent) {
+    _sent = _next;
+  }
+  ++_metrics.packets;
+  _metrics.bytes += size;
+  return true;
+}
+
+bool LogTransfer::send_end(uint32_t now) {
+  _packet[0] = LOG_TRANSFER_END;
+  write_u32(_packet + 1, _end);
+  if(!_sender(_packet, 5)) {
+    return false;
+  }
+  _metrics.last_bytes = _end - _start;
+  _metrics.last_duration = now - _started_at;
+  return true;
+}
+
+void LogTransfer::go_back(uint32_t offset) {
+  _next = offset;
+}
@@ -0,0 +1,155 @@
+#ifndef BGEIGIECAST_LOG_TRANSFER_H
+#define BGEIGIECAST_LOG_TRANSFER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <functional>
+
+#ifndef LOG_TRANSFER_MAX_PACKET
+#define LOG_TRANSFER_MAX_PACKET 244 // Largest notification with the local MTU
+#endif
+
+#ifndef LOG_TRANSFER_MAX_WINDOW
+#define LOG_TRANSFER_MAX_WINDOW 32
+#endif
+
+#ifndef LOG_TRANSFER_ACK_TIMEOUT_MILLIS
+#define LOG_TRANSFER_ACK_TIMEOUT_MILLIS 500 // Send again from the last acknowledged offset after this
+#endif
+
+#define LOG_TRANSFER_DATA_OVERHEAD 7 // type, offset, crc
+
+/**
+ * Log the transfer reads from, offsets count from the first byte ever logged so they stay valid when old data is
+ * removed.
+ */
+class LogSource {
+ public:
+  virtual ~LogSource() = default;
+
+  /**
+   * @return offset of the oldest byte still available
+   */
+  virtual uint32_t get_start() const = 0;
+
+  /**
+   * @return offset after the newest byte
+   */
+  virtual uint32_t get_end() const = 0;
+
+  /**
+   * Read up to `size` bytes
+   * @return bytes read, 0 if the offset is no longer available
+   */
+  virtual size_t read(uint32_t offset, uint8_t* buffer, size_t size) = 0;
+};
+
+struct LogTransferMetrics {
+  uint32_t transfers;
+  uint32_t packets;
+  uint32_t bytes; // log bytes sent, including resent bytes
+  uint32_t resent; // packets sent again after a gap or timeout
+  uint32_t gaps; // negative acknowledgements of the client
+  uint32_t timeouts;
+  uint32_t congested; // packets refused by the link, sent again on the next poll
+  uint32_t last_bytes; // log bytes of the last completed transfer
+  uint32_t last_duration; // millis from the request until everything was acknowledged
+};
+
+/**
+ * Windowed bulk download of a log over a notification link.
+ *
+ * Client commands, all values little endian:
+ * - 'R' offset (4 bytes) window (1 byte): request the log from the offset, the device answers with 'I'
+ * - 'A' offset (4 bytes): everything before the offset was received, clients acknowledge every window / 2 packets
+ * - 'N' offset (4 bytes): gap or CRC error at the offset, the device sends again from there. Packets after a gap are
+ *   ignored by the client until the missing offset arrives.
+ * - 'X': cancel the transfer
+ *
+ * Device packets:
+ * - 'I' start (4 bytes) end (4 bytes): the range that will be sent, new data logged during the transfer is not included
+ * - 'D' offset (4 bytes) data crc (2 bytes): CRC-16/CCITT of the type, offset and data
+ * - 'E' end (4 bytes): everything was acknowledged
+ *
+ * At most `window` data packets are unacknowledged. Without an acknowledgement for LOG_TRANSFER_ACK_TIMEOUT_MILLIS
+ * the device sends again from the last acknowledged offset. A transfer is resumed by requesting it again from the last
+ * acknowledged offset.
+ */
+class LogTransfer {
+ public:
+  /**
+   * Sends a packet
+   * @return false if the link is congested, the packet is offered again on the next poll
+   */
+  typedef std::function<bool(const uint8_t* packet, size_t size)> Sender;
+
+  LogTransfer(LogSource& source, const Sender& sender);
+  virtual ~LogTransfer() = default;
+
+  /**
+   * Set the size of the packets, limited by the MTU of the link
+   */
+  void set_packet_size(uint16_t size);
+
+  /**
+   * Handle a command written by the client
+   * @param now: millis
+   * @return false if the command is invalid
+   */
+  bool handle_command(const uint8_t* command, size_t size, uint32_t now);
+
+  /**
+   * Send what the window allows
+   * @param now: millis
+   * @return amount of packets sent
+   */
+  uint16_t poll(uint32_t now);
+
+  /**
+   * Stop the transfer, for example when the client disconnects
+   */
+  void cancel();
+
+  bool is_active() const;
+
+  const LogTransferMetrics& get_metrics() const;
+
+  /**
+   * CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+   */
+  static uint16_t crc16(const uint8_t* data, size_t size, uint16_t crc = 0xFFFF);
+
+ private:
+  typedef enum State {
+    e_transfer_idle,
+    e_transfer_info,
+    e_transfer_sending,
+    e_transfer_end,
+  } State;
+
+  bool send_info();
+  bool send_data();
+  bool send_end(uint32_t now);
+
+  /**
+   * Continue sending from an earlier offset
+   */
+  void go_back(uint32_t offset);
+
+  LogSource& _source;
+  Sender _sender;
+  State _state;
+  uint16_t _packet_size;
+  uint8_t _window;
+  uint32_t _start;
+  uint32_t _end;
+  uint32_t _next; // offset of the next data packet
+  uint32_t _sent; // highest offset sent so far
+  uint32_t _acked;
+  uint32_t _started_at;
+  uint32_t _last_progress; // millis of the last acknowledgement or go back
+  uint8_t _packet[LOG_TRANSFER_MAX_PACKET];
+  LogTransferMetrics _metrics;
+};
+
+#endif //BGEIGIECAST_LOG_TRANSFER_H
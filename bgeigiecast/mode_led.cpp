@@ -10,13 +10,59 @@
 // Set this to true if we use anode LED
 #define RGB_STATE_LED_REVERSED true
 
+namespace {
+
+constexpr LedStep k_off[] = {{ModeLED::mode_color_off, 0, false}};
+// Blink once a second
+constexpr LedStep k_init[] = {{ModeLED::mode_color_init, 100, false}, {ModeLED::mode_color_off, 900, false}};
+constexpr LedStep k_post_init[] = {{ModeLED::mode_color_init, 100, false}, {ModeLED::mode_color_off, 566, false}};
+constexpr LedStep k_config[] = {{ModeLED::mode_color_config, 0, false}};
+constexpr LedStep k_config_connecting[] = {{ModeLED::mode_color_config, 500, false},
+                                           {ModeLED::mode_color_off, 500, false}};
+constexpr LedStep k_mobile_connected[] = {{ModeLED::mode_color_mobile, 0, false}};
+// Short flash every 3 seconds
+constexpr LedStep k_mobile_advertising[] = {{ModeLED::mode_color_mobile, 151, false},
+                                            {ModeLED::mode_color_off, 2879, false}};
+constexpr LedStep k_fixed_connected[] = {{ModeLED::mode_color_fixed_connected, 0, false}};
+constexpr LedStep k_fixed_connecting[] = {{ModeLED::mode_color_fixed_connected, 250, false},
+                                          {ModeLED::mode_color_off, 750, false}};
+constexpr LedStep k_fixed_invalid_reading[] = {{ModeLED::mode_color_fixed_hard_error, 454, false},
+                                               {ModeLED::mode_color_off, 2576, false}};
+// Connected, but the readings wait for the server: fades between connected and error
+constexpr LedStep k_fixed_remote_error[] = {{ModeLED::mode_color_fixed_connected, 1500, true},
+                                            {ModeLED::mode_color_fixed_soft_error, 1500, true}};
+constexpr LedStep k_reset[] = {{ModeLED::mode_color_fixed_hard_error, 0, false}};
+
+constexpr LedPattern k_patterns[ModeLED::e_pattern_COUNT] = {
+    LED_PATTERN(k_off),
+    LED_PATTERN(k_init),
+    LED_PATTERN(k_post_init),
+    LED_PATTERN(k_config),
+    LED_PATTERN(k_config_connecting),
+    LED_PATTERN(k_mobile_connected),
+    LED_PATTERN(k_mobile_advertising),
+    LED_PATTERN(k_fixed_connected),
+    LED_PATTERN(k_fixed_connecting),
+    LED_PATTERN(k_fixed_invalid_reading),
+    LED_PATTERN(k_fixed_remote_error),
+    LED_PATTERN(k_reset),
+};
+
+uint8_t blend(uint8_t from, uint8_t to, uint8_t level) {
+  return from + (static_cast<int16_t>(to) - from) * level / 255;
+}
+
+}
+
 ModeLED::ModeLED(LocalStorage& config) :
     RGBLed(RGB_LED_PIN_R, RGB_LED_PIN_G, RGB_LED_PIN_B, RGB_STATE_LED_REVERSED),
     Supervisor(),
     _config(config),
-    color(ModeColor::mode_color_off),
-    frequency(0),
-    percentage_on(0),
+    _pattern_id(e_pattern_COUNT),
+    _settings_revision(0),
+    _timer(nullptr),
+    _sequencer(),
+    _shown{0, 0, 0},
     _colorTypes{
         // Normal            Colorblind
         // R    G    B   ,   R    G    B
@@ -27,47 +73,76 @@ ModeLED::ModeLED(LocalStorage& config) :
         {{000, 255, 000}, {000, 255, 000}}, // fixed_connected
         {{127, 127, 000}, {127, 127, 000}}, // fixed_soft_error
         {{255, 000, 000}, {255, 000, 000}}, // fixed_hard_error
-    } {
-}
-
-void ModeLED::set_values(ModeLED::ModeColor _color, double _frequency, uint8_t _percentage_on) {
-  frequency = _frequency;
-  percentage_on = _percentage_on;
-  color = _color;
-  if(frequency == 0)
-    set_color(color);
+    },
+    _palette() {
+  for(uint8_t i = 0; i < mode_color_COUNT; ++i) {
+    _palette[i] = _colorTypes[i].normal;
+  }
 }
 
-void ModeLED::set_color(ModeLED::ModeColor _color) {
-  static ModeColor _last = mode_color_off;
-  if(_color != _last) {
-    _last = _color;
-    DEBUG_PRINT("Changed LED to ");
-    DEBUG_PRINTLN(_color);
-    set(_config.is_led_color_blind() ? _colorTypes[_color].color_blind : _colorTypes[_color].normal);
+void ModeLED::set_pattern(PatternId pattern_id) {
+  if(pattern_id == _pattern_id) {
+    return;
   }
+  DEBUG_PRINT("Changed LED to pattern ");
+  DEBUG_PRINTLN(pattern_id);
+  esp_timer_stop(_timer);
+  _pattern_id = pattern_id;
+  _sequencer.start(k_patterns[pattern_id]);
+  esp_timer_start_once(_timer, 0);
 }
 
-void ModeLED::loop() {
-  if(frequency > 0) {
-    // Blink LED
-    double blink_millis = 1000 / frequency;
-    auto cycle_now = millis() % static_cast<uint32_t>(blink_millis);
-    auto threshold = static_cast<uint32_t>(blink_millis * (percentage_on / 100.0));
-    if(cycle_now < threshold) {
-      set_color(color);
-    } else if(cycle_now > threshold) {
-      set_color(ModeLED::mode_color_off);
-    }
+void ModeLED::tick(void* arg) {
+  auto& led = *static_cast<ModeLED*>(arg);
+  LedFrame frame{};
+  uint32_t next_update = led._sequencer.update(frame);
+
+  const RGB& from = led._palette[frame.color];
+  const RGB& to = led._palette[frame.next_color];
+  RGB color{blend(from.r, to.r, frame.blend), blend(from.g, to.g, frame.blend), blend(from.b, to.b, frame.blend)};
+  if(color.r != led._shown.r || color.g != led._shown.g || color.b != led._shown.b) {
+    led._shown = color;
+    led.set(color);
+  }
+  if(next_update) {
+    esp_timer_start_once(led._timer, next_update * 1000);
   }
 }
 
-uint8_t ModeLED::get_intensity() const {
-  return _config.get_led_color_intensity();
+void ModeLED::update_settings() {
+  uint32_t revision = _config.get_led_settings_revision();
+  if(revision == _settings_revision) {
+    return;
+  }
+  _settings_revision = revision;
+  // The pattern starts again with the new settings
+  esp_timer_stop(_timer);
+  set_intensity(_config.get_led_color_intensity());
+  bool color_blind = _config.is_led_color_blind();
+  for(uint8_t i = 0; i < mode_color_COUNT; ++i) {
+    _palette[i] = color_blind ? _colorTypes[i].color_blind : _colorTypes[i].normal;
+  }
+  if(_pattern_id != e_pattern_COUNT) {
+    _sequencer.start(k_patterns[_pattern_id]);
+    // Written again even if the color did not change, the intensity may have changed
+    _shown = {0, 0, 0};
+    set(_shown);
+    esp_timer_start_once(_timer, 0);
+  }
 }
 
 bool ModeLED::activate() {
   init();
+  if(!_timer) {
+    esp_timer_create_args_t timer_args{};
+    timer_args.callback = &ModeLED::tick;
+    timer_args.arg = this;
+    timer_args.name = "mode_led";
+    if(esp_timer_create(&timer_args, &_timer) != ESP_OK) {
+      DEBUG_PRINTLN("Unable to create the LED timer");
+      return false;
+    }
+  }
   return true;
 }
 
@@ -75,27 +150,29 @@ void ModeLED::handle_report(const Report& report) {
   auto& worker_stats = report.get_worker_stats();
   auto& handler_stats = report.get_handler_stats();
 
+  update_settings();
+
   // Switch controller system state
   switch(handler_stats.at(k_handler_controller_handler).status) {
     case ControllerState::k_state_InitializeState:
     case ControllerState::k_state_InitReadingState:
       /// Initializing, blink every 1 second
-      set_values(mode_color_init, 1, 10);
+      set_pattern(e_pattern_init);
       break;
     case ControllerState::k_state_PostInitializeState:
       /// Post initializing, blink every 0.8 second ( this lasts for 3 seconds total )
-      set_values(mode_color_init, 1.5, 15);
+      set_pattern(e_pattern_post_init);
       break;
     case ControllerState::k_state_ConfigurationModeState:
       switch(worker_stats.at(k_worker_configuration_server).active_state) {
         case WorkerStatus::e_state_active:
           /// Configuration mode - up and running. no blink
-          set_values(mode_color_config);
+          set_pattern(e_pattern_config);
           break;
         case WorkerStatus::e_state_activating_failed:
         default:
           /// Configuration mode - connecting to wifi / settings up access point. blink
-          set_values(mode_color_config, 1, 50);
+          set_pattern(e_pattern_config_connecting);
           break;
       }
       break;
@@ -103,46 +180,46 @@ void ModeLED::handle_report(const Report& report) {
       switch(handler_stats.at(k_handler_bluetooth_reporter).status) {
         case BluetoothReporter::e_handler_clients_available:
           /// Mobile mode - Clients connected
-          set_values(mode_color_mobile);
+          set_pattern(e_pattern_mobile_connected);
           break;
         case BluetoothReporter::e_handler_idle:
         case BluetoothReporter::e_handler_no_clients:
         default:
           /// Mobile mode - No clients connected
-          set_values(mode_color_mobile, 0.33, 5);
+          set_pattern(e_pattern_mobile_advertising);
           break;
       }
       break;
     case ControllerState::k_state_FixedModeState:
       if(handler_stats.at(k_handler_api_reporter).active_state == HandlerStatus::e_state_activating_failed) {
         /// Fixed mode - Connecting to wifi, blink connected
-        set_values(mode_color_fixed_connected, 1, 25);
+        set_pattern(e_pattern_fixed_connecting);
         break;
       }
       switch(handler_stats.at(k_handler_api_reporter).status) {
         case ApiReporter::e_api_reporter_error_not_connected:
           /// Fixed mode - Lost connection to wifi, blink connected again
-          set_values(mode_color_fixed_connected, 1, 25);
+          set_pattern(e_pattern_fixed_connecting);
           break;
         case ApiReporter::e_api_reporter_error_invalid_reading:
           /// Fixed mode - Invalid reading (no good gps) TODO: add additional check for gps
-          set_values(mode_color_fixed_hard_error, 0.33, 15);
+          set_pattern(e_pattern_fixed_invalid_reading);
           break;
         case ApiReporter::e_api_reporter_error_remote_not_available:
         case ApiReporter::e_api_reporter_error_server_rejected_post:
-          /// Fixed mode - Remote is not available
-          set_values(mode_color_fixed_soft_error);
+          /// Fixed mode - Remote is not available, readings are kept to send later
+          set_pattern(e_pattern_fixed_remote_error);
           break;
         case ApiReporter::e_api_reporter_send_success:
         default:
           /// Fixed mode - All good and connected
-          set_values(mode_color_fixed_connected);
+          set_pattern(e_pattern_fixed_connected);
           break;
       }
       break;
     case ControllerState::k_state_ResetState:
       /// Reset - Display red because its least used TODO: custom color
-      set_values(mode_color_fixed_hard_error);
+      set_pattern(e_pattern_reset);
       break;
     default:
       break;
@@ -1,13 +1,17 @@
 #ifndef BGEIGIECAST_STATE_LED_H
 #define BGEIGIECAST_STATE_LED_H
 
+#include <esp_timer.h>
+
 #include "rgb_led.h"
+#include "led_sequencer.h"
 #include "local_storage.h"
 
 #include <Supervisor.hpp>
 
 /**
- * Controls the LED to visualize the current mode
+ * Controls the LED to visualize the current mode. Each mode has a pattern (see LedSequencer), played by an esp_timer so
+ * the main loop does not touch the LED.
  */
 class ModeLED : private RGBLed, public Supervisor {
  public:
@@ -22,21 +26,30 @@ class ModeLED : private RGBLed, public Supervisor {
     mode_color_COUNT
   } ModeColor;
 
+  typedef enum {
+    e_pattern_off,
+    e_pattern_init,
+    e_pattern_post_init,
+    e_pattern_config,
+    e_pattern_config_connecting,
+    e_pattern_mobile_connected,
+    e_pattern_mobile_advertising,
+    e_pattern_fixed_connected,
+    e_pattern_fixed_connecting,
+    e_pattern_fixed_invalid_reading,
+    e_pattern_fixed_remote_error,
+    e_pattern_reset,
+    e_pattern_COUNT
+  } PatternId;
+
   explicit ModeLED(LocalStorage& config);
   virtual ~ModeLED() = default;
 
   /**
-   * Set color
-   * @param color : color type (ModeColor)
-   * @param frequency : times per second to update if blink (0 for not blinking)
-   *    - example, frequency of 1 will blink once a second
-   * @param percentage_on : if frequency > 0, it will
-   *    - example, percentage of 25 with 1 frequency, will 0.25 second LED on then 0.75 second LED off
+   * Play a pattern, nothing changes if it is already playing
+   * @param pattern_id
    */
-  void set_values(ModeColor color, double frequency = 0, uint8_t percentage_on = 50);
-  void set_color(ModeColor color);
-
-  void loop();
+  void set_pattern(PatternId pattern_id);
 
   void handle_report(const Report& report) override;
 
@@ -47,13 +60,24 @@ class ModeLED : private RGBLed, public Supervisor {
     RGB color_blind;
   } ColorType;
 
-  uint8_t get_intensity() const override;
+  /**
+   * Apply the intensity and color blind settings if they were changed
+   */
+  void update_settings();
+
+  /**
+   * Timer callback (esp_timer task), shows the next frame of the pattern
+   */
+  static void tick(void* arg);
 
   const LocalStorage& _config;
-  ModeColor color;
-  double frequency;
-  uint8_t percentage_on;
+  PatternId _pattern_id;
+  uint32_t _settings_revision;
+  esp_timer_handle_t _timer;
+  LedSequencer _sequencer;
+  RGB _shown;
   const ColorType _colorTypes[ModeColor::mode_color_COUNT];
+  RGB _palette[ModeColor::mode_color_COUNT]; // colors of the current color blind setting
 };
 
 #endif //BGEIGIECAST_STATE_LED_H
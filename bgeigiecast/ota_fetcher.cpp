@@ -0,0 +1,232 @@
+#include <string.h>
+#include <stdlib.h>
+#include <chrono>
+
+#include "ota_fetcher.h"
+
+namespace {
+
+uint32_t now_micros() {
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+bool copy_value(char* destination, size_t destination_size, const char* value) {
+  if(strlen(value) >= destination_size) {
+    return false;
+  }
+  strcpy(destination, value);
+  return true;
+}
+
+}
+
+bool OtaManifest::parse(const char* text, OtaManifest& out) {
+  memset(&out, 0, sizeof(OtaManifest));
+  bool has_size = false;
+  char line[HTTP_URL_PATH_MAX + 16];
+  while(*text) {
+    size_t length = strcspn(text, "\r\n");
+    if(length < sizeof(line)) {
+      memcpy(line, text, length);
+      line[length] = '\0';
+      char* value = strchr(line, '=');
+      if(value && line[0] != '#') {
+        *value++ = '\0';
+        bool valid = true;
+        if(strcmp(line, "version") == 0) {
+          valid = copy_value(out.version, sizeof(out.version), value);
+        } else if(strcmp(line, "size") == 0) {
+          out.size = strtoul(value, nullptr, 10);
+          has_size = true;
+        } else if(strcmp(line, "sha256") == 0) {
+          valid = strlen(value) == OTA_SHA256_SIZE - 1 && copy_value(out.sha256, sizeof(out.sha256), value);
+        } else if(strcmp(line, "url") == 0) {
+          valid = copy_value(out.url, sizeof(out.url), value);
+        } else if(strcmp(line, "delta_from") == 0) {
+          valid = copy_value(out.delta_from, sizeof(out.delta_from), value);
+        } else if(strcmp(line, "delta_url") == 0) {
+          valid = copy_value(out.delta_url, sizeof(out.delta_url), value);
+        } else if(strcmp(line, "delta_size") == 0) {
+          out.delta_size = strtoul(value, nullptr, 10);
+        }
+        if(!valid) {
+          return false;
+        }
+      }
+    } else {
+      return false;
+    }
+    text += length;
+    text += strspn(text, "\r\n");
+  }
+  return out.version[0] && has_size && out.size > 0 && out.sha256[0] && out.url[0];
+}
+
+bool OtaManifest::has_delta_from(const char* current_version) const {
+  return delta_url[0] && delta_size > 0 && OtaFetcher::compare_versions(delta_from, current_version) == 0;
+}
+
+OtaFetcher::OtaFetcher(const char* user_agent) : _user_agent(user_agent), _metrics() {
+}
+
+OtaFetcher::Result OtaFetcher::check(const char* manifest_url, const char* current_version, OtaManifest& manifest) {
+  ++_metrics.checks;
+  HttpUrl url{};
+  if(!HttpUrl::parse(manifest_url, url)) {
+    return e_fetch_invalid_url;
+  }
+
+  char text[OTA_MANIFEST_SIZE];
+  size_t length = 0;
+  auto result = HttpDownload::get(url, 0, [&](const uint8_t* data, size_t size) {
+    if(length + size >= sizeof(text)) {
+      return false;
+    }
+    memcpy(text + length, data, size);
+    length += size;
+    return true;
+  }, _user_agent);
+  if(result.status < 0) {
+    return e_fetch_connection_failed;
+  }
+  text[length] = '\0';
+  if(result.status != 200 || !result.complete || !OtaManifest::parse(text, manifest)) {
+    return e_fetch_invalid_manifest;
+  }
+  return compare_versions(manifest.version, current_version) > 0 ? e_fetch_available : e_fetch_up_to_date;
+}
+
+OtaFetcher::Result OtaFetcher::fetch(const char* manifest_url,
+                                     const OtaManifest& manifest,
+                                     const DeltaPatcher::SourceReader* source,
+                                     const char* current_version,
+                                     const HttpDownload::Sink& sink) {
+  HttpUrl base{};
+  if(!HttpUrl::parse(manifest_url, base)) {
+    return e_fetch_invalid_url;
+  }
+  ++_metrics.downloads;
+  _metrics.transferred = 0;
+  _metrics.apply = 0;
+  _metrics.used_delta = source && manifest.has_delta_from(current_version);
+  uint32_t start = now_micros();
+  HttpUrl url{};
+  Result result;
+
+  if(_metrics.used_delta) {
+    if(!base.resolve(manifest.delta_url, url)) {
+      return e_fetch_invalid_manifest;
+    }
+    DeltaPatcher patcher(*source, sink);
+    result = download(url, manifest.delta_size, [&](const uint8_t* data, size_t size) {
+      uint32_t apply_start = now_micros();
+      bool success = patcher.write(data, size);
+      _metrics.apply += now_micros() - apply_start;
+      return success;
+    });
+    if(result == e_fetch_rejected || (result == e_fetch_done
+        && (!patcher.is_complete() || patcher.get_target_size() != manifest.size))) {
+      result = e_fetch_patch_failed;
+    }
+  } else {
+    if(!base.resolve(manifest.url, url)) {
+      return e_fetch_invalid_manifest;
+    }
+    result = download(url, manifest.size, [&](const uint8_t* data, size_t size) {
+      uint32_t apply_start = now_micros();
+      bool success = sink(data, size);
+      _metrics.apply += now_micros() - apply_start;
+      return success;
+    });
+  }
+
+  _metrics.download = now_micros() - start;
+  return result;
+}
+
+const OtaFetchMetrics& OtaFetcher::get_metrics() const {
+  return _metrics;
+}
+
+int OtaFetcher::compare_versions(const char* a, const char* b) {
+  if(*a == 'v' || *a == 'V') ++a;
+  if(*b == 'v' || *b == 'V') ++b;
+  while(*a || *b) {
+    char* a_end;
+    char* b_end;
+    unsigned long a_part = strtoul(a, &a_end, 10);
+    unsigned long b_part = strtoul(b, &b_end, 10);
+    if(a_part != b_part) {
+      return a_part < b_part ? -1 : 1;
+    }
+    if(a_end == a && b_end == b) {
+      // Not numeric, compare the rest as text
+      return strcmp(a, b);
+    }
+    a = *a_end == '.' ? a_end + 1 : a_end;
+    b = *b_end == '.' ? b_end + 1 : b_end;
+  }
+  return 0;
+}
+
+const char* OtaFetcher::result_name(Result result) {
+  switch(result) {
+    case e_fetch_up_to_date:
+      return "up to date";
+    case e_fetch_available:
+      return "update available";
+    case e_fetch_done:
+      return "done";
+    case e_fetch_invalid_url:
+      return "invalid url";
+    case e_fetch_connection_failed:
+      return "connection failed";
+    case e_fetch_invalid_manifest:
+      return "invalid manifest";
+    case e_fetch_download_failed:
+      return "download failed";
+    case e_fetch_patch_failed:
+      return "patch failed";
+    case e_fetch_rejected:
+      return "rejected";
+  }
+  return "unknown";
+}
+
+OtaFetcher::Result OtaFetcher::download(const HttpUrl& url, size_t size, const HttpDownload::Sink& sink) {
+  size_t received = 0;
+  bool too_large = false;
+  for(uint8_t attempt = 0; attempt <= OTA_FETCH_RETRIES; ++attempt) {
+    if(attempt > 0) {
+      ++_metrics.resumes;
+    }
+    auto result = HttpDownload::get(url, received, [&](const uint8_t* data, size_t data_size) {
+      if(received + data_size > size) {
+        too_large = true;
+        return false;
+      }
+      if(!sink(data, data_size)) {
+        return false;
+      }
+      received += data_size;
+      return true;
+    }, _user_agent);
+    _metrics.transferred += result.received;
+
+    if(too_large) {
+      return e_fetch_download_failed;
+    }
+    if(result.stopped) {
+      return e_fetch_rejected;
+    }
+    if(received == size) {
+      return e_fetch_done;
+    }
+    if(result.status >= 0 && result.received == 0) {
+      // Server refused, or nothing to resume
+      return e_fetch_download_failed;
+    }
+  }
+  return e_fetch_download_failed;
+}
@@ -0,0 +1,126 @@
+#ifndef BGEIGIECAST_OTA_FETCHER_H
+#define BGEIGIECAST_OTA_FETCHER_H
+
+#include "http_download.h"
+#include "delta_patch.h"
+
+#ifndef OTA_FETCH_RETRIES
+#define OTA_FETCH_RETRIES 3 // Resumes of an interrupted download
+#endif
+
+#ifndef OTA_MANIFEST_SIZE
+#define OTA_MANIFEST_SIZE 1024
+#endif
+
+#define OTA_VERSION_MAX 16
+#define OTA_SHA256_SIZE 65
+
+/**
+ * Firmware update manifest, a text file with `key=value` lines:
+ *
+ *     version=1.2.3
+ *     size=1234567
+ *     sha256=<hex digest of the image>
+ *     url=bgeigiecast-1.2.3.bin
+ *     delta_from=1.2.2
+ *     delta_url=bgeigiecast-1.2.2-1.2.3.patch
+ *     delta_size=23456
+ *
+ * Urls can be relative to the manifest. The delta keys are optional.
+ */
+struct OtaManifest {
+  char version[OTA_VERSION_MAX];
+  uint32_t size;
+  char sha256[OTA_SHA256_SIZE];
+  char url[HTTP_URL_PATH_MAX];
+  char delta_from[OTA_VERSION_MAX];
+  char delta_url[HTTP_URL_PATH_MAX];
+  uint32_t delta_size;
+
+  /**
+   * @return false if a required key is missing or a value is too long
+   */
+  static bool parse(const char* text, OtaManifest& out);
+
+  /**
+   * @return true if there is a patch from the given version
+   */
+  bool has_delta_from(const char* version) const;
+};
+
+struct OtaFetchMetrics {
+  uint32_t checks;
+  uint32_t downloads;
+  uint32_t resumes; // interrupted downloads continued with a range request
+  uint32_t transferred; // bytes of the last download
+  bool used_delta; // last download was a patch
+  uint32_t download; // micros of the last download, including applying it
+  uint32_t apply; // micros of the last download spent patching and passing the image to the sink
+};
+
+/**
+ * Checks a firmware update server for a new version and downloads it, as delta patch if there is one for the current
+ * version. Interrupted downloads are resumed where they stopped.
+ */
+class OtaFetcher {
+ public:
+  typedef enum Result {
+    e_fetch_up_to_date,
+    e_fetch_available,
+    e_fetch_done,
+    e_fetch_invalid_url,
+    e_fetch_connection_failed,
+    e_fetch_invalid_manifest,
+    e_fetch_download_failed,
+    e_fetch_patch_failed,
+    e_fetch_rejected, // the sink stopped the download
+  } Result;
+
+  explicit OtaFetcher(const char* user_agent = nullptr);
+  virtual ~OtaFetcher() = default;
+
+  /**
+   * Get the manifest and compare its version with the current version
+   * @param manifest_url
+   * @param current_version
+   * @param manifest: filled if the manifest is valid
+   * @return e_fetch_available if the manifest has a newer version
+   */
+  Result check(const char* manifest_url, const char* current_version, OtaManifest& manifest);
+
+  /**
+   * Download the image of a manifest
+   * @param manifest_url: to resolve the relative urls of the manifest
+   * @param manifest
+   * @param source: running image, to apply a patch to. nullptr to always get the complete image.
+   * @param current_version: version of the source
+   * @param sink: receives the new image, in order
+   * @return e_fetch_done if the complete image was passed to the sink
+   */
+  Result fetch(const char* manifest_url,
+               const OtaManifest& manifest,
+               const DeltaPatcher::SourceReader* source,
+               const char* current_version,
+               const HttpDownload::Sink& sink);
+
+  const OtaFetchMetrics& get_metrics() const;
+
+  /**
+   * Compare dotted numeric versions ("1.10.2"), a leading "v" is ignored
+   * @return <0, 0 or >0 like strcmp
+   */
+  static int compare_versions(const char* a, const char* b);
+
+  static const char* result_name(Result result);
+
+ private:
+  /**
+   * Download a file of a known size, resumes if the connection drops
+   */
+  Result download(const HttpUrl& url, size_t size, const HttpDownload::Sink& sink);
+
+  const char* _user_agent;
+  OtaFetchMetrics _metrics;
+};
+
+#endif //BGEIGIECAST_OTA_FETCHER_H
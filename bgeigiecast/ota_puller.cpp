@@ -0,0 +1,132 @@
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+
+#include "ota_puller.h"
+#include "wifi_connection.h"
+#include "debugger.h"
+#include "identifiers.h"
+
+#define OTA_CHECK_INTERVAL (OTA_CHECK_INTERVAL_MINUTES * 60 * 1000)
+
+OtaPuller::OtaPuller(LocalStorage& config) :
+    Handler(k_handler_ota_puller, k_group_network, e_priority_low),
+    _config(config),
+    _fetcher(HEADER_API_USER_AGENT),
+    _ota(),
+    _update_url(),
+    _last_check(0),
+    _checked(false),
+    _task_running(false),
+    _status(e_ota_puller_idle) {
+}
+
+const OtaFetcher& OtaPuller::get_fetcher() const {
+  return _fetcher;
+}
+
+bool OtaPuller::activate(bool) {
+  return WiFiConnection::wifi_connected();
+}
+
+int8_t OtaPuller::handle_produced_work(const worker_status_t&) {
+  if(_task_running) {
+    return _status;
+  }
+  {
+    std::lock_guard<LocalStorage> guard(_config);
+    strcpy(_update_url, _config.get_update_url());
+  }
+  if(_update_url[0] == '\0') {
+    return e_ota_puller_disabled;
+  }
+  if(_checked && millis() - _last_check < OTA_CHECK_INTERVAL) {
+    return _status;
+  }
+  _checked = true;
+  _last_check = millis();
+
+  _status = e_ota_puller_checking;
+  _task_running = true;
+  if(xTaskCreatePinnedToCore(
+      update_task, "OtaPuller", OTA_PULLER_STACK_SIZE, this, OTA_PULLER_PRIORITY, nullptr, NETWORK_TASK_CORE) != pdPASS) {
+    DEBUG_PRINTLN("OTA puller: could not start the update task");
+    _task_running = false;
+    _status = e_ota_puller_check_failed;
+  }
+  return _status;
+}
+
+void OtaPuller::update_task(void* puller_arg) {
+  auto puller = static_cast<OtaPuller*>(puller_arg);
+  auto status = puller->check_and_install();
+  if(status == e_ota_puller_restarting) {
+    DEBUG_PRINTLN("OTA puller: update installed, restarting");
+    delay(100);
+    ESP.restart();
+  }
+  puller->_status = status;
+  puller->_task_running = false;
+  vTaskDelete(nullptr);
+}
+
+OtaPuller::OtaPullerStatus OtaPuller::check_and_install() {
+  OtaManifest manifest{};
+  auto result = _fetcher.check(_update_url, BGEIGIECAST_VERSION, manifest);
+  if(result == OtaFetcher::e_fetch_up_to_date) {
+    return e_ota_puller_up_to_date;
+  }
+  if(result != OtaFetcher::e_fetch_available) {
+    DEBUG_PRINTF("OTA puller: check failed, %s\n", OtaFetcher::result_name(result));
+    return e_ota_puller_check_failed;
+  }
+
+  DEBUG_PRINTF("OTA puller: updating %s -> %s\n", BGEIGIECAST_VERSION, manifest.version);
+  _status = e_ota_puller_updating;
+  // Fall back to the full image if the patch does not produce the expected image
+  bool used_delta = false;
+  if(!install(manifest, true, used_delta) && !(used_delta && install(manifest, false, used_delta))) {
+    return e_ota_puller_update_failed;
+  }
+  return e_ota_puller_restarting;
+}
+
+bool OtaPuller::install(const OtaManifest& manifest, bool delta, bool& used_delta) {
+  used_delta = false;
+  auto begin_result = _ota.begin(manifest.size, manifest.sha256);
+  if(begin_result != OtaUpdater::e_ota_ok) {
+    DEBUG_PRINTF("OTA puller: %s\n", OtaUpdater::result_name(begin_result));
+    return false;
+  }
+
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  DeltaPatcher::SourceReader source = [running](uint32_t offset, uint8_t* buffer, size_t size) {
+    return esp_partition_read(running, offset, buffer, size) == ESP_OK;
+  };
+  auto fetch_result = _fetcher.fetch(
+      _update_url,
+      manifest,
+      delta && running ? &source : nullptr,
+      BGEIGIECAST_VERSION,
+      [this](const uint8_t* data, size_t size) { return _ota.write(data, size); }
+  );
+  used_delta = _fetcher.get_metrics().used_delta;
+  if(fetch_result != OtaFetcher::e_fetch_done) {
+    _ota.abort();
+    DEBUG_PRINTF("OTA puller: %s\n", OtaFetcher::result_name(fetch_result));
+    return false;
+  }
+
+  auto end_result = _ota.end();
+#if ENABLE_DEBUG
+  const auto& metrics = _fetcher.get_metrics();
+  DEBUG_PRINTF("OTA puller: %s, %u bytes transferred (%s), %u resumes, download %u us, apply %u us\n",
+               OtaUpdater::result_name(end_result),
+               metrics.transferred,
+               used_delta ? "delta" : "full image",
+               metrics.resumes,
+               metrics.download,
+               metrics.apply);
+  _ota.print_metrics(DEBUG_STREAM);
+#endif
+  return end_result == OtaUpdater::e_ota_ok;
+}
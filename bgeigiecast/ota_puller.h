@@ -0,0 +1,80 @@
+#ifndef BGEIGIECAST_OTA_PULLER_H
+#define BGEIGIECAST_OTA_PULLER_H
+
+#include <Handler.hpp>
+#include <atomic>
+
+#include "local_storage.h"
+#include "ota_fetcher.h"
+#include "ota_updater.h"
+#include "user_config.h"
+
+#ifndef OTA_PULLER_STACK_SIZE
+#define OTA_PULLER_STACK_SIZE 8192
+#endif
+
+#ifndef OTA_PULLER_PRIORITY
+#define OTA_PULLER_PRIORITY 1 // Same as the network task, below the OTA writer
+#endif
+
+/**
+ * Periodically checks the update server (configured update url) for a newer firmware and installs it. A delta patch
+ * against the running image is preferred, the full image is used if there is none or applying it failed. The device
+ * restarts into the new firmware once it is verified.
+ *
+ * The check and the download run on their own task, the handler only starts it when a check is due and reports its
+ * status, so the network task keeps serving the other handlers during an update.
+ */
+class OtaPuller : public Handler {
+ public:
+  enum OtaPullerStatus {
+    e_ota_puller_disabled,
+    e_ota_puller_idle,
+    e_ota_puller_up_to_date,
+    e_ota_puller_check_failed,
+    e_ota_puller_update_failed,
+    e_ota_puller_checking,
+    e_ota_puller_updating,
+    e_ota_puller_restarting,
+  };
+
+  explicit OtaPuller(LocalStorage& config);
+  virtual ~OtaPuller() = default;
+
+  const OtaFetcher& get_fetcher() const;
+
+ protected:
+  /**
+   * Only active while connected to a WiFi network
+   */
+  bool activate(bool retry) override;
+
+  int8_t handle_produced_work(const worker_status_t& worker_reports) override;
+
+ private:
+  static void update_task(void* puller);
+
+  /**
+   * Check the update server and install a new version, runs on the update task
+   */
+  OtaPullerStatus check_and_install();
+
+  /**
+   * Download and verify a new image
+   * @param delta: try the delta patch
+   * @param used_delta: set if this attempt downloaded the delta patch
+   * @return true if the new image will be booted after restart
+   */
+  bool install(const OtaManifest& manifest, bool delta, bool& used_delta);
+
+  LocalStorage& _config;
+  OtaFetcher _fetcher;
+  OtaUpdater _ota;
+  char _update_url[CONFIG_URL_MAX]; // copy for the update task
+  uint32_t _last_check;
+  bool _checked;
+  std::atomic<bool> _task_running;
+  std::atomic<OtaPullerStatus> _status; // written by the update task while it runs
+};
+
+#endif //BGEIGIECAST_OTA_PULLER_H
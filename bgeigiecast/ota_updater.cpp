@@ -0,0 +1,293 @@
+#include <Update.h>
+#include "ota_updater.h"
+#include "debugger.h"
+
+uint32_t OtaMetrics::network() const {
+  uint32_t spent = hash + wait + finish;
+  return total > spent ? total - spent : 0;
+}
+
+uint32_t OtaMetrics::bytes_per_second() const {
+  return total > 0 ? static_cast<uint32_t>(static_cast<uint64_t>(size) * 1000000 / total) : 0;
+}
+
+OtaUpdater::OtaUpdater() :
+    _running(false),
+    _expected_size(0),
+    _received(0),
+    _verify(false),
+    _expected_digest(),
+    _sha(),
+    _buffers{nullptr, nullptr},
+    _current(0),
+    _length(0),
+    _filled(nullptr),
+    _free(nullptr),
+    _stopped(nullptr),
+    _write_failed(false),
+    _started_at(0),
+    _metrics() {
+}
+
+OtaUpdater::~OtaUpdater() {
+  abort();
+}
+
+OtaUpdater::Result OtaUpdater::begin(size_t size, const char* sha256) {
+  abort();
+  _verify = sha256 != nullptr;
+  if(_verify && !parse_digest(sha256, _expected_digest)) {
+    return e_ota_invalid_digest;
+  }
+
+  _metrics = OtaMetrics();
+  _started_at = micros();
+  if(size == 0 || !flash_begin(size)) {
+    return e_ota_begin_failed;
+  }
+
+  _buffers[0] = static_cast<uint8_t*>(malloc(OTA_BUFFER_SIZE));
+  _buffers[1] = static_cast<uint8_t*>(malloc(OTA_BUFFER_SIZE));
+  _filled = xQueueCreate(2, sizeof(Chunk));
+  _free = xQueueCreate(2, sizeof(uint8_t));
+  _stopped = xSemaphoreCreateBinary();
+  if(!_buffers[0] || !_buffers[1] || !_filled || !_free || !_stopped) {
+    DEBUG_PRINTLN("Not enough memory for the update buffers");
+    if(_stopped) {
+      vSemaphoreDelete(_stopped);
+      _stopped = nullptr;
+    }
+    stop_writer();
+    flash_abort();
+    return e_ota_begin_failed;
+  }
+
+  // Start filling the first buffer, the second is free for the writer to return
+  _current = 0;
+  _length = 0;
+  uint8_t second = 1;
+  xQueueSend(_free, &second, 0);
+  _write_failed = false;
+  if(xTaskCreate(writer_task, "OtaWriter", OTA_WRITER_STACK_SIZE, this, OTA_WRITER_PRIORITY, nullptr) != pdPASS) {
+    vSemaphoreDelete(_stopped);
+    _stopped = nullptr;
+    stop_writer();
+    flash_abort();
+    return e_ota_begin_failed;
+  }
+
+  mbedtls_sha256_init(&_sha);
+  mbedtls_sha256_starts_ret(&_sha, 0);
+  _expected_size = size;
+  _received = 0;
+  _running = true;
+  return e_ota_ok;
+}
+
+bool OtaUpdater::write(const uint8_t* data, size_t size) {
+  if(!_running || _write_failed) {
+    return false;
+  }
+  _received += size;
+  if(_received > _expected_size) {
+    return false;
+  }
+
+  uint32_t start = micros();
+  mbedtls_sha256_update_ret(&_sha, data, size);
+  while(size > 0) {
+    size_t space = OTA_BUFFER_SIZE - _length;
+    size_t part = size < space ? size : space;
+    memcpy(_buffers[_current] + _length, data, part);
+    _length += part;
+    data += part;
+    size -= part;
+    if(_length == OTA_BUFFER_SIZE) {
+      _metrics.hash += micros() - start;
+      if(!submit_buffer()) {
+        return false;
+      }
+      start = micros();
+    }
+  }
+  _metrics.hash += micros() - start;
+  return true;
+}
+
+OtaUpdater::Result OtaUpdater::end() {
+  if(!_running) {
+    return e_ota_not_started;
+  }
+  uint32_t start = micros();
+  _running = false;
+
+  // Write the last part and wait for the writer to complete
+  if(_length > 0) {
+    Chunk chunk{_current, static_cast<uint16_t>(_length)};
+    xQueueSend(_filled, &chunk, portMAX_DELAY);
+  }
+  stop_writer();
+
+  uint8_t digest[OTA_DIGEST_SIZE];
+  mbedtls_sha256_finish_ret(&_sha, digest);
+  mbedtls_sha256_free(&_sha);
+
+  Result result = e_ota_ok;
+  if(_write_failed) {
+    result = e_ota_write_failed;
+  } else if(_received != _expected_size) {
+    result = e_ota_size_mismatch;
+  } else if(_verify && memcmp(digest, _expected_digest, OTA_DIGEST_SIZE) != 0) {
+    result = e_ota_digest_mismatch;
+  } else if(!flash_end()) {
+    result = e_ota_end_failed;
+  }
+  if(result != e_ota_ok) {
+    flash_abort();
+  }
+
+  _metrics.size = _received;
+  _metrics.finish = micros() - start;
+  _metrics.total = micros() - _started_at;
+  return result;
+}
+
+void OtaUpdater::abort() {
+  if(!_running) {
+    return;
+  }
+  _running = false;
+  stop_writer();
+  mbedtls_sha256_free(&_sha);
+  flash_abort();
+}
+
+bool OtaUpdater::is_running() const {
+  return _running;
+}
+
+const OtaMetrics& OtaUpdater::get_metrics() const {
+  return _metrics;
+}
+
+void OtaUpdater::print_metrics(Print& out) const {
+  out.printf(
+      "OTA:\n"
+      "- size: %u bytes, %u bytes/s\n"
+      "- total: %u us, network: %u us, hashing: %u us, waiting for flash: %u us\n"
+      "- flash writes: %u us, finish: %u us\n",
+      _metrics.size, _metrics.bytes_per_second(),
+      _metrics.total, _metrics.network(), _metrics.hash, _metrics.wait,
+      _metrics.flash, _metrics.finish
+  );
+}
+
+bool OtaUpdater::parse_digest(const char* hex, uint8_t digest[OTA_DIGEST_SIZE]) {
+  if(!hex || strlen(hex) != OTA_DIGEST_SIZE * 2) {
+    return false;
+  }
+  for(uint8_t i = 0; i < OTA_DIGEST_SIZE * 2; ++i) {
+    char c = hex[i];
+    uint8_t nibble;
+    if(c >= '0' && c <= '9') {
+      nibble = c - '0';
+    } else if(c >= 'a' && c <= 'f') {
+      nibble = c - 'a' + 10;
+    } else if(c >= 'A' && c <= 'F') {
+      nibble = c - 'A' + 10;
+    } else {
+      return false;
+    }
+    digest[i / 2] = i % 2 ? (digest[i / 2] | nibble) : (nibble << 4);
+  }
+  return true;
+}
+
+const char* OtaUpdater::result_name(Result result) {
+  switch(result) {
+    case e_ota_ok:
+      return "ok";
+    case e_ota_not_started:
+      return "not started";
+    case e_ota_invalid_digest:
+      return "invalid digest";
+    case e_ota_begin_failed:
+      return "unable to start";
+    case e_ota_write_failed:
+      return "flash write failed";
+    case e_ota_size_mismatch:
+      return "size mismatch";
+    case e_ota_digest_mismatch:
+      return "digest mismatch";
+    case e_ota_end_failed:
+      return "unable to activate";
+  }
+  return "unknown";
+}
+
+bool OtaUpdater::flash_begin(size_t size) {
+  return Update.begin(size);
+}
+
+bool OtaUpdater::flash_write(uint8_t* data, size_t size) {
+  return Update.write(data, size) == size;
+}
+
+bool OtaUpdater::flash_end() {
+  return Update.end(true);
+}
+
+void OtaUpdater::flash_abort() {
+  Update.abort();
+}
+
+void OtaUpdater::writer_task(void* updater_arg) {
+  auto updater = static_cast<OtaUpdater*>(updater_arg);
+  Chunk chunk{};
+  while(xQueueReceive(updater->_filled, &chunk, portMAX_DELAY) == pdTRUE && chunk.length > 0) {
+    if(!updater->_write_failed) {
+      uint32_t start = micros();
+      if(!updater->flash_write(updater->_buffers[chunk.buffer], chunk.length)) {
+        updater->_write_failed = true;
+      }
+      updater->_metrics.flash += micros() - start;
+    }
+    // Always return the buffer, the receiving side might be waiting for it
+    xQueueSend(updater->_free, &chunk.buffer, portMAX_DELAY);
+  }
+  xSemaphoreGive(updater->_stopped);
+  vTaskDelete(nullptr);
+}
+
+bool OtaUpdater::submit_buffer() {
+  uint32_t start = micros();
+  Chunk chunk{_current, static_cast<uint16_t>(_length)};
+  xQueueSend(_filled, &chunk, portMAX_DELAY);
+  xQueueReceive(_free, &_current, portMAX_DELAY);
+  _length = 0;
+  _metrics.wait += micros() - start;
+  return !_write_failed;
+}
+
+void OtaUpdater::stop_writer() {
+  if(_stopped) {
+    Chunk stop{0, 0};
+    xQueueSend(_filled, &stop, portMAX_DELAY);
+    xSemaphoreTake(_stopped, portMAX_DELAY);
+    vSemaphoreDelete(_stopped);
+    _stopped = nullptr;
+  }
+  if(_filled) {
+    vQueueDelete(_filled);
+    _filled = nullptr;
+  }
+  if(_free) {
+    vQueueDelete(_free);
+    _free = nullptr;
+  }
+  for(auto& buffer : _buffers) {
+    free(buffer);
+    buffer = nullptr;
+  }
+  _length = 0;
+}
@@ -0,0 +1,158 @@
+#ifndef BGEIGIECAST_OTA_UPDATER_H
+#define BGEIGIECAST_OTA_UPDATER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <mbedtls/sha256.h>
+
+#ifndef OTA_BUFFER_SIZE
+#define OTA_BUFFER_SIZE 4096 // One flash sector
+#endif
+
+#ifndef OTA_WRITER_STACK_SIZE
+#define OTA_WRITER_STACK_SIZE 4096
+#endif
+
+#ifndef OTA_WRITER_PRIORITY
+#define OTA_WRITER_PRIORITY 2
+#endif
+
+#define OTA_DIGEST_SIZE 32
+
+/**
+ * Timing of the last update, all durations in micros
+ */
+struct OtaMetrics {
+  uint32_t size;
+  uint32_t total; // from begin until the end
+  uint32_t hash; // spent by the caller hashing and buffering the data
+  uint32_t wait; // spent by the caller waiting for a free buffer, flash writing is the bottleneck
+  uint32_t flash; // spent writing to flash by the writer task
+  uint32_t finish; // writing the last buffer, verifying and activating the new image
+
+  /**
+   * @return time the caller spent receiving the data, outside of the updater
+   */
+  uint32_t network() const;
+
+  /**
+   * @return average throughput of the whole update
+   */
+  uint32_t bytes_per_second() const;
+};
+
+/**
+ * Writes a new firmware image to the ota partition while it is being received. Data is collected in one of two
+ * buffers, full buffers are written to flash by a separate task so receiving the next buffer overlaps with flash
+ * programming. The image is hashed on the fly and is only activated if it matches the expected SHA-256 digest.
+ */
+class OtaUpdater {
+ public:
+  typedef enum Result {
+    e_ota_ok,
+    e_ota_not_started,
+    e_ota_invalid_digest,
+    e_ota_begin_failed,
+    e_ota_write_failed,
+    e_ota_size_mismatch,
+    e_ota_digest_mismatch,
+    e_ota_end_failed,
+  } Result;
+
+  OtaUpdater();
+  virtual ~OtaUpdater();
+
+  /**
+   * Start an update
+   * @param size: size of the image
+   * @param sha256: expected digest as hex string, nullptr to skip the verification
+   * @return e_ota_ok if the update was started
+   */
+  Result begin(size_t size, const char* sha256 = nullptr);
+
+  /**
+   * Add the next part of the image, blocks if both buffers are waiting to be written
+   * @return false if the update failed, call `end` to get the reason
+   */
+  bool write(const uint8_t* data, size_t size);
+
+  /**
+   * Write the remaining data and wait until it is in flash, then verify the image and activate it. Aborts the update
+   * if anything went wrong.
+   * @return e_ota_ok if the new image will be used after reboot
+   */
+  Result end();
+
+  /**
+   * Stop the update, the current image stays active
+   */
+  void abort();
+
+  bool is_running() const;
+
+  /**
+   * Get the timing of the last update
+   */
+  const OtaMetrics& get_metrics() const;
+
+  /**
+   * Print the timing of the last update
+   * @param out
+   */
+  void print_metrics(Print& out) const;
+
+  /**
+   * Parse a hex encoded SHA-256 digest
+   * @return false if it is not a valid digest
+   */
+  static bool parse_digest(const char* hex, uint8_t digest[OTA_DIGEST_SIZE]);
+
+  static const char* result_name(Result result);
+
+ protected:
+  /**
+   * Flash access, overridden by tests
+   */
+  virtual bool flash_begin(size_t size);
+  virtual bool flash_write(uint8_t* data, size_t size);
+  virtual bool flash_end();
+  virtual void flash_abort();
+
+ private:
+  struct Chunk {
+    uint8_t buffer;
+    uint16_t length; // 0 to stop the writer
+  };
+
+  static void writer_task(void* updater);
+
+  /**
+   * Pass the current buffer to the writer and wait for the next free buffer
+   */
+  bool submit_buffer();
+
+  /**
+   * Stop the writer task and release the buffers
+   */
+  void stop_writer();
+
+  bool _running;
+  size_t _expected_size;
+  size_t _received;
+  bool _verify;
+  uint8_t _expected_digest[OTA_DIGEST_SIZE];
+  mbedtls_sha256_context _sha;
+
+  uint8_t* _buffers[2];
+  uint8_t _current;
+  size_t _length;
+  QueueHandle_t _filled;
+  QueueHandle_t _free;
+  SemaphoreHandle_t _stopped;
+  std::atomic<bool> _write_failed;
+
+  uint32_t _started_at;
+  OtaMetrics _metrics;
+};
+
+#endif //BGEIGIECAST_OTA_UPDATER_H
@@ -0,0 +1,128 @@
+#include <LITTLEFS.h>
+
+#include "reading_log.h"
+#include "user_config.h"
+#include "debugger.h"
+
+#define READING_LOG_OLDER "/log0"
+#define READING_LOG_CURRENT "/log1"
+#define READING_LOG_START "/log_start"
+
+ReadingLog::ReadingLog() :
+    _mounted(false),
+    _start(0),
+    _older_size(0),
+    _current_size(0),
+    _reader(),
+    _reader_current(false) {
+}
+
+bool ReadingLog::begin() {
+  if(_mounted) {
+    return true;
+  }
+  // Formats the partition when it was never used
+  if(!LITTLEFS.begin(true)) {
+    DEBUG_PRINTLN("Unable to mount the reading log");
+    return false;
+  }
+  _mounted = true;
+
+  File file = LITTLEFS.open(READING_LOG_START, "r");
+  if(file) {
+    file.read(reinterpret_cast<uint8_t*>(&_start), sizeof(_start));
+    file.close();
+  }
+  file = LITTLEFS.open(READING_LOG_OLDER, "r");
+  if(file) {
+    _older_size = file.size();
+    file.close();
+  }
+  file = LITTLEFS.open(READING_LOG_CURRENT, "r");
+  if(file) {
+    _current_size = file.size();
+    file.close();
+  }
+  DEBUG_PRINTF("Reading log from %u to %u\n", get_start(), get_end());
+  return true;
+}
+
+bool ReadingLog::append(const char* sentence) {
+  if(!_mounted) {
+    return false;
+  }
+  if(_current_size >= READING_LOG_FILE_SIZE) {
+    rotate();
+  }
+  if(_reader && _reader_current) {
+    // Open handles do not see the appended data
+    _reader.close();
+  }
+  File file = LITTLEFS.open(READING_LOG_CURRENT, "a");
+  if(!file) {
+    return false;
+  }
+  size_t size = strlen(sentence);
+  size_t written = file.write(reinterpret_cast<const uint8_t*>(sentence), size);
+  written += file.write('\n');
+  file.close();
+  _current_size += written;
+  return written == size + 1;
+}
+
+uint32_t ReadingLog::get_start() const {
+  return _start;
+}
+
+uint32_t ReadingLog::get_end() const {
+  return _start + _older_size + _current_size;
+}
+
+size_t ReadingLog::read(uint32_t offset, uint8_t* buffer, size_t size) {
+  if(!_mounted || offset < get_start() || offset >= get_end()) {
+    return 0;
+  }
+  uint32_t position = offset - _start;
+  bool current = position >= _older_size;
+  if(current) {
+    position -= _older_size;
+  }
+  // Reads stay within one file, the transfer continues in the next file with the next read
+  uint32_t file_size = current ? _current_size : _older_size;
+  if(size > file_size - position) {
+    size = file_size - position;
+  }
+
+  if(!_reader || _reader_current != current) {
+    if(_reader) {
+      _reader.close();
+    }
+    _reader = LITTLEFS.open(current ? READING_LOG_CURRENT : READING_LOG_OLDER, "r");
+    _reader_current = current;
+    if(!_reader) {
+      return 0;
+    }
+  }
+  if(_reader.position() != position && !_reader.seek(position)) {
+    return 0;
+  }
+  return _reader.read(buffer, size);
+}
+
+void ReadingLog::rotate() {
+  if(_reader) {
+    _reader.close();
+  }
+  LITTLEFS.remove(READING_LOG_OLDER);
+  LITTLEFS.rename(READING_LOG_CURRENT, READING_LOG_OLDER);
+  _start += _older_size;
+  _older_size = _current_size;
+  _current_size = 0;
+
+  File file = LITTLEFS.open(READING_LOG_START, "w");
+  if(file) {
+    file.write(reinterpret_cast<const uint8_t*>(&_start), sizeof(_start));
+    file.close();
+  }
+  DEBUG_PRINTF("Reading log rotated, starts at %u\n", _start);
+}
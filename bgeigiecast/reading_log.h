@@ -0,0 +1,51 @@
+#ifndef BGEIGIECAST_READING_LOG_H
+#define BGEIGIECAST_READING_LOG_H
+
+#include <FS.h>
+
+#include "log_transfer.h"
+
+/**
+ * Readings stored in the flash (LittleFS), one sentence per line, so clients that were out of range can download them
+ * later (see LogTransfer).
+ *
+ * The log rotates between two files: when the current file is full it becomes the older file and the previous older
+ * file is removed. Offsets count from the first sentence ever logged, the offset of the older file is stored next to
+ * the files so a client can resume a download after a restart.
+ */
+class ReadingLog : public LogSource {
+ public:
+  ReadingLog();
+  virtual ~ReadingLog() = default;
+
+  /**
+   * Mount the file system and load the offsets
+   * @return true if the log can be used
+   */
+  bool begin();
+
+  /**
+   * Add a sentence to the log
+   * @return false if it could not be written
+   */
+  bool append(const char* sentence);
+
+  uint32_t get_start() const override;
+  uint32_t get_end() const override;
+  size_t read(uint32_t offset, uint8_t* buffer, size_t size) override;
+
+ private:
+  /**
+   * Current file becomes the older file
+   */
+  void rotate();
+
+  bool _mounted;
+  uint32_t _start; // offset of the older file
+  uint32_t _older_size;
+  uint32_t _current_size;
+  File _reader;
+  bool _reader_current; // _reader has the current file open
+};
+
+#endif //BGEIGIECAST_READING_LOG_H
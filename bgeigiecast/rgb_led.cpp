@@ -1,3 +1,5 @@
+#include <math.h>
+
 #include "rgb_led.h"
 
 #define CHANNEL_R 0
@@ -5,12 +7,17 @@
 #define CHANNEL_B 2
 
 #define CHANNEL_FREQUENCY 12800
-#define CHANNEL_RESOLUTION 8
+#define CHANNEL_RESOLUTION 12 // Enough steps to keep low intensities distinct after the gamma correction
+#define CHANNEL_MAX_DUTY ((1u << CHANNEL_RESOLUTION) - 1)
 
-RGBLed::RGBLed(uint8_t pin_r, uint8_t pin_g, uint8_t pin_b, bool reversed) : _reversed(reversed), config_intensity(30) {
+RGBLed::RGBLed(uint8_t pin_r, uint8_t pin_g, uint8_t pin_b, bool reversed) :
+    _reversed(reversed),
+    config_intensity(30),
+    _duty() {
   ledcAttachPin(pin_r, CHANNEL_R);
   ledcAttachPin(pin_g, CHANNEL_G);
   ledcAttachPin(pin_b, CHANNEL_B);
+  update_duty_table();
 }
 
 void RGBLed::init() {
@@ -34,7 +41,10 @@ void RGBLed::off() {
 }
 
 void RGBLed::set_intensity(uint8_t intensity) {
-  config_intensity = intensity;
+  if(intensity != config_intensity) {
+    config_intensity = intensity;
+    update_duty_table();
+  }
 }
 
 uint8_t RGBLed::get_intensity() const {
@@ -54,7 +64,15 @@ void RGBLed::set_b(uint8_t value) {
 }
 
 void RGBLed::set_channel(uint8_t channel, uint8_t value) {
-  uint32_t modified_value = static_cast<int32_t>((get_intensity() / 255.0) * value);
-  // using 256 below because when its inverted 255 will still be very dim, 256 will be 100% turned off.
-  ledcWrite(channel, _reversed ? (256 - modified_value) : modified_value);
+  ledcWrite(channel, _duty[value]);
+}
+
+void RGBLed::update_duty_table() {
+  // Gamma on the intensity only, channel values stay linear so the palette colors mix as defined
+  float max_duty = CHANNEL_MAX_DUTY * powf(config_intensity / 255.0f, RGB_LED_GAMMA);
+  for(uint16_t value = 0; value < 256; ++value) {
+    auto duty = static_cast<uint16_t>(lroundf(max_duty * (value / 255.0f)));
+    // using max + 1 below because when its inverted max will still be very dim, max + 1 will be 100% turned off.
+    _duty[value] = _reversed ? (CHANNEL_MAX_DUTY + 1 - duty) : duty;
+  }
 }
@@ -3,12 +3,18 @@
 
 #include <Arduino.h>
 
+#define RGB_LED_GAMMA 2.2f
+
 typedef struct {
   uint8_t r;
   uint8_t g;
   uint8_t b;
 } RGB;
 
+/**
+ * RGB LED on three LEDC channels. Channel values are linear and scaled by the intensity, which is perceptual (gamma
+ * corrected), through a duty cycle table, so writing a channel is a single lookup.
+ */
 class RGBLed {
  public:
   /**
@@ -31,14 +37,23 @@ class RGBLed {
   void set_g(uint8_t value);
   void set_b(uint8_t value);
 
-  virtual void set_intensity(uint8_t intensity);
-  virtual uint8_t get_intensity() const;
+  /**
+   * Set the intensity, the duty cycle at value 255. Rebuilds the duty cycle table.
+   */
+  void set_intensity(uint8_t intensity);
+  uint8_t get_intensity() const;
  private:
 
   void set_channel(uint8_t channel, uint8_t value);
 
+  /**
+   * Build the duty cycle of every channel value for the current intensity
+   */
+  void update_duty_table();
+
   bool _reversed;
   uint8_t config_intensity;
+  uint16_t _duty[256]; // LEDC duty per channel value, with intensity (gamma) and reversal applied
 };
 
 #endif //BGEIGIECAST_ESP_LED_H
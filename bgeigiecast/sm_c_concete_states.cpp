@@ -1,6 +1,7 @@
 #include <Aggregator.hpp>
 
 #include "sm_c_concete_states.h"
+#include "controller.h"
 #include "identifiers.h"
 
 // region InitializeState
@@ -23,7 +24,7 @@ void InitializeState::exit_action() {
 void InitializeState::handle_event(Event_enum event_id) {
   switch(event_id) {
     case e_c_controller_initialized: {
-      controller.set_state(new InitReadingState(controller));
+      controller.set_state(k_state_InitReadingState);
       break;
     }
     default:
@@ -41,6 +42,7 @@ InitReadingState::InitReadingState(Controller& context) : ControllerState(contex
 
 void InitReadingState::entry_action() {
   DEBUG_PRINTLN("-- Entered state Initialize reading");
+  _button_pressed = false;
 }
 
 void InitReadingState::do_activity() {
@@ -55,10 +57,10 @@ void InitReadingState::handle_event(Event_enum event_id) {
     case e_c_reading_initialized: {
       if(_button_pressed) {
         /// Button pressed during init, go to config mode
-        controller.set_state(new ConfigurationModeState(controller));
+        controller.set_state(k_state_ConfigurationModeState);
       } else {
         /// To post init, where the user has 3 seconds to press button to go to config mode
-        controller.set_state(new PostInitializeState(controller));
+        controller.set_state(k_state_PostInitializeState);
       }
       break;
     }
@@ -96,17 +98,17 @@ void PostInitializeState::handle_event(Event_enum event_id) {
   switch(event_id) {
     case e_c_button_pressed:
       /// Button pressed, go to config mode
-      controller.set_state(new ConfigurationModeState(controller));
+      controller.set_state(k_state_ConfigurationModeState);
       break;
     case e_c_post_init_time_passed: {
       /// Additional init time has passed, go to previously saved state (fixed or mobile)
       switch(controller.get_saved_state()) {
         case Controller::k_savable_FixedMode:
-          controller.set_state(new FixedModeState(controller));
+          controller.set_state(k_state_FixedModeState);
           break;
         case Controller::k_savable_MobileMode:
         default:
-          controller.set_state(new MobileModeState(controller));
+          controller.set_state(k_state_MobileModeState);
           break;
       }
       break;
@@ -145,16 +147,16 @@ void ConfigurationModeState::handle_event(Event_enum event_id) {
       /// Button pressed, leave config mode to go to previously saved state (fixed or mobile)
       switch(controller.get_saved_state()) {
         case Controller::k_savable_FixedMode:
-          controller.set_state(new FixedModeState(controller));
+          controller.set_state(k_state_FixedModeState);
           break;
         case Controller::k_savable_MobileMode:
         default:
-          controller.set_state(new MobileModeState(controller));
+          controller.set_state(k_state_MobileModeState);
           break;
       }
       break;
     case e_c_button_long_pressed:
-      controller.set_state(new ResetState(controller));
+      controller.set_state(k_state_ResetState);
       break;
     default:
       ControllerState::handle_event(event_id);
@@ -173,22 +175,24 @@ void MobileModeState::entry_action() {
   DEBUG_PRINTLN("-- Entered state MobileMode");
   controller.save_state(Controller::k_savable_MobileMode);
   controller.set_handler_active(k_handler_bluetooth_reporter, true);
+  controller.set_worker_active(k_worker_bluetooth_transfer, true);
 }
 
 void MobileModeState::do_activity() {
 }
 
 void MobileModeState::exit_action() {
+  controller.set_worker_active(k_worker_bluetooth_transfer, false);
   controller.set_handler_active(k_handler_bluetooth_reporter, false);
 }
 
 void MobileModeState::handle_event(Event_enum event_id) {
   switch(event_id) {
     case e_c_button_pressed:
-      controller.set_state(new FixedModeState(controller));
+      controller.set_state(k_state_FixedModeState);
       break;
     case e_c_button_long_pressed:
-      controller.set_state(new ResetState(controller));
+      controller.set_state(k_state_ResetState);
       break;
     default:
       ControllerState::handle_event(event_id);
@@ -208,6 +212,7 @@ void FixedModeState::entry_action() {
   DEBUG_PRINTLN("-- Entered state FixedMode");
   controller.save_state(Controller::k_savable_FixedMode);
   controller.set_handler_active(k_handler_api_reporter, true);
+  controller.set_handler_active(k_handler_ota_puller, true);
   controller.set_worker_active(k_worker_configuration_server, true);
 }
 
@@ -216,16 +221,17 @@ void FixedModeState::do_activity() {
 
 void FixedModeState::exit_action() {
   controller.set_handler_active(k_handler_api_reporter, false);
+  controller.set_handler_active(k_handler_ota_puller, false);
   controller.set_worker_active(k_worker_configuration_server, false);
 }
 
 void FixedModeState::handle_event(Event_enum event_id) {
   switch(event_id) {
     case e_c_button_pressed:
-      controller.set_state(new MobileModeState(controller));
+      controller.set_state(k_state_MobileModeState);
       break;
     case e_c_button_long_pressed:
-      controller.set_state(new ResetState(controller));
+      controller.set_state(k_state_ResetState);
       break;
     default:
       ControllerState::handle_event(event_id);
@@ -2,11 +2,13 @@
 #define BGEIGIECAST_STATE_HPP
 
 #include "debugger.h"
-#include "controller.h"
 #include "sm_state.h"
 
+class Controller;
+
 /**
- * State with controller context, so the states can control the system
+ * State with controller context, so the states can control the system. The states are owned by the controller and
+ * live as long as the controller, a state is entered again by its id (see `Controller::set_state(StateId)`).
  */
 class ControllerState : public State {
  public:
@@ -18,6 +20,7 @@ class ControllerState : public State {
     k_state_MobileModeState,
     k_state_FixedModeState,
     k_state_ResetState,
+    k_state_count,
   };
 
   explicit ControllerState(Controller& context) : controller(context) {};
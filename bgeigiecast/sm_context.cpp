@@ -1,23 +1,23 @@
 #include "debugger.h"
 #include "sm_context.h"
 
-Context::Context() : _current_state(nullptr), _event_queue() {
+Context::Context() : _current_state(nullptr), _event_queue(), _last_event_latency(0), _max_event_latency(0), _trace() {
 }
 
 Context::~Context() {
   if(_current_state) {
     _current_state->exit_action();
-    delete _current_state;
   }
 }
 
 void Context::set_state(State* state) {
   if(_current_state) {
     _current_state->exit_action();
-    delete _current_state;
+    _trace.state_exited(_current_state->get_state_id());
   }
   _current_state = state;
   if(_current_state) {
+    _trace.state_entered(_current_state->get_state_id());
     _current_state->entry_action();
   }
 }
@@ -32,7 +32,8 @@ void Context::run() {
 }
 
 void Context::schedule_event(Event_enum event_id) {
-  _event_queue.add(event_id);
+  // Dropped when the queue is full, counted by the queue
+  _event_queue.add(event_id, micros());
 }
 
 State* Context::get_current_state() const {
@@ -44,8 +45,30 @@ void Context::clear_events() {
 }
 
 void Context::handle_events() {
-  while(!_event_queue.empty()) {
-    Event_enum event_id = _event_queue.get();
+  Event_enum event_id;
+  uint32_t scheduled_at;
+  while(_event_queue.get(event_id, scheduled_at)) {
+    _last_event_latency = micros() - scheduled_at;
+    if(_last_event_latency > _max_event_latency) {
+      _max_event_latency = _last_event_latency;
+    }
+    _trace.event_handled(event_id, _last_event_latency);
     if(_current_state) { _current_state->handle_event(event_id); }
   }
 }
+
+uint32_t Context::get_last_event_latency() const {
+  return _last_event_latency;
+}
+
+uint32_t Context::get_max_event_latency() const {
+  return _max_event_latency;
+}
+
+uint32_t Context::get_dropped_events() const {
+  return _event_queue.get_overflows();
+}
+
+const StateTrace& Context::get_trace() const {
+  return _trace;
+}
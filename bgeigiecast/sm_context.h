@@ -1,10 +1,11 @@
 #ifndef BGEIGIECAST_CONTEXT_H
 #define BGEIGIECAST_CONTEXT_H
 
-#define MAX_EVENTS 10
+#define MAX_EVENTS 16
 
 #include "sm_state.h"
-#include "circular_buffer.h"
+#include "event_queue.h"
+#include "sm_trace.h"
 
 /**
  * Context, something which will control a set of states and runs a state machine
@@ -15,8 +16,9 @@ class Context {
   virtual ~Context();
 
   /**
-   * Will exit the current one and enter the new one
-   * @param state: New state to be set
+   * Will exit the current one and enter the new one. The context does not take ownership of the state, states
+   * should outlive the context (or be reset with `set_state(nullptr)` before they are destroyed).
+   * @param state: New state to be set, nullptr to only exit the current one
    */
   virtual void set_state(State* state);
 
@@ -26,7 +28,7 @@ class Context {
   void run();
 
   /**
-   * Schedule a new event
+   * Schedule a new event, safe to call from an interrupt
    * @param event_id
    */
   void schedule_event(Event_enum event_id);
@@ -46,10 +48,35 @@ class Context {
    * Handle all events in queue for current state
    */
   void handle_events();
+
+  /**
+   * Get the time between scheduling and handling of the last handled event
+   * @return micros
+   */
+  uint32_t get_last_event_latency() const;
+
+  /**
+   * Get the longest time between scheduling and handling of an event
+   * @return micros
+   */
+  uint32_t get_max_event_latency() const;
+
+  /**
+   * Get the amount of events dropped because the event queue was full
+   */
+  uint32_t get_dropped_events() const;
+
+  /**
+   * Get the trace of state entries, exits and handled events
+   */
+  const StateTrace& get_trace() const;
  private:
 
   State* _current_state;
-  CircularBuffer<Event_enum, MAX_EVENTS> _event_queue;
+  EventQueue<Event_enum, MAX_EVENTS> _event_queue;
+  uint32_t _last_event_latency;
+  uint32_t _max_event_latency;
+  StateTrace _trace;
 };
 
 #endif //BGEIGIECAST_CONTEXT_H
@@ -0,0 +1,119 @@
+#include "sm_trace.h"
+
+StateTrace::StateTrace() : _entries(), _total_recorded(0), _entered_at(0), _dwell_stats() {
+}
+
+void StateTrace::state_entered(int8_t state_id) {
+  uint32_t now = millis();
+  portENTER_CRITICAL(&_lock);
+  _entered_at = now;
+  record(e_trace_state_entry, state_id, now, 0);
+  portEXIT_CRITICAL(&_lock);
+}
+
+void StateTrace::state_exited(int8_t state_id) {
+  uint32_t now = millis();
+  portENTER_CRITICAL(&_lock);
+  uint32_t dwell = now - _entered_at;
+  if(state_id >= 0 && state_id < TRACE_MAX_STATES) {
+    auto& stats = _dwell_stats[state_id];
+    ++stats.visits;
+    stats.total += dwell;
+    if(dwell > stats.max) {
+      stats.max = dwell;
+    }
+  }
+  record(e_trace_state_exit, state_id, now, dwell);
+  portEXIT_CRITICAL(&_lock);
+}
+
+void StateTrace::event_handled(int8_t event_id, uint32_t latency) {
+  uint32_t now = millis();
+  portENTER_CRITICAL(&_lock);
+  record(e_trace_event, event_id, now, latency);
+  portEXIT_CRITICAL(&_lock);
+}
+
+void StateTrace::record(EntryType type, int8_t id, uint32_t time, uint32_t value) {
+  auto& entry = _entries[_total_recorded % TRACE_SIZE];
+  entry.time = time;
+  entry.value = value;
+  entry.type = type;
+  entry.id = id;
+  ++_total_recorded;
+}
+
+size_t StateTrace::serialize(uint8_t* buffer, size_t size) const {
+  if(size < sizeof(Header)) {
+    return 0;
+  }
+  uint16_t max_entries = (size - sizeof(Header)) / sizeof(Entry);
+
+  // Only the indices under the lock, the entries are copied outside of it so recording is never blocked for long
+  portENTER_CRITICAL(&_lock);
+  uint32_t total_recorded = _total_recorded;
+  portEXIT_CRITICAL(&_lock);
+  uint16_t count = total_recorded < TRACE_SIZE ? total_recorded : TRACE_SIZE;
+  if(count > max_entries) {
+    count = max_entries;
+  }
+
+  // Newest entries that fit, oldest first
+  uint8_t* entries = buffer + sizeof(Header);
+  uint32_t first = total_recorded - count;
+  for(uint32_t i = first; i != total_recorded; ++i) {
+    memcpy(entries + (i - first) * sizeof(Entry), &_entries[i % TRACE_SIZE], sizeof(Entry));
+  }
+
+  // Entries recorded during the copy overwrote the oldest ones, those are left out
+  portENTER_CRITICAL(&_lock);
+  uint32_t recorded_since = _total_recorded - total_recorded;
+  portEXIT_CRITICAL(&_lock);
+  uint32_t overwritten = recorded_since + count > TRACE_SIZE ? recorded_since + count - TRACE_SIZE : 0;
+  if(overwritten > count) {
+    overwritten = count;
+  }
+  if(overwritten) {
+    count -= overwritten;
+    memmove(entries, entries + overwritten * sizeof(Entry), count * sizeof(Entry));
+  }
+
+  Header header{};
+  memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+  header.version = TRACE_VERSION;
+  header.entry_size = sizeof(Entry);
+  header.count = count;
+  header.total_recorded = total_recorded;
+  header.time = millis();
+  memcpy(buffer, &header, sizeof(Header));
+  uint8_t* out = entries + count * sizeof(Entry);
+
+  return out - buffer;
+}
+
+StateTrace::DwellStats StateTrace::get_dwell_stats(int8_t state_id) const {
+  if(state_id < 0 || state_id >= TRACE_MAX_STATES) {
+    return DwellStats{};
+  }
+  portENTER_CRITICAL(&_lock);
+  auto stats = _dwell_stats[state_id];
+  portEXIT_CRITICAL(&_lock);
+  return stats;
+}
+
+void StateTrace::print_dwell_stats(Print& out) const {
+  out.println("Dwell times (state: visits, total ms, max ms)");
+  for(int8_t i = 0; i < TRACE_MAX_STATES; ++i) {
+    auto stats = get_dwell_stats(i);
+    if(stats.visits > 0) {
+      out.printf("- %d: %u, %u, %u\n", i, stats.visits, stats.total, stats.max);
+    }
+  }
+}
+
+void StateTrace::clear() {
+  portENTER_CRITICAL(&_lock);
+  _total_recorded = 0;
+  memset(_dwell_stats, 0, sizeof(_dwell_stats));
+  portEXIT_CRITICAL(&_lock);
+}
@@ -0,0 +1,121 @@
+#ifndef BGEIGIECAST_SM_TRACE_H
+#define BGEIGIECAST_SM_TRACE_H
+
+#include <Arduino.h>
+
+#ifndef TRACE_SIZE
+#define TRACE_SIZE 128
+#endif
+
+#ifndef TRACE_MAX_STATES
+#define TRACE_MAX_STATES 16
+#endif
+
+#define TRACE_MAGIC "SMTR"
+#define TRACE_VERSION 1
+
+/**
+ * Fixed size binary trace of a state machine: state entries, exits and handled events with a timestamp. When full, the
+ * oldest entries are overwritten. Keeps dwell statistics (time spent) per state. Recording is done by the state machine
+ * loop, the trace can be serialized from any task.
+ */
+class StateTrace {
+ public:
+  typedef enum EntryType {
+    e_trace_state_entry = 0,
+    e_trace_state_exit,
+    e_trace_event,
+  } EntryType;
+
+  /**
+   * Single trace entry, value depends on the type:
+   * - state entry: unused
+   * - state exit: millis spent in the state
+   * - event: micros between scheduling and handling the event
+   */
+  struct __attribute__((packed)) Entry {
+    uint32_t time;
+    uint32_t value;
+    uint8_t type;
+    int8_t id;
+  };
+
+  /**
+   * Header of the serialized trace, followed by `count` entries (oldest first). All values little endian.
+   */
+  struct __attribute__((packed)) Header {
+    char magic[4];
+    uint8_t version;
+    uint8_t entry_size;
+    uint16_t count;
+    uint32_t total_recorded;
+    uint32_t time;
+  };
+
+  struct DwellStats {
+    uint32_t visits;
+    uint32_t total;
+    uint32_t max;
+  };
+
+  static const size_t k_serialized_size = sizeof(Header) + TRACE_SIZE * sizeof(Entry);
+
+  StateTrace();
+  virtual ~StateTrace() = default;
+
+  /**
+   * Record a state entry
+   * @param state_id
+   */
+  void state_entered(int8_t state_id);
+
+  /**
+   * Record a state exit, updates the dwell statistics of the state
+   * @param state_id
+   */
+  void state_exited(int8_t state_id);
+
+  /**
+   * Record a handled event
+   * @param event_id
+   * @param latency: micros between scheduling and handling
+   */
+  void event_handled(int8_t event_id, uint32_t latency);
+
+  /**
+   * Write the trace (header + entries, oldest first) to a buffer. Entries overwritten while copying are left out.
+   * @param buffer: at least `k_serialized_size` to fit the complete trace
+   * @param size: size of the buffer
+   * @return bytes written
+   */
+  size_t serialize(uint8_t* buffer, size_t size) const;
+
+  /**
+   * Get the dwell statistics of a state, the time in the current state is not included
+   * @param state_id
+   * @return statistics, all 0 for unknown states
+   */
+  DwellStats get_dwell_stats(int8_t state_id) const;
+
+  /**
+   * Print the dwell statistics of all visited states
+   * @param out
+   */
+  void print_dwell_stats(Print& out) const;
+
+  /**
+   * Clear all entries and statistics
+   */
+  void clear();
+
+ private:
+  void record(EntryType type, int8_t id, uint32_t time, uint32_t value);
+
+  Entry _entries[TRACE_SIZE];
+  uint32_t _total_recorded;
+  uint32_t _entered_at;
+  DwellStats _dwell_stats[TRACE_MAX_STATES];
+  mutable portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif //BGEIGIECAST_SM_TRACE_H
@@ -10,6 +10,15 @@
 #define BGEIGIE_CONNECTION_BAUD 9600
 #define POST_INITIALIZE_DURATION 4000
 
+/** Execution settings **/
+#define NETWORK_TASK_CORE 0 // Same core as the WiFi / BT stack, the main loop runs on the other core
+#define NETWORK_TASK_STACK_SIZE 16384
+#define NETWORK_TASK_PRIORITY 1
+#define HANDLER_CYCLE_BUDGET_MILLIS 20 // Low priority handlers are deferred to the next cycle after this
+
+/** Storage settings **/
+#define STORAGE_COMMIT_INTERVAL_SECONDS 600 // Max time the last location / device id is kept in memory only
+
 /** Hardware pins settings **/
 #define RGB_LED_PIN_R A18
 #define RGB_LED_PIN_G A4
@@ -26,13 +35,27 @@
 #define API_SEND_FREQUENCY_SECONDS_ALERT 60 // 1 minute
 #define API_SEND_FREQUENCY_SECONDS_DEV 30 // 30 seconds
 #define API_SEND_FREQUENCY_SECONDS_ALERT_DEV 10 // 10 seconds
+#define API_HANDLE_DEADLINE_MILLIS 100 // Soft deadline for a reading to be handled by the api reporter
 #define MAX_MISSED_READINGS 10 // Keep up to 20 readings in memory if connection to the api failed
 
+/** WiFi connection settings **/
+#define WIFI_CONNECT_TIMEOUT_MILLIS 15000 // A connect without result is started again after this
+
 /** Access point settings **/
 #define ACCESS_POINT_SSID       "bgeigie%d" // With device id
 #define SERVER_WIFI_PORT        80
+#define ASSET_MAX_AGE_SECONDS   "604800" // Cache time of static resources (string, used in header)
+#define OTA_DIGEST_HEADER       "X-Firmware-SHA256" // Optional header of firmware uploads, verified before activating
 #define ACCESS_POINT_IP         {192, 168, 5, 1}
 #define ACCESS_POINT_NMASK      {255, 255, 255, 0}
+#define EVENT_STREAM_MAX_CLIENTS 4 // Clients of `/events`, each uses ~1 KB send buffer
+#define EVENT_STREAM_READING_QUEUE_SIZE 4 // Readings waiting to be sent to the `/events` clients
+
+/** Reading log settings **/
+#define READING_LOG_FILE_SIZE (64 * 1024) // Log is kept in two files of this size, the older file is removed when full
+
+/** Update server settings **/
+#define OTA_CHECK_INTERVAL_MINUTES 60 // How often the configured update url is checked for a new firmware
 
 /** Default ESP configurations **/
 #define D_DEVICE_ID             0
@@ -43,5 +66,6 @@
 #define D_USE_DEV_SERVER        true
 #define D_LED_COLOR_BLIND       false
 #define D_LED_COLOR_INTENSITY   30
+#define D_UPDATE_URL            "" // Firmware update manifest, e.g. "http://192.168.1.10:8000/manifest.txt"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,413 @@
+// Generated by tools/embed_assets.py from web/, do not edit
+#include "web_assets.h"
+
+static const uint8_t asset_pure_css[3906] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x1b, 0x6b, 0x8f, 0xe3, 0xb6,
+    0xf1, 0xfb, 0xfd, 0x0a, 0xe5, 0x0e, 0x01, 0x6e, 0x0f, 0x92, 0x57, 0x96, 0x9f, 0x2b, 0x21, 0x87,
+    0x26, 0xcd, 0xa5, 0x4d, 0x91, 0x06, 0x05, 0xd2, 0x2f, 0xc5, 0x65, 0x0b, 0xd0, 0x12, 0x6d, 0xab,
+    0xab, 0x17, 0x24, 0x79, 0x1f, 0xe7, 0xfa, 0xbf, 0x77, 0xf8, 0x90, 0x34, 0x7c, 0xc8, 0xf6, 0xa6,
+    0x45, 0xd1, 0x0f, 0x8d, 0x73, 0x77, 0x12, 0x39, 0x1c, 0x0e, 0xe7, 0xc5, 0x99, 0x21, 0x75, 0xfb,
+    0xe1, 0xab, 0x37, 0x7f, 0x39, 0xd4, 0xd4, 0x79, 0x9c, 0x4e, 0xfc, 0x89, 0xff, 0xe6, 0xf7, 0x65,
+    0xf5, 0x52, 0xa7, 0xbb, 0x7d, 0xeb, 0x04, 0xfe, 0x74, 0xe6, 0xfc, 0x8d, 0xec, 0xcb, 0xf2, 0xab,
+    0x37, 0x3f, 0xa5, 0x31, 0x2d, 0x1a, 0x9a, 0x38, 0x87, 0x22, 0xa1, 0xb5, 0xd3, 0xee, 0xa9, 0xf3,
+    0xdd, 0x2f, 0xdf, 0x3b, 0xb2, 0x79, 0xf2, 0x66, 0xdf, 0xb6, 0x55, 0x13, 0xde, 0xde, 0xee, 0xd2,
+    0x76, 0x7f, 0xd8, 0x4c, 0xe2, 0x32, 0xbf, 0x7d, 0x61, 0x23, 0x6f, 0x2b, 0x40, 0x7d, 0xbb, 0xc9,
+    0xca, 0xcd, 0x6d, 0x4e, 0x9a, 0x96, 0xd6, 0xb7, 0x3f, 0xfd, 0xf8, 0xfb, 0x4f, 0x3f, 0xff, 0xf2,
+    0x69, 0x92, 0x27, 0x6f, 0x3e, 0xdc, 0xbe, 0xb9, 0x85, 0xd9, 0x8b, 0xb2, 0xce, 0x49, 0x96, 0x7e,
+    0xa1, 0x93, 0xb8, 0x69, 0x9c, 0xc7, 0xbf, 0xcf, 0x26, 0xbe, 0xf3, 0x4f, 0xe7, 0xcf, 0x3f, 0xfe,
+    0xb5, 0x43, 0x0f, 0x6f, 0x80, 0x77, 0x92, 0x96, 0xb7, 0x3d, 0x28, 0x22, 0xf3, 0x7d, 0x7c, 0xe3,
+    0xfc, 0x9c, 0xc6, 0x65, 0x46, 0x1a, 0xe7, 0x0f, 0x24, 0xcb, 0xc8, 0x6e, 0x0f, 0x14, 0x92, 0x22,
+    0x71, 0xfe, 0x54, 0x16, 0xa4, 0xdd, 0x93, 0xc2, 0xf9, 0x99, 0x92, 0x4c, 0xce, 0xe6, 0x68, 0xb3,
+    0xc1, 0x64, 0x93, 0x99, 0x6d, 0xba, 0x6e, 0x19, 0x05, 0xe5, 0xa8, 0x6f, 0xd5, 0x71, 0x1f, 0x6e,
+    0x27, 0x6c, 0x65, 0xde, 0xe6, 0xd0, 0xb6, 0x65, 0x11, 0x6e, 0xcb, 0xf8, 0xd0, 0xb8, 0x24, 0x24,
+    0x71, 0x9b, 0x3e, 0x52, 0x78, 0xd8, 0x97, 0x8f, 0xb4, 0x3e, 0x96, 0x87, 0x36, 0x4b, 0x0b, 0x1a,
+    0xfa, 0x27, 0x01, 0xdd, 0x92, 0x4d, 0x46, 0x5d, 0xfe, 0xf7, 0x71, 0x53, 0xd6, 0xc0, 0x49, 0x0f,
+    0x90, 0x67, 0xa4, 0x6a, 0x68, 0xd8, 0x3d, 0x44, 0xb2, 0xa3, 0xa9, 0x48, 0x9c, 0x16, 0x3b, 0x18,
+    0xbb, 0x6f, 0xf3, 0xec, 0xb8, 0x2d, 0x8b, 0xd6, 0xdb, 0x92, 0x3c, 0xcd, 0x5e, 0xc2, 0x86, 0x14,
+    0x8d, 0xd7, 0xd0, 0x3a, 0xdd, 0x46, 0x5e, 0xde, 0x78, 0x2d, 0x7d, 0x6e, 0xbd, 0x06, 0x28, 0xf3,
+    0x48, 0xf2, 0x8f, 0x43, 0xd3, 0x86, 0x53, 0xdf, 0xff, 0x3a, 0xf2, 0x9e, 0xe8, 0xe6, 0x21, 0x6d,
+    0xed, 0xbd, 0xa7, 0x4d, 0x99, 0xbc, 0x1c, 0x73, 0x52, 0xef, 0xd2, 0x02, 0x66, 0x20, 0x75, 0x9b,
+    0xc6, 0x40, 0x19, 0x69, 0xd2, 0x84, 0xba, 0x09, 0x6d, 0x49, 0x9a, 0x35, 0xee, 0x36, 0xdd, 0xc5,
+    0xa4, 0x6a, 0xd3, 0xb2, 0x60, 0x8f, 0x40, 0xbf, 0xbb, 0x2d, 0x4b, 0x10, 0xa1, 0xbb, 0xa7, 0x24,
+    0x61, 0xff, 0xec, 0xea, 0xf2, 0x50, 0xb9, 0x39, 0x49, 0x0b, 0x37, 0xa7, 0xc5, 0xc1, 0x2d, 0xc8,
+    0xa3, 0xdb, 0xd0, 0x98, 0x8f, 0x68, 0x0e, 0x39, 0xa0, 0x7f, 0x39, 0x26, 0x69, 0x53, 0x65, 0xe4,
+    0x25, 0x04, 0x15, 0x88, 0x1f, 0x4e, 0xe4, 0x90, 0xa4, 0xa5, 0x1b, 0x93, 0xe2, 0x91, 0x34, 0x6e,
+    0x55, 0x97, 0xbb, 0x9a, 0x36, 0x8d, 0xfb, 0x08, 0xb3, 0x96, 0x3d, 0x64, 0x5a, 0x30, 0x9e, 0x79,
+    0x7c, 0x40, 0x04, 0x5c, 0x04, 0xd2, 0x48, 0xe6, 0x01, 0xeb, 0x77, 0x45, 0xb8, 0x21, 0x0d, 0x65,
+    0xbd, 0x02, 0x51, 0x58, 0x94, 0xed, 0xfb, 0xcf, 0x31, 0x70, 0xa6, 0x2e, 0xb3, 0xe6, 0xfe, 0xa6,
+    0x47, 0x51, 0x94, 0x05, 0x8d, 0xf6, 0x94, 0xa9, 0x07, 0xac, 0xee, 0xf3, 0x3e, 0x4d, 0x12, 0x5a,
+    0xdc, 0xbb, 0x2d, 0xcd, 0xa1, 0xbb, 0xa5, 0x0a, 0xdc, 0x89, 0x1c, 0x37, 0x24, 0x7e, 0x60, 0x6b,
+    0x29, 0x12, 0x26, 0x8e, 0xb2, 0x0e, 0xdb, 0x1a, 0x38, 0x5c, 0x91, 0x9a, 0x16, 0xed, 0x89, 0x6c,
+    0x36, 0xf5, 0xe7, 0x36, 0x6d, 0x33, 0x7a, 0xdf, 0xc9, 0x6c, 0x53, 0x82, 0xd0, 0xf3, 0x70, 0x5a,
+    0x3d, 0x3b, 0x09, 0x3c, 0xd2, 0xe4, 0xb4, 0x71, 0xcb, 0xaa, 0x15, 0xec, 0x68, 0x80, 0x98, 0x62,
+    0x27, 0xe4, 0xf5, 0x24, 0x48, 0x58, 0xf9, 0xfe, 0x29, 0xd9, 0x16, 0xa2, 0xad, 0x69, 0x5f, 0x32,
+    0x1a, 0xa6, 0x2d, 0x2c, 0x28, 0x3e, 0xed, 0xa7, 0xb2, 0x11, 0xe4, 0x13, 0x06, 0x34, 0x8f, 0xa4,
+    0x48, 0x26, 0xcb, 0x15, 0xcd, 0x1d, 0xff, 0x04, 0xaf, 0x0f, 0x88, 0xbc, 0xf0, 0xdd, 0x76, 0xeb,
+    0x47, 0x82, 0xc6, 0x77, 0x3e, 0x60, 0x6d, 0x40, 0x25, 0x33, 0x84, 0x62, 0x0d, 0xa2, 0x6d, 0x0e,
+    0x1b, 0xe0, 0x7e, 0x85, 0x5a, 0x57, 0x8b, 0xaf, 0x23, 0xce, 0xd3, 0x8e, 0x25, 0x51, 0x55, 0x36,
+    0x29, 0x13, 0x53, 0x58, 0x53, 0x60, 0x08, 0xa8, 0xec, 0x28, 0xa3, 0x19, 0xa6, 0xb6, 0xac, 0x42,
+    0x6f, 0xb2, 0xa0, 0x39, 0xc3, 0x7d, 0x94, 0xab, 0xf7, 0x26, 0x01, 0x6b, 0x49, 0xf3, 0x9d, 0x64,
+    0x0b, 0x70, 0xba, 0x79, 0xdc, 0x71, 0x99, 0x84, 0x35, 0x28, 0xca, 0xcd, 0x91, 0xd9, 0xc0, 0x36,
+    0x2b, 0x9f, 0x42, 0x21, 0x80, 0x93, 0xd0, 0xa2, 0x4e, 0xed, 0xa6, 0xb0, 0xc2, 0xb9, 0x5f, 0x3d,
+    0x9f, 0xf6, 0x35, 0x60, 0x78, 0x66, 0xa4, 0x32, 0x7d, 0x67, 0xe2, 0x04, 0xbe, 0x03, 0x93, 0x9f,
+    0x07, 0x11, 0x56, 0xa0, 0x7c, 0x4c, 0x91, 0x41, 0x24, 0x64, 0x40, 0x4b, 0x0e, 0x6d, 0x79, 0x8a,
+    0x4b, 0x50, 0xd9, 0x87, 0x4d, 0xe2, 0x32, 0x98, 0x86, 0xe4, 0x95, 0x62, 0x2a, 0x79, 0x59, 0x94,
+    0xcc, 0x92, 0xa8, 0xdb, 0x3f, 0x45, 0x03, 0x63, 0x80, 0x84, 0x93, 0xb0, 0x60, 0x37, 0x2d, 0xaa,
+    0x43, 0x8b, 0xa4, 0x48, 0x33, 0x50, 0xe4, 0x61, 0x4e, 0xc1, 0xf3, 0xb4, 0x00, 0xd7, 0x92, 0xb6,
+    0x1c, 0x43, 0xff, 0xd2, 0x5b, 0x11, 0xf6, 0x08, 0x02, 0xdf, 0x11, 0x73, 0x5d, 0x38, 0x10, 0x39,
+    0xdf, 0xb0, 0x88, 0xc7, 0xb4, 0x49, 0xc1, 0x1f, 0x74, 0x74, 0x88, 0x89, 0x8f, 0xdc, 0x6a, 0xb9,
+    0x1a, 0x6e, 0x61, 0x98, 0x50, 0x54, 0x09, 0xc1, 0xdc, 0x81, 0xc3, 0xd1, 0x7f, 0x6e, 0x5f, 0x2a,
+    0xfa, 0x8d, 0x68, 0xbe, 0x77, 0x51, 0x13, 0x58, 0x15, 0x6d, 0x95, 0x16, 0x10, 0x5c, 0x9e, 0xb6,
+    0xf7, 0xc7, 0xce, 0x2b, 0x90, 0xaa, 0xa2, 0x04, 0xd0, 0xc7, 0x34, 0x14, 0xe3, 0xa3, 0xf8, 0x50,
+    0x37, 0xb0, 0xc4, 0xaa, 0x4c, 0x81, 0xff, 0xb5, 0x9c, 0xec, 0x33, 0x58, 0x0a, 0xf3, 0x56, 0xc9,
+    0x3d, 0x9e, 0xb6, 0x6f, 0x3c, 0xca, 0x41, 0x09, 0xdd, 0x92, 0x43, 0xd6, 0xca, 0x41, 0x61, 0xe8,
+    0xe5, 0xe5, 0x17, 0x8f, 0xfb, 0x44, 0x2f, 0x2d, 0x0a, 0x70, 0x15, 0x7c, 0x9c, 0xd9, 0xde, 0x6b,
+    0x4e, 0x54, 0x91, 0x24, 0x11, 0xde, 0x0e, 0x11, 0x1d, 0xef, 0x69, 0xfc, 0x00, 0x7a, 0xa0, 0xae,
+    0x8d, 0x80, 0xe5, 0xdf, 0x63, 0x8d, 0xe9, 0xad, 0xf2, 0xd9, 0x8e, 0xa6, 0x38, 0xe4, 0x1b, 0x5a,
+    0xdf, 0xc3, 0xf4, 0x72, 0xf1, 0x7c, 0x6e, 0x70, 0xb0, 0x69, 0xa1, 0x48, 0x6b, 0x04, 0x1a, 0x9c,
+    0xb8, 0x0a, 0x7d, 0x94, 0x02, 0xe5, 0xea, 0x87, 0x79, 0x0c, 0x1c, 0x8d, 0xf7, 0x56, 0x1e, 0x33,
+    0x71, 0x6e, 0x53, 0x9a, 0x25, 0x91, 0x5d, 0xd3, 0x55, 0xdd, 0x11, 0x2f, 0x4c, 0xf0, 0x82, 0xe1,
+    0xc2, 0xcf, 0xb1, 0x39, 0xee, 0x6f, 0x64, 0x27, 0xf3, 0xb7, 0x76, 0x1e, 0x58, 0x28, 0x1a, 0xd6,
+    0x22, 0x1a, 0xbc, 0x98, 0x11, 0x95, 0x59, 0x16, 0x3f, 0x36, 0x20, 0x81, 0x4d, 0xb0, 0x26, 0xcc,
+    0x63, 0xd8, 0x56, 0xc7, 0xb5, 0x93, 0x2f, 0x0f, 0xd4, 0xae, 0x93, 0x29, 0xf3, 0x8e, 0x4d, 0x99,
+    0xa5, 0x89, 0xd3, 0xa4, 0x19, 0x28, 0x7b, 0x6f, 0x27, 0x4e, 0x50, 0x0d, 0x82, 0x9a, 0xcc, 0xc0,
+    0x89, 0x38, 0x93, 0x65, 0xc0, 0xff, 0x59, 0x31, 0x8f, 0x92, 0xd1, 0x1d, 0x2d, 0x12, 0xb7, 0x85,
+    0xff, 0xf7, 0xc7, 0x41, 0xa0, 0xa2, 0x79, 0xf0, 0x35, 0x13, 0xe1, 0x54, 0xdc, 0xce, 0xbb, 0x2b,
+    0x4e, 0xfd, 0xab, 0x34, 0xaf, 0xca, 0xba, 0x25, 0xe0, 0xbf, 0x05, 0xbf, 0x98, 0x9b, 0xca, 0xc9,
+    0xb3, 0xf7, 0x94, 0x26, 0xed, 0x5e, 0x6c, 0x90, 0x48, 0x8a, 0x91, 0xba, 0x4b, 0x89, 0x21, 0xbb,
+    0x63, 0x46, 0xdb, 0x16, 0xed, 0xc4, 0xde, 0x64, 0x06, 0x0e, 0x23, 0xe2, 0xa6, 0x09, 0x5b, 0x03,
+    0x90, 0xc1, 0x5a, 0xc1, 0x65, 0xa4, 0x39, 0x38, 0x93, 0xa6, 0xa2, 0x34, 0x89, 0xb0, 0xef, 0xf9,
+    0xa1, 0xa6, 0xf4, 0x17, 0xb0, 0x60, 0xf7, 0xdb, 0x3a, 0xcd, 0x4b, 0xf7, 0xed, 0xf7, 0x75, 0x09,
+    0xdc, 0x60, 0x2d, 0x6f, 0xdd, 0x3f, 0x52, 0xe0, 0x09, 0x73, 0xb8, 0xac, 0x93, 0x64, 0x2e, 0xda,
+    0xd2, 0x3b, 0x5a, 0x3a, 0x46, 0x33, 0xbd, 0xd6, 0xdb, 0xb6, 0x19, 0x45, 0x8d, 0x10, 0x03, 0xb0,
+    0x06, 0x0c, 0xc8, 0x01, 0x30, 0xb4, 0xc7, 0x9d, 0x4d, 0x5d, 0x3e, 0x39, 0x4f, 0x35, 0xa9, 0xa2,
+    0x6e, 0x8c, 0xd6, 0x6c, 0x83, 0xec, 0xe4, 0xcd, 0xf6, 0x05, 0x4f, 0xea, 0x2c, 0xc7, 0x0f, 0x5b,
+    0x19, 0x04, 0x0e, 0x03, 0x2a, 0xee, 0xec, 0x80, 0x57, 0x0f, 0xa1, 0xe8, 0x18, 0x1b, 0x71, 0xfa,
+    0x5d, 0x4e, 0x93, 0x94, 0x38, 0xb0, 0x75, 0xf1, 0x30, 0xed, 0x3d, 0xc3, 0xb0, 0x07, 0x61, 0x70,
+    0xd8, 0x1a, 0xc2, 0x44, 0x2e, 0xc3, 0x1b, 0xd7, 0xd2, 0x21, 0x02, 0xac, 0x9b, 0x23, 0x8f, 0xa1,
+    0x9c, 0x4e, 0x50, 0xaa, 0xf8, 0x4e, 0x93, 0xb2, 0xa2, 0x35, 0xf1, 0xca, 0x22, 0x7b, 0x71, 0x42,
+    0xaf, 0xf4, 0x60, 0x67, 0x10, 0x01, 0x5a, 0x07, 0xff, 0x04, 0x4a, 0x84, 0xc4, 0x3a, 0x9f, 0x81,
+    0xda, 0x89, 0xbe, 0x83, 0x84, 0x39, 0x78, 0xd3, 0xe1, 0x49, 0x7d, 0x0e, 0xd0, 0x8b, 0xf2, 0x3c,
+    0x47, 0x2f, 0x33, 0xf4, 0x8c, 0xdb, 0x17, 0xe8, 0x79, 0x89, 0x9e, 0xd7, 0xc3, 0xb3, 0xaf, 0x60,
+    0x52, 0x27, 0x54, 0x67, 0x09, 0x94, 0xb7, 0x99, 0xf2, 0x36, 0x57, 0xde, 0x16, 0xca, 0xdb, 0x52,
+    0x79, 0x5b, 0x29, 0x6f, 0x6b, 0xe5, 0xed, 0x0e, 0xbf, 0x05, 0xea, 0xcb, 0x0c, 0x3d, 0x0f, 0xcb,
+    0x0a, 0x14, 0xf2, 0x03, 0x85, 0xe0, 0x40, 0xc5, 0xa0, 0x10, 0x1c, 0x28, 0x04, 0xcf, 0xd4, 0x17,
+    0xfc, 0xbc, 0x40, 0xcf, 0x03, 0xd7, 0x94, 0xd1, 0x73, 0x04, 0xb4, 0xc0, 0xfc, 0x53, 0xd8, 0xb0,
+    0x50, 0xa0, 0x96, 0xe8, 0x79, 0x40, 0xab, 0x70, 0x6a, 0x85, 0x51, 0xad, 0xd4, 0x9e, 0x61, 0x88,
+    0xc2, 0x40, 0xc6, 0x3f, 0xdd, 0x8d, 0x88, 0x38, 0x20, 0x52, 0x74, 0x50, 0xb6, 0x69, 0x41, 0x18,
+    0xc4, 0x5d, 0xba, 0xb7, 0x51, 0xbc, 0x95, 0x12, 0x29, 0x7f, 0x29, 0x59, 0x48, 0xda, 0xf9, 0x2e,
+    0xe7, 0x73, 0x0c, 0x49, 0x4b, 0xf3, 0xe1, 0x1b, 0x41, 0xc8, 0xfd, 0x48, 0xfe, 0x70, 0xc2, 0xea,
+    0x7b, 0x14, 0xce, 0x71, 0x3e, 0x99, 0x2e, 0x97, 0xab, 0xaf, 0x4f, 0x56, 0x95, 0x0f, 0x06, 0xb8,
+    0xf5, 0x64, 0x06, 0xff, 0x61, 0xb8, 0xb5, 0x22, 0x3f, 0x09, 0x36, 0x0d, 0x26, 0x0b, 0x0c, 0xb4,
+    0x54, 0x64, 0xd6, 0x01, 0x2d, 0x27, 0x4b, 0x6d, 0xd2, 0x85, 0xec, 0x0a, 0xfc, 0xa1, 0x75, 0x31,
+    0x8c, 0x08, 0xfc, 0xc9, 0x5a, 0x9b, 0x7e, 0xae, 0x88, 0xad, 0x83, 0x43, 0x93, 0xaf, 0x50, 0xf3,
+    0x9d, 0xb1, 0xca, 0x99, 0x22, 0x42, 0x09, 0x37, 0x9b, 0x69, 0xab, 0xc4, 0x4a, 0x77, 0x87, 0xe0,
+    0x56, 0x78, 0x95, 0x41, 0x4f, 0xfd, 0x1c, 0x51, 0xaf, 0x5a, 0x36, 0x53, 0xcc, 0x0e, 0x68, 0xaa,
+    0xaf, 0x1e, 0x8b, 0x63, 0x61, 0x2c, 0x34, 0x50, 0x5d, 0x80, 0x04, 0x5c, 0xe0, 0xa9, 0x90, 0x00,
+    0x16, 0x86, 0x40, 0xe7, 0xba, 0x56, 0x77, 0x90, 0x6b, 0x63, 0xb1, 0xdd, 0x3a, 0x96, 0x18, 0xb9,
+    0x66, 0x46, 0xeb, 0x0e, 0x46, 0x95, 0xf4, 0x52, 0x73, 0x17, 0x1d, 0x94, 0x21, 0x6a, 0x24, 0x96,
+    0x95, 0x21, 0xd5, 0xb5, 0xe6, 0x09, 0x3a, 0x40, 0x3c, 0x13, 0x92, 0xc3, 0x4a, 0x97, 0xeb, 0xbc,
+    0x5f, 0xc2, 0x1a, 0x2d, 0x21, 0xd0, 0x44, 0xb1, 0xec, 0x60, 0x74, 0x71, 0xab, 0x0e, 0x6c, 0xd5,
+    0xaf, 0x75, 0xad, 0xc8, 0x5b, 0xf5, 0xd2, 0x01, 0x12, 0xca, 0x9d, 0x2e, 0xda, 0x00, 0x49, 0xe6,
+    0xce, 0x10, 0xad, 0x75, 0xcf, 0x51, 0x5d, 0xe3, 0xa2, 0x5f, 0x10, 0x4f, 0xe4, 0x71, 0xe0, 0x78,
+    0x3c, 0xe3, 0x18, 0xa2, 0xa7, 0x7d, 0xda, 0x52, 0xee, 0x70, 0x58, 0xc0, 0xc6, 0xb7, 0x76, 0xcd,
+    0xdd, 0xe4, 0x10, 0x48, 0x65, 0x54, 0x78, 0x1c, 0xd1, 0x12, 0x53, 0x96, 0x0b, 0x68, 0xa9, 0x41,
+    0x1f, 0x11, 0x1c, 0xc0, 0x85, 0x78, 0x49, 0x4d, 0x76, 0x22, 0xdf, 0x56, 0x9a, 0x45, 0x1a, 0x23,
+    0x3b, 0x58, 0xd4, 0x6f, 0x69, 0x6d, 0xcc, 0x46, 0xbd, 0x41, 0x59, 0x9e, 0x25, 0x7f, 0xe8, 0xc3,
+    0xc3, 0x68, 0x88, 0x0b, 0xd1, 0x08, 0x8f, 0x27, 0x73, 0xbf, 0x21, 0x8e, 0xbb, 0x14, 0x42, 0x28,
+    0xe8, 0xc7, 0xa3, 0x09, 0x29, 0x16, 0xec, 0x7b, 0x71, 0x0a, 0x29, 0x93, 0x50, 0x16, 0x8c, 0xf6,
+    0xf1, 0x30, 0x8b, 0x83, 0x19, 0x75, 0x32, 0xc9, 0x9f, 0xcf, 0xe7, 0xf2, 0xb1, 0xde, 0x6d, 0xc8,
+    0x7b, 0xdf, 0x65, 0xbf, 0xc9, 0xfa, 0x26, 0x32, 0xa2, 0xec, 0x77, 0x77, 0x77, 0x77, 0x5d, 0x2b,
+    0xaa, 0x5f, 0x44, 0x46, 0x71, 0xe3, 0xdd, 0xa7, 0x25, 0xfb, 0x89, 0xf5, 0x0f, 0x81, 0xbd, 0x10,
+    0x80, 0xcc, 0x23, 0x58, 0x92, 0x75, 0x68, 0x42, 0x88, 0xd4, 0x55, 0x7e, 0xf2, 0xb2, 0x96, 0x6b,
+    0x29, 0x7d, 0x29, 0x4d, 0xa2, 0xf8, 0xb5, 0x4d, 0x33, 0xe0, 0x7a, 0x48, 0xb2, 0x6a, 0x4f, 0xde,
+    0x97, 0x8c, 0x3d, 0xed, 0xcb, 0x37, 0x77, 0xfe, 0x0d, 0xa6, 0x28, 0xcd, 0xc9, 0x8e, 0xf6, 0x51,
+    0x2d, 0x53, 0x5a, 0x52, 0x03, 0x57, 0x61, 0x76, 0x20, 0xfd, 0x3d, 0x5a, 0x86, 0x8b, 0x97, 0xef,
+    0x2f, 0x6e, 0x1c, 0x70, 0xac, 0x4a, 0xdb, 0xf4, 0xc6, 0x82, 0xf8, 0xdf, 0x44, 0xa8, 0xae, 0x5d,
+    0xd6, 0xf6, 0x94, 0x95, 0x8a, 0x36, 0x91, 0x88, 0xed, 0x49, 0x02, 0x71, 0xb3, 0xef, 0xb0, 0x1f,
+    0x13, 0x8b, 0x82, 0x0c, 0x26, 0x48, 0x0b, 0xc8, 0x8e, 0x5c, 0xd6, 0xbb, 0xd4, 0x7a, 0x03, 0xd9,
+    0x19, 0x0d, 0x35, 0x41, 0x59, 0xe0, 0xf9, 0xf5, 0x4e, 0xa5, 0xa1, 0xcb, 0xbc, 0x5d, 0x6b, 0x6b,
+    0x68, 0x21, 0x71, 0xe8, 0xb4, 0xe8, 0x6f, 0xdf, 0x67, 0xca, 0x15, 0x25, 0xf9, 0x52, 0xa9, 0x84,
+    0x7e, 0xe8, 0x2c, 0xe6, 0xad, 0x56, 0x51, 0xcf, 0x41, 0xd4, 0xf2, 0x39, 0x9c, 0xcc, 0x3b, 0x27,
+    0x02, 0xa9, 0x2c, 0x38, 0x17, 0xc8, 0x30, 0xa8, 0xcc, 0x85, 0x05, 0xdb, 0x38, 0x1a, 0xe9, 0x60,
+    0x3c, 0xfa, 0x08, 0x02, 0x6a, 0x4c, 0x07, 0xe0, 0x89, 0x54, 0x4f, 0x2d, 0xdf, 0x29, 0x00, 0x15,
+    0x64, 0x5a, 0xa4, 0x7e, 0x51, 0x57, 0x29, 0xfc, 0x09, 0x30, 0x8d, 0x58, 0x61, 0x89, 0x15, 0xd8,
+    0x2c, 0x0a, 0x82, 0x3c, 0x56, 0x6b, 0xba, 0xea, 0x2c, 0x73, 0xbb, 0xdd, 0x5a, 0x7c, 0x8d, 0xa3,
+    0x18, 0xfe, 0x7f, 0x3c, 0xf2, 0xeb, 0x72, 0x68, 0xcd, 0x4e, 0x87, 0x77, 0x9e, 0xd2, 0x22, 0xa7,
+    0x30, 0x9d, 0x4e, 0xc7, 0xfa, 0x54, 0x0d, 0xbc, 0xb4, 0x96, 0x70, 0x9b, 0xd6, 0x4d, 0xeb, 0xc5,
+    0xfb, 0x34, 0xeb, 0x92, 0x70, 0x0f, 0xa8, 0xf4, 0x32, 0xba, 0x6d, 0x91, 0xbb, 0x88, 0x94, 0x12,
+    0xa9, 0xde, 0x7b, 0x71, 0x12, 0x88, 0x59, 0x2d, 0x73, 0x70, 0xca, 0xc7, 0x27, 0x19, 0xeb, 0xae,
+    0x65, 0xd9, 0xad, 0x57, 0x92, 0xa1, 0xa2, 0x22, 0xaa, 0x1d, 0x15, 0x44, 0xc8, 0x4c, 0x18, 0xf7,
+    0xae, 0xbd, 0x9f, 0xe6, 0x24, 0xcd, 0xc6, 0x3a, 0x0f, 0xf5, 0x68, 0x57, 0x42, 0x5a, 0x3a, 0xd6,
+    0x97, 0x83, 0xdf, 0xdf, 0x8f, 0x75, 0xc2, 0x0e, 0x44, 0xcf, 0x21, 0xbd, 0xa6, 0xdf, 0x83, 0x4d,
+    0x9f, 0x8c, 0x92, 0xf6, 0x44, 0xe9, 0xc3, 0xe8, 0xec, 0x74, 0x74, 0x18, 0xd7, 0xf9, 0xb1, 0x4e,
+    0x59, 0x31, 0x1b, 0xe9, 0x95, 0x25, 0xa5, 0xd1, 0x39, 0x9f, 0x5b, 0xa5, 0x4f, 0x16, 0x5e, 0x51,
+    0x4b, 0x5f, 0x83, 0x55, 0xf6, 0xc8, 0xc9, 0x12, 0x36, 0x49, 0x6b, 0xbc, 0x63, 0xee, 0x8c, 0x71,
+    0x1c, 0x63, 0x5f, 0xc3, 0x7d, 0xad, 0x74, 0xd2, 0x33, 0xf8, 0xf3, 0x2e, 0x49, 0x12, 0xcd, 0xa0,
+    0xe6, 0xa0, 0x45, 0xf6, 0xe8, 0xc8, 0x5e, 0x73, 0x3b, 0x57, 0xb1, 0xfb, 0x2f, 0xd3, 0x7d, 0x3a,
+    0x27, 0xc1, 0x81, 0x96, 0x80, 0xd1, 0xb2, 0xe8, 0x23, 0x15, 0x3b, 0xe9, 0xca, 0x9e, 0x31, 0x6a,
+    0x3d, 0x67, 0xa1, 0x84, 0x0d, 0x9d, 0x05, 0x61, 0x96, 0x74, 0x16, 0x80, 0xdb, 0xd3, 0x59, 0x08,
+    0x61, 0x55, 0x67, 0x41, 0xb8, 0xed, 0x5c, 0x9c, 0xe6, 0x7a, 0x28, 0x69, 0x67, 0x67, 0x61, 0xb9,
+    0xb5, 0x9d, 0xa7, 0x8a, 0x5e, 0x40, 0x21, 0xe4, 0x76, 0x16, 0xa4, 0xab, 0x58, 0x9f, 0x83, 0xe9,
+    0x0a, 0xbb, 0xe7, 0x69, 0x01, 0x5b, 0x34, 0x21, 0x64, 0x38, 0x6e, 0xb4, 0x77, 0x76, 0x29, 0x7a,
+    0x86, 0xb3, 0x4e, 0x2d, 0x8a, 0x99, 0x06, 0x77, 0x3f, 0x7c, 0xfa, 0x76, 0x44, 0x2b, 0x21, 0x70,
+    0xb8, 0xc0, 0xee, 0xfe, 0x0c, 0xe0, 0x2c, 0x94, 0x38, 0x14, 0xd0, 0x28, 0x91, 0x53, 0x3b, 0x6c,
+    0xe7, 0x64, 0x46, 0x83, 0x69, 0x10, 0x8f, 0x1d, 0x72, 0xd7, 0xe8, 0xe1, 0x08, 0xbb, 0x93, 0x2a,
+    0x6e, 0xb8, 0xbe, 0xb5, 0x48, 0x6c, 0xb7, 0x1b, 0x74, 0x6c, 0x72, 0xc1, 0x76, 0x2e, 0x42, 0x0a,
+    0xfb, 0xb9, 0x08, 0xc6, 0x6c, 0xe8, 0x22, 0x10, 0xb7, 0xa3, 0x8b, 0x50, 0xc2, 0x96, 0x2e, 0x82,
+    0x71, 0x4b, 0xb9, 0x6a, 0xca, 0xd7, 0x41, 0x4a, 0xbb, 0xba, 0x08, 0xcf, 0x6d, 0xeb, 0x32, 0x95,
+    0xf4, 0x0a, 0x54, 0xc2, 0xc6, 0x2e, 0x82, 0x49, 0x3b, 0xbb, 0x08, 0x27, 0x6d, 0xed, 0x0a, 0xda,
+    0xc0, 0xde, 0xec, 0x50, 0xc2, 0xe6, 0xec, 0x7d, 0x9d, 0xdd, 0x99, 0xc7, 0x70, 0x4a, 0x6c, 0x6d,
+    0x84, 0xaf, 0x94, 0xd0, 0x04, 0x3a, 0xe4, 0x5b, 0x4c, 0x92, 0x20, 0x99, 0x99, 0x66, 0x09, 0x88,
+    0x13, 0x96, 0xf5, 0xda, 0xc8, 0xb1, 0xf6, 0xf5, 0xe4, 0xf4, 0xbd, 0x96, 0xd0, 0x99, 0x52, 0xda,
+    0x4d, 0xbc, 0x5a, 0xad, 0x34, 0x0f, 0x01, 0xdb, 0x9c, 0x69, 0x4d, 0xdc, 0x94, 0x61, 0xcb, 0x7b,
+    0x84, 0xdd, 0x37, 0x19, 0x73, 0x47, 0xb6, 0x7e, 0xd5, 0x2d, 0x75, 0x10, 0xf2, 0x00, 0xf7, 0xdd,
+    0xe6, 0x6e, 0x4e, 0xe6, 0x6b, 0x8d, 0x00, 0x7a, 0x37, 0x0b, 0x82, 0xe4, 0xb2, 0x8b, 0xea, 0x90,
+    0xbd, 0xc6, 0x61, 0x5d, 0x35, 0x06, 0xbb, 0x2f, 0x75, 0x40, 0xe7, 0xcc, 0xc6, 0x49, 0x95, 0x07,
+    0xc6, 0xf2, 0x34, 0x2b, 0xe0, 0xa7, 0xf2, 0x63, 0xb1, 0x84, 0x21, 0x97, 0x21, 0x89, 0xc1, 0x72,
+    0xce, 0x0f, 0x59, 0x9b, 0x56, 0xec, 0xc2, 0x03, 0x3e, 0xe9, 0x44, 0x70, 0x19, 0xd9, 0xd0, 0x4c,
+    0xf5, 0x8e, 0x0e, 0x8b, 0x28, 0x30, 0x4c, 0x7f, 0x1e, 0xd8, 0xe7, 0x2c, 0xea, 0x99, 0x9f, 0x2f,
+    0x8e, 0xfb, 0xf4, 0xc2, 0x8d, 0xc0, 0x2f, 0xce, 0xfa, 0x14, 0x87, 0x1b, 0xa1, 0xa3, 0xbb, 0x01,
+    0x13, 0x77, 0xcc, 0x62, 0x86, 0xee, 0x5a, 0x06, 0x6b, 0xec, 0x94, 0x6d, 0x36, 0x9b, 0x45, 0xe6,
+    0xa5, 0x0d, 0xc9, 0x12, 0xba, 0x60, 0x3f, 0x34, 0x2f, 0x3b, 0x9e, 0x8a, 0x1f, 0x68, 0x32, 0x7a,
+    0xea, 0x6a, 0x02, 0x8d, 0x27, 0x12, 0x36, 0x38, 0x23, 0xa1, 0xb0, 0x01, 0x69, 0x89, 0x85, 0x0d,
+    0x44, 0x4f, 0x30, 0x6c, 0x30, 0x46, 0xa2, 0x61, 0x03, 0xd2, 0x13, 0x8a, 0xb1, 0xc9, 0x5e, 0x03,
+    0x67, 0x26, 0x20, 0x36, 0x68, 0x3d, 0x11, 0xb1, 0x52, 0x47, 0x2f, 0xa2, 0x31, 0x12, 0x13, 0x1b,
+    0x10, 0x37, 0xe1, 0x0b, 0x30, 0x66, 0x12, 0x63, 0x83, 0x32, 0x93, 0x19, 0x3b, 0xdd, 0x6a, 0x52,
+    0xd3, 0xc3, 0x70, 0xbb, 0xb1, 0x75, 0x18, 0x59, 0x4f, 0xdf, 0xd3, 0x67, 0x3f, 0xaa, 0x31, 0x74,
+    0xb6, 0xc7, 0xcf, 0xcd, 0xb1, 0xed, 0x88, 0x6c, 0x05, 0x06, 0x8a, 0xa6, 0x3d, 0xcd, 0x2a, 0x4f,
+    0xa4, 0x19, 0xae, 0x05, 0x48, 0xdc, 0x7a, 0xb1, 0x74, 0x98, 0x04, 0x75, 0x3d, 0x1d, 0x41, 0xb8,
+    0x2f, 0xa7, 0x4d, 0x43, 0x76, 0x54, 0x4e, 0x74, 0xd5, 0x4d, 0x2e, 0x91, 0x4e, 0x9d, 0xce, 0x4c,
+    0x70, 0x34, 0x6b, 0x22, 0xe3, 0xeb, 0x94, 0x97, 0xc0, 0x64, 0x45, 0x56, 0x73, 0x08, 0x6a, 0x9a,
+    0x73, 0x6e, 0xa4, 0xf4, 0x6c, 0xa8, 0x04, 0xce, 0x8b, 0x08, 0xd1, 0xf5, 0x2b, 0xea, 0xdd, 0xd4,
+    0x70, 0x99, 0xcb, 0x67, 0x05, 0x5d, 0x56, 0x16, 0xbc, 0x48, 0x44, 0xd3, 0xdf, 0x8d, 0x92, 0x4e,
+    0x15, 0x86, 0x4e, 0x55, 0xb7, 0x2a, 0xaf, 0x33, 0x30, 0xb9, 0x79, 0xdc, 0x95, 0xd3, 0xc4, 0xd8,
+    0x54, 0x2c, 0x30, 0x47, 0xad, 0xb0, 0x0b, 0xd4, 0xe9, 0x25, 0x67, 0x73, 0x16, 0xc1, 0x12, 0xcd,
+    0x91, 0xf7, 0x8e, 0xd4, 0xb7, 0x45, 0xd4, 0x62, 0x88, 0xae, 0x56, 0x4a, 0xe7, 0x88, 0x46, 0x77,
+    0xe4, 0x30, 0xbc, 0x03, 0xe7, 0x7c, 0xc7, 0x9b, 0xa2, 0x8a, 0x4e, 0x57, 0xee, 0x32, 0xef, 0xaf,
+    0xf1, 0x3b, 0x6a, 0xd3, 0x0b, 0x24, 0x99, 0x9b, 0xb0, 0x8d, 0x30, 0xb9, 0xf3, 0x7e, 0x01, 0x0e,
+    0x26, 0xf4, 0x39, 0x9c, 0x5d, 0x40, 0x39, 0xd4, 0xc5, 0x2e, 0x23, 0x46, 0x35, 0x34, 0x46, 0xb0,
+    0xb9, 0x34, 0x48, 0xe0, 0x1d, 0xf6, 0xc7, 0xef, 0xb7, 0x35, 0x75, 0x67, 0x3c, 0x3b, 0x3f, 0x2a,
+    0x9f, 0xbd, 0x86, 0x14, 0x5c, 0x75, 0x1b, 0xa5, 0xea, 0x4a, 0x6a, 0x5e, 0x41, 0x81, 0x36, 0xab,
+    0x17, 0x98, 0x72, 0x06, 0x36, 0x48, 0x86, 0x5c, 0x9c, 0x5e, 0x56, 0x5c, 0x3b, 0xbf, 0x38, 0xd3,
+    0xfd, 0xa2, 0x62, 0x38, 0x53, 0xf3, 0x04, 0xcd, 0x80, 0xb1, 0x9d, 0x35, 0x1a, 0x40, 0xf8, 0x58,
+    0x73, 0x14, 0x68, 0xea, 0x05, 0xc6, 0x11, 0xad, 0x05, 0x68, 0xd6, 0x1f, 0x39, 0x9f, 0x01, 0x32,
+    0x8f, 0xb5, 0x11, 0xd0, 0x88, 0xb3, 0xbf, 0xc6, 0x3b, 0x4b, 0xeb, 0xe3, 0x05, 0x5b, 0x25, 0x82,
+    0x5a, 0x2e, 0x97, 0x23, 0x8e, 0x6e, 0x38, 0xc1, 0x9a, 0xac, 0x57, 0x9a, 0x8b, 0x95, 0x53, 0x6a,
+    0x26, 0x8e, 0x50, 0x1a, 0x83, 0xe5, 0x9d, 0x20, 0x7e, 0xe0, 0xd6, 0xc4, 0x35, 0xa5, 0x85, 0xb8,
+    0x1b, 0xd4, 0x5f, 0xda, 0x72, 0xc2, 0xf9, 0x1a, 0x5c, 0xc3, 0xcd, 0x11, 0x2d, 0x5b, 0x1e, 0x55,
+    0x28, 0x37, 0x1c, 0x3b, 0x0d, 0x58, 0x19, 0x3e, 0xf7, 0x6c, 0x58, 0xf7, 0xff, 0xba, 0xf0, 0xff,
+    0x76, 0x5d, 0x18, 0xa7, 0x1c, 0x4a, 0xa4, 0x6f, 0xbd, 0xba, 0x87, 0x3c, 0x92, 0x29, 0x6e, 0xd4,
+    0x6b, 0x97, 0xb7, 0x01, 0xa0, 0x08, 0xdc, 0xe8, 0x45, 0x12, 0x37, 0xfa, 0xb0, 0xc8, 0x8d, 0x4e,
+    0x45, 0xe6, 0x46, 0x2f, 0x16, 0xaa, 0x15, 0xef, 0x55, 0x00, 0xaa, 0xd8, 0x0d, 0x30, 0x2c, 0x77,
+    0x93, 0x02, 0x3a, 0x3e, 0x50, 0x91, 0xbc, 0xd1, 0xab, 0x8a, 0xde, 0xe8, 0x56, 0x65, 0x6f, 0x99,
+    0xf7, 0xb9, 0x37, 0xe4, 0x4e, 0xd6, 0xfe, 0xeb, 0x22, 0x38, 0x8b, 0xa2, 0xa0, 0xa0, 0x8e, 0x79,
+    0xb9, 0x68, 0x2c, 0xbb, 0xfc, 0x0d, 0x51, 0xda, 0x6b, 0x5d, 0xf1, 0x15, 0xde, 0x59, 0x50, 0x85,
+    0xdc, 0x24, 0x4f, 0x96, 0x95, 0xf2, 0x3d, 0x64, 0xd0, 0x6b, 0xf0, 0x9c, 0xa7, 0xe1, 0x46, 0xb0,
+    0xb7, 0x4d, 0x9f, 0x21, 0xd6, 0xeb, 0xa3, 0x23, 0xfe, 0x1a, 0x71, 0x9f, 0xee, 0xf3, 0x08, 0xc9,
+    0x8f, 0xf4, 0xa8, 0x86, 0x0f, 0x4b, 0x5b, 0x9a, 0xa3, 0x8b, 0xc5, 0x5e, 0x96, 0x36, 0xed, 0xd1,
+    0x88, 0xb1, 0x4e, 0x3a, 0x04, 0xfb, 0x4b, 0x7e, 0xcf, 0xc0, 0xcf, 0x6f, 0x8d, 0x4c, 0xdf, 0xd7,
+    0x27, 0x41, 0x17, 0x36, 0x7a, 0x60, 0x59, 0x63, 0x40, 0xac, 0xe7, 0xe0, 0xec, 0x23, 0x13, 0x80,
+    0x54, 0xc9, 0x2a, 0x1e, 0x34, 0x06, 0x59, 0x2f, 0x31, 0x98, 0x57, 0x5d, 0x14, 0xc4, 0x65, 0x9d,
+    0x7e, 0x01, 0xbe, 0x92, 0x0c, 0x45, 0x01, 0x57, 0x8f, 0x71, 0x74, 0x26, 0xd8, 0xb6, 0xd3, 0xcb,
+    0x43, 0x2d, 0xab, 0xb3, 0x03, 0xea, 0xa2, 0xb1, 0x43, 0x35, 0xb4, 0x22, 0xc0, 0x81, 0xb2, 0x3e,
+    0x7b, 0x05, 0xe8, 0x5c, 0x0a, 0xd6, 0x4f, 0xa6, 0x4f, 0x7e, 0xb4, 0x39, 0x58, 0xde, 0xcb, 0x63,
+    0xb7, 0x5a, 0x3b, 0x8f, 0x1f, 0x42, 0x73, 0xb2, 0x69, 0xca, 0xec, 0xd0, 0x52, 0xa1, 0x7f, 0x9c,
+    0xc9, 0x42, 0x05, 0x4d, 0x35, 0xb1, 0x6b, 0xa5, 0x7d, 0xa9, 0xfd, 0xac, 0x48, 0xad, 0xf9, 0xd9,
+    0xb8, 0x10, 0xa6, 0xbc, 0x5f, 0x83, 0xf1, 0x88, 0x5b, 0x11, 0x1f, 0x2d, 0x38, 0x30, 0x63, 0x79,
+    0xe1, 0x54, 0x5c, 0x70, 0x11, 0xd7, 0x21, 0x3e, 0x9e, 0x5b, 0xaa, 0x8c, 0x9a, 0xf4, 0xb5, 0x2a,
+    0xe4, 0x93, 0xa6, 0x1f, 0xf7, 0x51, 0xd3, 0xe2, 0x90, 0x6c, 0xdb, 0xe1, 0xfa, 0x92, 0x8c, 0xba,
+    0x16, 0x3c, 0xea, 0x12, 0xb7, 0xa5, 0xdf, 0xfe, 0x1a, 0x2c, 0xbe, 0x5b, 0xbf, 0x45, 0x0e, 0x80,
+    0x7f, 0xea, 0x73, 0x85, 0x62, 0x5d, 0x9e, 0x55, 0x99, 0xe3, 0xd3, 0x5b, 0x8c, 0x13, 0x22, 0x2f,
+    0xf6, 0x19, 0x1a, 0xfb, 0x3e, 0xad, 0xfb, 0x40, 0xc5, 0x7b, 0x09, 0x45, 0x6b, 0xd4, 0xb7, 0x3c,
+    0x77, 0x1f, 0xf4, 0x58, 0x47, 0x8e, 0x5a, 0xc8, 0x19, 0xd3, 0x78, 0x1d, 0xa2, 0xcb, 0xa6, 0x66,
+    0x5f, 0x92, 0xe5, 0x0a, 0x1c, 0x5a, 0xa5, 0x58, 0x13, 0x5e, 0x25, 0x57, 0x2b, 0x76, 0x4f, 0xad,
+    0x6f, 0x43, 0xce, 0xae, 0xff, 0x3c, 0xa4, 0xef, 0xe3, 0x13, 0x31, 0x7d, 0x6e, 0xcb, 0x43, 0xbc,
+    0x57, 0xf3, 0x6b, 0xff, 0x15, 0x74, 0xa2, 0xaf, 0x2f, 0x78, 0xdb, 0x86, 0xd4, 0xb6, 0x2b, 0x2f,
+    0x57, 0xd8, 0x88, 0xd5, 0x45, 0xb8, 0x56, 0xbf, 0x61, 0xd6, 0x86, 0x59, 0xc5, 0xb8, 0xf3, 0xcd,
+    0x43, 0x02, 0x26, 0x4a, 0xae, 0xa7, 0x57, 0x78, 0x24, 0xe9, 0x64, 0xab, 0xfe, 0x73, 0xae, 0x29,
+    0xdf, 0x8e, 0xfb, 0x14, 0x7f, 0x32, 0xdc, 0x97, 0xfb, 0xad, 0x4b, 0xb2, 0x56, 0x8a, 0x51, 0xd1,
+    0x1a, 0xbb, 0x5c, 0xfd, 0xd3, 0xaa, 0x43, 0x55, 0xd1, 0x3a, 0x26, 0x4d, 0x7f, 0x40, 0xb1, 0x58,
+    0x2e, 0x92, 0xe5, 0xfc, 0xa4, 0xef, 0x3b, 0xc3, 0xf1, 0x85, 0xd5, 0x07, 0x9e, 0xab, 0xad, 0x73,
+    0x48, 0xed, 0xea, 0xd6, 0xd9, 0x3d, 0x6e, 0xa4, 0x34, 0xa3, 0xe0, 0x39, 0xf6, 0x77, 0xab, 0x16,
+    0xb6, 0x6e, 0x47, 0xb7, 0x7d, 0x71, 0x29, 0xef, 0xec, 0xa7, 0x8e, 0x67, 0x7d, 0x26, 0x43, 0xa2,
+    0x13, 0xaa, 0xd4, 0x53, 0x2e, 0x4e, 0xc5, 0x4e, 0x81, 0x14, 0x97, 0x21, 0xaf, 0x5a, 0x39, 0x67,
+    0x66, 0x19, 0x83, 0xe1, 0x9f, 0xcd, 0xb1, 0x6b, 0x5a, 0xe8, 0x63, 0x48, 0xf4, 0x8d, 0xed, 0x91,
+    0xe6, 0x55, 0xfb, 0xe2, 0xc5, 0x34, 0xcb, 0x9a, 0xb0, 0xd9, 0x97, 0x4f, 0xb6, 0x13, 0x91, 0x0d,
+    0xfb, 0xe1, 0x51, 0x8e, 0xfc, 0xdc, 0x15, 0x21, 0x95, 0x9f, 0xfa, 0xf1, 0xaf, 0x35, 0x9d, 0xf5,
+    0xe2, 0xeb, 0xdb, 0xa9, 0x43, 0xf4, 0x0f, 0x76, 0xfa, 0xca, 0x15, 0x3f, 0x8c, 0x30, 0xae, 0xcf,
+    0x2a, 0x33, 0xb4, 0x9d, 0xfc, 0xe5, 0xeb, 0xbe, 0x2b, 0xcc, 0x89, 0x4d, 0x52, 0xa7, 0xae, 0x2b,
+    0x88, 0x08, 0x8d, 0xee, 0xef, 0x16, 0xa2, 0x6d, 0x41, 0xff, 0x0a, 0x31, 0xd2, 0x3f, 0x2c, 0x1c,
+    0xab, 0xf3, 0x75, 0xf4, 0x58, 0x0a, 0x58, 0x1d, 0x6d, 0xb6, 0x3b, 0x5f, 0xfc, 0x46, 0x97, 0x24,
+    0x47, 0xc5, 0xc4, 0x94, 0xd9, 0x26, 0x74, 0x9f, 0xfd, 0xd0, 0x47, 0xab, 0x46, 0x20, 0xae, 0x7f,
+    0x7a, 0xca, 0x63, 0x76, 0x8d, 0xca, 0x6b, 0x14, 0x97, 0xc3, 0x7a, 0x65, 0x92, 0x68, 0x5c, 0x06,
+    0xaf, 0x5d, 0xa7, 0x15, 0xab, 0x2c, 0xd7, 0x21, 0x24, 0x5c, 0x62, 0x3d, 0xef, 0x83, 0xc2, 0x9b,
+    0xde, 0x58, 0x31, 0xbf, 0xdb, 0x06, 0xec, 0xa7, 0x60, 0x15, 0xab, 0x67, 0x38, 0x92, 0xe3, 0xe8,
+    0x81, 0x92, 0xa9, 0x51, 0x68, 0x1c, 0xfb, 0xe2, 0xfa, 0x23, 0x50, 0x30, 0x94, 0xbd, 0x3e, 0xea,
+    0xb8, 0x6c, 0x7c, 0xc5, 0xee, 0x50, 0x5b, 0x16, 0xee, 0xe9, 0xf5, 0x68, 0xd0, 0x94, 0xa9, 0x7e,
+    0x51, 0xee, 0x02, 0xa9, 0x18, 0xdd, 0x6b, 0x88, 0xfd, 0x17, 0x54, 0xa5, 0x44, 0xa9, 0x41, 0x40,
+    0x00, 0x00
+};
+
+static const uint8_t asset_style_css[208] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x8e, 0xcb, 0x0a, 0xc2, 0x30,
+    0x10, 0x45, 0xf7, 0xfd, 0x8a, 0x40, 0x91, 0x6e, 0x4c, 0xa9, 0x8a, 0x0f, 0x2a, 0x7e, 0x89, 0xb8,
+    0x88, 0xcd, 0x58, 0x07, 0x93, 0x49, 0x48, 0x13, 0xac, 0x94, 0xfe, 0xbb, 0xa9, 0x56, 0x29, 0xb8,
+    0x71, 0x39, 0x97, 0x33, 0xe7, 0x5e, 0xec, 0xee, 0x28, 0xfd, 0xb5, 0x64, 0xcb, 0xb5, 0x6d, 0xf7,
+    0x1e, 0x5a, 0xcf, 0x85, 0xc2, 0x9a, 0x4a, 0x56, 0x01, 0x79, 0x70, 0xfb, 0x3e, 0x49, 0x95, 0x78,
+    0x98, 0xe0, 0x3b, 0x2d, 0x5a, 0x3e, 0xc2, 0x9b, 0x5d, 0x11, 0x69, 0x2d, 0x5c, 0x8d, 0x91, 0x14,
+    0xc1, 0x9b, 0x81, 0xd3, 0x02, 0xa9, 0xb3, 0x42, 0x4a, 0xa4, 0xba, 0x5c, 0x80, 0x8e, 0x19, 0x92,
+    0x0d, 0xfe, 0xe8, 0x1f, 0x16, 0x0e, 0xd9, 0x20, 0xcf, 0x4e, 0xf3, 0x69, 0x44, 0x41, 0x9f, 0xc1,
+    0x65, 0xa7, 0xa9, 0x7b, 0x55, 0x0c, 0xee, 0xf1, 0x58, 0x14, 0xc5, 0x2c, 0x6a, 0x72, 0x1b, 0x1c,
+    0x70, 0x0d, 0x14, 0xb8, 0x42, 0xba, 0x7d, 0x4b, 0x58, 0x6c, 0x61, 0xf9, 0xf6, 0x55, 0x95, 0x06,
+    0xab, 0x8c, 0x90, 0xdc, 0x3a, 0x53, 0x3b, 0x68, 0x9a, 0x4e, 0x62, 0x63, 0xe3, 0xf4, 0x92, 0x0c,
+    0x41, 0x9f, 0x5c, 0x8c, 0xd3, 0xf9, 0x1b, 0x89, 0x9f, 0xec, 0x43, 0xbf, 0xd6, 0xfc, 0xc9, 0xfe,
+    0x98, 0xcf, 0xca, 0x54, 0xb7, 0x3e, 0x79, 0x02, 0xf1, 0x09, 0x5f, 0x92, 0x44, 0x01, 0x00, 0x00
+};
+
+static const uint8_t asset_menu_js[138] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x45, 0x8d, 0xb1, 0x0e, 0xc2, 0x30,
+    0x0c, 0x05, 0x77, 0x7e, 0x24, 0xc9, 0x50, 0xab, 0x33, 0x28, 0x20, 0x06, 0x36, 0x36, 0x46, 0xd4,
+    0x21, 0x8a, 0x5d, 0x25, 0x92, 0x1b, 0x83, 0x93, 0xa8, 0xe2, 0xef, 0x5b, 0x75, 0x61, 0x7d, 0x77,
+    0xba, 0x87, 0x12, 0xfb, 0x42, 0xa5, 0xc1, 0xb7, 0x93, 0xfe, 0x5e, 0xc4, 0x14, 0x9b, 0xe8, 0x9d,
+    0xd9, 0x1a, 0xf8, 0x74, 0xa5, 0x61, 0x87, 0x7d, 0xc8, 0x8d, 0x16, 0xe3, 0x60, 0x16, 0x7d, 0x84,
+    0x98, 0xac, 0x25, 0xe7, 0xaf, 0x04, 0x31, 0x65, 0x46, 0xa5, 0xf2, 0x1e, 0x27, 0x48, 0x4a, 0xb3,
+    0xf7, 0x7e, 0xcd, 0x05, 0x65, 0x05, 0x96, 0x18, 0x5a, 0x96, 0x72, 0xcc, 0xb7, 0xdd, 0xe4, 0x50,
+    0xeb, 0x33, 0xd7, 0x06, 0x01, 0xd1, 0x9a, 0x7f, 0xb8, 0x1e, 0x87, 0x84, 0xc6, 0x9d, 0x47, 0x77,
+    0x39, 0x6d, 0x25, 0xe4, 0x3b, 0xbf, 0x8e, 0x00, 0x00, 0x00
+};
+
+static const uint8_t asset_update_js[634] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x94, 0x41, 0x4f, 0xdc, 0x30,
+    0x10, 0x85, 0xef, 0xfd, 0x15, 0x46, 0x55, 0xb1, 0x53, 0xb2, 0x66, 0x41, 0x6a, 0x0f, 0x8d, 0x42,
+    0x8b, 0x68, 0x2b, 0x0e, 0x20, 0x55, 0xb0, 0x95, 0x90, 0xaa, 0x1e, 0x66, 0xe3, 0xc9, 0xae, 0xd5,
+    0xc4, 0x4e, 0xed, 0xc9, 0xd2, 0x15, 0xda, 0xff, 0xde, 0x71, 0x02, 0x08, 0xaa, 0x70, 0xeb, 0x29,
+    0x91, 0xed, 0xbc, 0xf7, 0xcd, 0x9b, 0x89, 0x15, 0x96, 0x27, 0x77, 0x95, 0x77, 0x91, 0x04, 0x95,
+    0x4a, 0x6b, 0x4d, 0x59, 0x79, 0x82, 0xfa, 0x77, 0x8f, 0x61, 0x7b, 0x8d, 0x0d, 0x56, 0xe4, 0xc3,
+    0xb8, 0x9c, 0xbb, 0x92, 0x94, 0xac, 0x7d, 0x68, 0x65, 0x96, 0x43, 0x7a, 0x7f, 0x1d, 0x09, 0xa8,
+    0x8f, 0x32, 0x2b, 0x9c, 0x06, 0x63, 0xbe, 0x6c, 0xd0, 0xd1, 0x85, 0x8d, 0x84, 0x0e, 0x83, 0x92,
+    0xb1, 0x5f, 0xb6, 0x96, 0x64, 0x9e, 0x0c, 0x50, 0x77, 0x01, 0xd3, 0xf6, 0x67, 0xac, 0xa1, 0x6f,
+    0x48, 0x65, 0xc5, 0xe8, 0xe9, 0x07, 0x9d, 0xda, 0x36, 0x28, 0x33, 0x9d, 0x1e, 0xf1, 0xc7, 0xfc,
+    0x67, 0x6e, 0x4a, 0x87, 0xb7, 0xe2, 0xe6, 0xf2, 0xe2, 0x9c, 0xa8, 0xbb, 0x42, 0x86, 0x89, 0x54,
+    0xf8, 0x8f, 0xca, 0xe9, 0xaa, 0x81, 0x18, 0x93, 0x47, 0x32, 0x54, 0xb2, 0xef, 0x1a, 0x0f, 0xc6,
+    0xba, 0x15, 0x23, 0x99, 0x09, 0x86, 0xb4, 0x3b, 0x12, 0xd8, 0x5a, 0x19, 0x3d, 0xf2, 0xee, 0x95,
+    0xe5, 0xf1, 0x7c, 0x9e, 0xdd, 0x81, 0xb6, 0x8e, 0x4f, 0x2d, 0xf0, 0x0f, 0x95, 0xf2, 0x7b, 0x67,
+    0x80, 0x50, 0xd4, 0xc0, 0x0c, 0x46, 0x28, 0x79, 0x60, 0x74, 0xc0, 0xd8, 0x31, 0x24, 0xa6, 0x03,
+    0x07, 0x8c, 0xa7, 0xb5, 0x58, 0x84, 0xad, 0x80, 0x15, 0x58, 0x27, 0x7c, 0x10, 0x5c, 0x01, 0x41,
+    0x45, 0xc2, 0xba, 0xda, 0x7f, 0x8a, 0x50, 0x63, 0x05, 0xcc, 0xe5, 0xc3, 0x4a, 0xe6, 0x4f, 0x41,
+    0x03, 0xb6, 0x7e, 0x83, 0xcf, 0x58, 0x8b, 0x80, 0xd4, 0x07, 0xb7, 0x7b, 0x46, 0x70, 0xda, 0x75,
+    0xcd, 0x96, 0xb7, 0x45, 0x3f, 0xa0, 0xb0, 0x9d, 0x2c, 0x22, 0xd2, 0xc2, 0xb6, 0xe8, 0x7b, 0x52,
+    0x8a, 0xfb, 0xf2, 0x2f, 0x72, 0x12, 0x14, 0xb1, 0xaf, 0x2a, 0x8c, 0x71, 0x4f, 0x5c, 0x71, 0x4a,
+    0x10, 0x28, 0x49, 0x18, 0xdc, 0xd8, 0x0a, 0x05, 0x79, 0x01, 0x49, 0xf5, 0x41, 0x52, 0x16, 0x0f,
+    0x9d, 0x9e, 0xc8, 0x97, 0xd1, 0x3b, 0x74, 0x4a, 0xae, 0x90, 0x9b, 0x26, 0x0f, 0x03, 0x2e, 0xbd,
+    0x27, 0xce, 0x95, 0x74, 0x44, 0x67, 0x54, 0xb6, 0xcb, 0x39, 0xb5, 0x79, 0xb6, 0x9b, 0x4e, 0x1a,
+    0x43, 0xf0, 0x61, 0x8c, 0x7a, 0x0a, 0x72, 0xcc, 0xf5, 0x3f, 0x46, 0xf8, 0x02, 0x06, 0x2c, 0x7d,
+    0xa0, 0x97, 0x31, 0x2a, 0x70, 0x15, 0x36, 0x23, 0x89, 0x1c, 0x24, 0x46, 0xc9, 0x09, 0xa5, 0x2e,
+    0xf8, 0x15, 0x4f, 0x40, 0x7c, 0x1c, 0x1f, 0xd4, 0x0d, 0xba, 0x15, 0xad, 0xcf, 0x7c, 0xdb, 0xf5,
+    0x04, 0xcb, 0x06, 0xb3, 0x29, 0x8f, 0x14, 0x7f, 0x4a, 0xb7, 0xb6, 0xa1, 0xbd, 0x85, 0x80, 0x43,
+    0xcd, 0x6b, 0x1b, 0x93, 0xb7, 0x20, 0xf8, 0x85, 0xdc, 0x8c, 0xd4, 0x98, 0xa3, 0xb9, 0x68, 0xad,
+    0xeb, 0x09, 0xe3, 0x63, 0x5b, 0x5c, 0x79, 0x09, 0xb4, 0xd6, 0xc1, 0xf7, 0x9c, 0x37, 0xdb, 0xb1,
+    0x1a, 0x9a, 0x43, 0xd4, 0xe4, 0x09, 0x9a, 0xb7, 0x47, 0x1c, 0xfe, 0x81, 0x7c, 0x23, 0x8b, 0xf4,
+    0xc7, 0x74, 0x1c, 0x51, 0xf6, 0xc4, 0xdc, 0xe5, 0x69, 0x75, 0x09, 0x81, 0x57, 0x23, 0x6d, 0x1b,
+    0xd4, 0xb7, 0xd6, 0xd0, 0xba, 0x74, 0xbb, 0xa1, 0xca, 0xa1, 0xb3, 0x4e, 0xb7, 0x48, 0x6b, 0x6f,
+    0x38, 0x5a, 0xce, 0xdc, 0x7a, 0x97, 0x76, 0x78, 0xc2, 0xee, 0x07, 0xe0, 0x1c, 0xd9, 0x8e, 0x0b,
+    0x3f, 0xe3, 0x9e, 0x70, 0x12, 0xb3, 0xc5, 0xb6, 0x43, 0x1e, 0x84, 0x34, 0x40, 0xb6, 0x82, 0x74,
+    0xfe, 0xd0, 0x57, 0x84, 0x34, 0x8b, 0x14, 0x10, 0xd2, 0x25, 0x30, 0x5c, 0x01, 0x6b, 0x38, 0x7e,
+    0xf7, 0x9e, 0x5d, 0x37, 0xd0, 0xf4, 0xb8, 0xbf, 0x3f, 0xa5, 0x78, 0x33, 0xfb, 0x7a, 0x1f, 0xc6,
+    0xec, 0xfa, 0xfc, 0x34, 0x1d, 0x9f, 0xf8, 0x54, 0x53, 0xb0, 0xad, 0xca, 0x46, 0x26, 0xae, 0xdf,
+    0x67, 0xd9, 0x87, 0x67, 0xf1, 0x7e, 0x6b, 0x10, 0x22, 0x8a, 0x38, 0x5c, 0x4a, 0x02, 0x44, 0xba,
+    0x2d, 0xc6, 0x36, 0xee, 0x32, 0x45, 0x9c, 0xb0, 0x36, 0xbe, 0xea, 0x5b, 0x46, 0xcf, 0x8a, 0x57,
+    0x7f, 0x01, 0x18, 0x2f, 0x8a, 0xdf, 0xd7, 0x04, 0x00, 0x00
+};
+
+static const uint8_t asset_status_js[515] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x75, 0x53, 0x4d, 0x6f, 0x13, 0x31,
+    0x10, 0xbd, 0xf7, 0x57, 0xcc, 0x21, 0x92, 0xbd, 0x22, 0x75, 0xc2, 0x81, 0x4b, 0xa2, 0x05, 0xa9,
+    0x11, 0x45, 0x91, 0x28, 0x42, 0x54, 0x15, 0x07, 0x82, 0x1a, 0x67, 0x3d, 0xd9, 0xb8, 0xdd, 0xb5,
+    0x57, 0xb6, 0x37, 0x10, 0x45, 0xfb, 0xdf, 0x3b, 0xf6, 0xe6, 0x83, 0x14, 0xf0, 0x69, 0xfc, 0xe6,
+    0xf9, 0xcd, 0xa7, 0xb9, 0x82, 0xfc, 0x3d, 0xec, 0xaf, 0x00, 0x0a, 0x6b, 0x7c, 0x00, 0xdb, 0x06,
+    0xc8, 0x41, 0x89, 0x12, 0xc3, 0xc7, 0x0a, 0x6b, 0x34, 0xe1, 0x66, 0x37, 0x57, 0x9c, 0xf9, 0x20,
+    0x43, 0xeb, 0x59, 0x36, 0x3d, 0x31, 0x6b, 0xac, 0x57, 0xe8, 0x88, 0x5c, 0x47, 0x85, 0xe5, 0x60,
+    0x5f, 0x0b, 0x23, 0x6b, 0xec, 0xe0, 0x47, 0x34, 0x23, 0x1f, 0xbb, 0x9f, 0x0b, 0x03, 0xd7, 0x70,
+    0x9f, 0xde, 0x4e, 0xe0, 0x88, 0xb7, 0xbe, 0x5b, 0x98, 0xe5, 0x59, 0xa9, 0x6d, 0x14, 0x91, 0x49,
+    0x89, 0x67, 0x51, 0x6a, 0x8d, 0xa1, 0xd8, 0x70, 0x36, 0x92, 0x8d, 0x1e, 0x1d, 0xc3, 0x8a, 0xb0,
+    0x41, 0xc3, 0x5d, 0x74, 0x3b, 0xf1, 0xe4, 0xad, 0xe1, 0xd9, 0x01, 0xf3, 0xc7, 0xfc, 0x8f, 0x6a,
+    0x31, 0x25, 0x2f, 0x1c, 0x4a, 0xa5, 0x4d, 0x39, 0x4d, 0x0e, 0x2a, 0x4a, 0x04, 0xfc, 0x1d, 0x66,
+    0xd6, 0x04, 0xaa, 0x08, 0xf2, 0x84, 0x02, 0x2c, 0x57, 0x9f, 0x50, 0x97, 0x1a, 0x67, 0x92, 0xde,
+    0x0d, 0xf6, 0x5e, 0x28, 0xdc, 0xea, 0x02, 0x1f, 0xb5, 0xea, 0x60, 0x8b, 0xce, 0x6b, 0x6b, 0x12,
+    0x7c, 0xb0, 0x63, 0xd6, 0xf0, 0xe6, 0xf8, 0x96, 0x0a, 0x7b, 0x68, 0x82, 0xae, 0x71, 0x92, 0x38,
+    0x6d, 0xb2, 0x3b, 0xf0, 0xaf, 0x49, 0xb7, 0x0e, 0x11, 0x36, 0x28, 0x9b, 0x9e, 0x17, 0x2d, 0xb1,
+    0x26, 0xac, 0x83, 0xd5, 0x2e, 0xa0, 0x07, 0x5e, 0x6b, 0x73, 0xf6, 0xd0, 0xe5, 0x31, 0x79, 0xb3,
+    0xd7, 0x3a, 0xdf, 0xf5, 0xad, 0xee, 0x25, 0x7e, 0xe9, 0xb5, 0x16, 0x54, 0xac, 0xc1, 0x22, 0xa0,
+    0x82, 0x0f, 0xb0, 0x3c, 0x5d, 0x86, 0xf0, 0xed, 0xfe, 0x7e, 0x7e, 0x66, 0x39, 0xef, 0x75, 0x07,
+    0xea, 0xa6, 0x5e, 0xc2, 0x04, 0x98, 0xb1, 0x01, 0x4e, 0x54, 0xf6, 0x8f, 0x72, 0x2a, 0x2b, 0x15,
+    0xac, 0x64, 0xf1, 0x5c, 0xd9, 0xb2, 0x8f, 0x45, 0x43, 0x10, 0x07, 0x00, 0xf2, 0x3c, 0x07, 0xd3,
+    0x56, 0x15, 0x45, 0x64, 0xd7, 0x8c, 0x04, 0x2f, 0xdc, 0x17, 0x72, 0x34, 0x2a, 0x4a, 0xeb, 0x73,
+    0xec, 0xeb, 0x61, 0x12, 0xc0, 0x07, 0xfb, 0x3b, 0x19, 0x36, 0xc2, 0xd9, 0xd6, 0x28, 0xee, 0x84,
+    0x2c, 0x11, 0x46, 0xf0, 0x76, 0x3c, 0x1e, 0x67, 0xd4, 0x35, 0x90, 0xa5, 0xcd, 0xd2, 0xb6, 0x0c,
+    0xf6, 0x4e, 0x14, 0x4d, 0xdd, 0xc1, 0xec, 0xeb, 0xdd, 0x10, 0xb6, 0xb2, 0xd2, 0x6a, 0x92, 0xc0,
+    0x64, 0xc6, 0xd8, 0x3b, 0xf4, 0xac, 0x2f, 0x27, 0xd5, 0x70, 0x08, 0x49, 0x87, 0xb0, 0x2f, 0xf6,
+    0x14, 0x70, 0x87, 0x61, 0x61, 0x58, 0x76, 0xca, 0x89, 0x5a, 0x62, 0xdd, 0x33, 0x8d, 0x52, 0xd4,
+    0xb2, 0xe1, 0xfd, 0xfa, 0x66, 0xe2, 0xc9, 0x6a, 0xc3, 0xd9, 0x05, 0x6d, 0x23, 0x8d, 0xaa, 0xfe,
+    0xc7, 0x8b, 0x1b, 0xd5, 0x65, 0xa2, 0x90, 0x71, 0x49, 0xfb, 0x85, 0xfd, 0x6b, 0xbd, 0x80, 0x3d,
+    0x18, 0xb9, 0xaa, 0x10, 0x82, 0x05, 0xfa, 0x48, 0x40, 0x8b, 0x0a, 0x7f, 0x7e, 0xa0, 0x7e, 0xe1,
+    0x79, 0xb2, 0x3d, 0x86, 0x39, 0x3d, 0x73, 0x54, 0x1d, 0xef, 0xf1, 0x21, 0xbc, 0x8b, 0x4d, 0x99,
+    0x5e, 0x75, 0x19, 0x57, 0xb6, 0x68, 0xe3, 0x27, 0xa4, 0xdb, 0x0b, 0xad, 0x6c, 0x40, 0xe3, 0xaa,
+    0x03, 0x00, 0x00
+};
+
+static const uint8_t asset_favicon_ico[696] = {
+    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x49, 0x48, 0x44, 0x52,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0x06, 0x00, 0x00, 0x00, 0x1f, 0xf3, 0xff,
+    0x61, 0x00, 0x00, 0x00, 0x20, 0x63, 0x48, 0x52, 0x4d, 0x00, 0x00, 0x6d, 0x75, 0x00, 0x00, 0x73,
+    0xa0, 0x00, 0x00, 0xfc, 0xdd, 0x00, 0x00, 0x83, 0x64, 0x00, 0x00, 0x70, 0xe8, 0x00, 0x00, 0xec,
+    0x68, 0x00, 0x00, 0x30, 0x3e, 0x00, 0x00, 0x10, 0x90, 0xe4, 0xec, 0x99, 0xea, 0x00, 0x00, 0x00,
+    0x06, 0x62, 0x4b, 0x47, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x43, 0xbb, 0x7f, 0x00,
+    0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b, 0x13, 0x01,
+    0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x00, 0x09, 0x76, 0x70, 0x41, 0x67, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x5c, 0xc6, 0xad, 0xc3, 0x00, 0x00, 0x02, 0x17, 0x49, 0x44, 0x41,
+    0x54, 0x38, 0xcb, 0x8d, 0x90, 0x4f, 0x48, 0x93, 0x71, 0x1c, 0xc6, 0x9f, 0xdf, 0xbf, 0xf7, 0xf5,
+    0x5d, 0x8e, 0x35, 0x27, 0x94, 0xa7, 0x12, 0x8a, 0x4e, 0x05, 0x32, 0x50, 0x90, 0xfe, 0x30, 0xa1,
+    0x4b, 0x78, 0xe8, 0x14, 0xa4, 0xa6, 0xd0, 0x25, 0x6f, 0x19, 0x12, 0x42, 0x98, 0x21, 0xe9, 0x76,
+    0xd8, 0xa9, 0x43, 0x5e, 0x3a, 0x74, 0x75, 0xd0, 0x84, 0x6c, 0xa7, 0x4e, 0x91, 0x90, 0x87, 0x3c,
+    0x28, 0x83, 0xa2, 0xe5, 0x66, 0x46, 0xb2, 0x06, 0x19, 0x6e, 0x2e, 0x77, 0xd9, 0xde, 0xa7, 0x43,
+    0xfa, 0xe2, 0xf0, 0x4f, 0xfb, 0xc0, 0xf7, 0xf0, 0x85, 0xdf, 0xef, 0xc3, 0xf3, 0x7c, 0x21, 0x8d,
+    0xe1, 0xc9, 0x50, 0x88, 0xd1, 0x58, 0x8c, 0x97, 0x3a, 0x3a, 0x08, 0x80, 0x42, 0x6b, 0x6a, 0xdb,
+    0x6e, 0x68, 0x20, 0x8d, 0x61, 0xa0, 0xa5, 0x85, 0x85, 0x42, 0x81, 0xa5, 0x52, 0x89, 0xd1, 0x58,
+    0x8c, 0xa7, 0xda, 0xda, 0x08, 0x80, 0xd2, 0x98, 0xff, 0x0b, 0x94, 0x65, 0xb1, 0xc9, 0xe7, 0x63,
+    0x22, 0x91, 0xe0, 0x1e, 0xb9, 0xb5, 0x35, 0xde, 0x1b, 0x1e, 0xa6, 0xe3, 0xf3, 0x11, 0x00, 0x95,
+    0x65, 0x1d, 0x2d, 0xd0, 0xb6, 0x4d, 0x69, 0x0c, 0x95, 0x31, 0xbc, 0xdd, 0xd7, 0xc7, 0x74, 0x3a,
+    0xed, 0x89, 0x3e, 0x2c, 0x2e, 0xf2, 0x46, 0x6f, 0x2f, 0x21, 0x25, 0x21, 0xc4, 0xd1, 0x02, 0xa7,
+    0xb9, 0xd9, 0x8b, 0xed, 0x0f, 0x04, 0xf8, 0x70, 0x6c, 0x8c, 0xf9, 0x7c, 0xde, 0x13, 0xbd, 0x4a,
+    0x26, 0xd9, 0x11, 0x0e, 0x1f, 0x5a, 0x0b, 0xd2, 0x18, 0x06, 0x5b, 0x5b, 0xf9, 0x71, 0x69, 0x89,
+    0x4f, 0x26, 0x27, 0x19, 0x08, 0x06, 0x09, 0x80, 0x67, 0xda, 0xdb, 0xf9, 0x7c, 0x66, 0x86, 0x95,
+    0x4a, 0x85, 0x24, 0x59, 0x2e, 0x97, 0x19, 0x8f, 0xc7, 0x79, 0xc2, 0xef, 0xaf, 0xab, 0xe4, 0xdd,
+    0xe0, 0xf5, 0xfc, 0x3c, 0x49, 0x32, 0x93, 0xc9, 0xf0, 0xce, 0xe0, 0x20, 0x85, 0x52, 0x04, 0xc0,
+    0xce, 0xae, 0x2e, 0xbe, 0x49, 0xa5, 0xbc, 0x34, 0x0f, 0x46, 0x47, 0x09, 0xa0, 0xbe, 0x82, 0x32,
+    0x86, 0x4d, 0x3e, 0x1f, 0x07, 0x87, 0x86, 0xf8, 0x75, 0x75, 0x95, 0x24, 0xf9, 0x7e, 0x61, 0x81,
+    0x91, 0x9e, 0x9e, 0x7f, 0xb1, 0xb5, 0x66, 0x6a, 0x57, 0x32, 0x9b, 0x48, 0x1c, 0x14, 0x68, 0xdb,
+    0xa6, 0xb2, 0x2c, 0x02, 0x60, 0x30, 0x14, 0xe2, 0xa3, 0xf1, 0x71, 0x16, 0x8b, 0x45, 0x56, 0x6b,
+    0x35, 0xde, 0x1f, 0x19, 0x21, 0x00, 0x3e, 0x9d, 0x9e, 0x3e, 0x54, 0x20, 0xb1, 0x8b, 0x10, 0x02,
+    0xda, 0xb6, 0xb1, 0x55, 0x2c, 0x22, 0x3a, 0x35, 0x85, 0x6b, 0x91, 0x08, 0xfe, 0x94, 0xcb, 0x18,
+    0xe8, 0xef, 0x07, 0x00, 0x48, 0xe9, 0x3d, 0xad, 0x43, 0xef, 0x5f, 0x48, 0x42, 0x29, 0x05, 0x4a,
+    0x89, 0xe5, 0x95, 0x15, 0x7c, 0x5b, 0x5f, 0x87, 0xd2, 0x1a, 0xc7, 0xe1, 0x69, 0xdd, 0x6a, 0x15,
+    0x5a, 0x6b, 0x90, 0x2e, 0xe8, 0xba, 0x50, 0x4a, 0x79, 0xd2, 0xe3, 0xd0, 0x7b, 0x9f, 0xcf, 0x85,
+    0xbb, 0x71, 0xf5, 0xd6, 0x5d, 0xfc, 0xce, 0xff, 0xc0, 0xdb, 0x97, 0xcf, 0xb0, 0x53, 0xda, 0x42,
+    0x23, 0x48, 0x90, 0x90, 0x5a, 0xa3, 0xfb, 0xe6, 0x00, 0x4e, 0x9f, 0x3d, 0x8f, 0x8b, 0x97, 0xaf,
+    0xe3, 0x42, 0xe7, 0x15, 0xb8, 0xd5, 0x6a, 0x83, 0x02, 0x21, 0xe0, 0xd6, 0xaa, 0xf8, 0x99, 0xfb,
+    0x02, 0x21, 0x25, 0x76, 0xb6, 0xb7, 0xb0, 0xb9, 0xb1, 0x0e, 0x08, 0x01, 0xc7, 0x71, 0xe0, 0x38,
+    0x0e, 0x00, 0xc0, 0xb2, 0x2c, 0x00, 0x80, 0x6d, 0xdb, 0x07, 0x2b, 0x08, 0xa9, 0xf0, 0x6e, 0xf6,
+    0x05, 0xbe, 0x7f, 0x5e, 0xc6, 0xf6, 0xe6, 0x2f, 0x6c, 0x64, 0x3f, 0x41, 0x19, 0x83, 0xc7, 0x13,
+    0x13, 0x70, 0x5d, 0x17, 0x52, 0x6b, 0x24, 0xe7, 0xe6, 0x90, 0xcb, 0xe5, 0x90, 0xcd, 0x66, 0x21,
+    0xf7, 0x1d, 0xf6, 0x2f, 0x5c, 0x10, 0x5a, 0xa6, 0x1c, 0x58, 0x1b, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
+};
+
+const WebAsset web_assets[WEB_ASSET_COUNT] = {
+    {"/pure.css", "text/css", "\"434cc2ad4b3621f5\"", true, asset_pure_css, 3906},
+    {"/style.css", "text/css", "\"009f811bc3f49f98\"", true, asset_style_css, 208},
+    {"/menu.js", "application/javascript", "\"b94827e5d4eb9cc7\"", true, asset_menu_js, 138},
+    {"/update.js", "application/javascript", "\"9506b04775d9ea7e\"", true, asset_update_js, 634},
+    {"/status.js", "application/javascript", "\"09b3b3e637dd56b0\"", true, asset_status_js, 515},
+    {"/favicon.ico", "image/x-icon", "\"cbcd0d239abcf004\"", false, asset_favicon_ico, 696},
+};
@@ -0,0 +1,32 @@
+// Generated by tools/embed_assets.py from web/, do not edit
+#ifndef BGEIGIECAST_WEB_ASSETS_H
+#define BGEIGIECAST_WEB_ASSETS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define WEB_ASSET_COUNT 6
+
+// Content hashes, to version the asset urls in the pages
+#define ASSET_VERSION_PURE_CSS "434cc2ad4b3621f5"
+#define ASSET_VERSION_STYLE_CSS "009f811bc3f49f98"
+#define ASSET_VERSION_MENU_JS "b94827e5d4eb9cc7"
+#define ASSET_VERSION_UPDATE_JS "9506b04775d9ea7e"
+#define ASSET_VERSION_STATUS_JS "09b3b3e637dd56b0"
+#define ASSET_VERSION_FAVICON_ICO "cbcd0d239abcf004"
+
+/**
+ * Static resource of the configuration server, stored in flash
+ */
+struct WebAsset {
+  const char* path;
+  const char* content_type;
+  const char* etag;
+  bool gzipped;
+  const uint8_t* data;
+  size_t size;
+};
+
+extern const WebAsset web_assets[WEB_ASSET_COUNT];
+
+#endif //BGEIGIECAST_WEB_ASSETS_H
@@ -1,31 +1,353 @@
 #include <WiFi.h>
 #include <Arduino.h>
 #include <ESPmDNS.h>
+#include <esp_timer.h>
+#include <tcpip_adapter.h>
+#include <lwip/dhcp.h>
+#include <time.h>
 
 #include "wifi_connection.h"
+#include "user_config.h"
 #include "debugger.h"
 
+#define WIFI_CACHE_MAGIC 0xB6E1C0DF
 
-bool WiFiConnection::connect_wifi(const char* ssid, const char* password) {
-  if(!ssid) {
-    DEBUG_PRINTLN("WiFi connector: No SSID to connect to!");
+namespace {
+
+typedef enum WiFiState {
+  e_wifi_idle,
+  e_wifi_fast_connecting, // cached access point and lease
+  e_wifi_scanning,
+  e_wifi_connecting, // ranked candidate of the scan, with DHCP
+  e_wifi_connected,
+} WiFiState;
+
+/**
+ * Last connection, in RTC memory so it survives a restart or deep sleep (not a power cycle)
+ */
+struct WiFiCache {
+  uint32_t magic;
+  uint32_t credentials; // hash of the ssid and password of the profile the cache is valid for
+  uint8_t bssid[6];
+  uint8_t channel;
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns;
+  time_t leased_at; // seconds since boot (or wall time when synced), survives the same as RTC memory
+  uint32_t renew_after; // seconds, renewal time (T1) of the lease, the IP is reused without DHCP until then
+};
+
+RTC_DATA_ATTR WiFiCache cache;
+
+std::atomic<uint8_t> state(e_wifi_idle);
+WiFiProfile profiles[WIFI_PROFILE_COUNT];
+uint32_t credentials[WIFI_PROFILE_COUNT];
+WiFiRanking ranking(profiles, WIFI_PROFILE_COUNT);
+uint8_t candidate; // index in the ranking
+uint8_t profile; // being connected
+int8_t connected_profile = -1; // of the last connection
+uint32_t connect_start;
+uint32_t attempt_start; // of the current step (fast connect, scan or candidate)
+uint32_t associated_at;
+uint8_t bssid[6]; // of the current association, cached when the IP is configured
+uint8_t channel;
+bool lease_reused;
+bool events_registered = false;
+esp_timer_handle_t renew_timer = nullptr;
+WiFiMetrics metrics;
+
+/**
+ * FNV-1a
+ */
+uint32_t hash(const char* str, uint32_t value = 2166136261u) {
+  for(; *str; ++str) {
+    value = (value ^ static_cast<uint8_t>(*str)) * 16777619u;
+  }
+  return value;
+}
+
+/**
+ * @return profile of the cached access point, -1 if the cache is not valid for any profile
+ */
+int8_t cached_profile() {
+  if(cache.magic != WIFI_CACHE_MAGIC) {
+    return -1;
+  }
+  for(uint8_t i = 0; i < WIFI_PROFILE_COUNT; ++i) {
+    if(profiles[i].ssid[0] && credentials[i] == cache.credentials) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @return renewal time (T1) of the current DHCP lease in seconds, 0 if there is no lease
+ */
+uint32_t lease_renew_seconds() {
+  void* netif = nullptr;
+  if(tcpip_adapter_get_netif(TCPIP_ADAPTER_IF_STA, &netif) != ESP_OK || !netif) {
+    return 0;
+  }
+  auto dhcp = netif_dhcp_data(static_cast<struct netif*>(netif));
+  if(!dhcp) {
+    return 0;
+  }
+  // Half the lease time if the server did not send T1
+  return dhcp->offered_t1_renew ? dhcp->offered_t1_renew : dhcp->offered_t0_lease / 2;
+}
+
+bool lease_valid() {
+  time_t now = time(nullptr);
+  return cache.ip && now >= cache.leased_at && now - cache.leased_at < cache.renew_after;
+}
+
+void use_dhcp() {
+  WiFi.config(IPAddress(static_cast<uint32_t>(0)), IPAddress(static_cast<uint32_t>(0)),
+              IPAddress(static_cast<uint32_t>(0)));
+}
+
+void begin(const WiFiProfile& network, uint8_t network_channel, const uint8_t* network_bssid) {
+  attempt_start = millis();
+  WiFi.begin(network.ssid, network.password[0] ? network.password : nullptr, network_channel, network_bssid);
+}
+
+void start_fast_connect(uint8_t cached) {
+  profile = cached;
+  lease_reused = lease_valid();
+  state = e_wifi_fast_connecting;
+  if(lease_reused) {
+    WiFi.config(IPAddress(cache.ip), IPAddress(cache.gateway), IPAddress(cache.subnet), IPAddress(cache.dns));
+  } else {
+    use_dhcp();
+  }
+  begin(profiles[profile], cache.channel, cache.bssid);
+}
+
+void start_scan() {
+  state = e_wifi_scanning;
+  attempt_start = millis();
+  ++metrics.scans;
+  if(WiFi.scanNetworks(true) == WIFI_SCAN_FAILED) {
+    DEBUG_PRINTLN("WiFi connector: unable to start scan");
+    state = e_wifi_idle;
+  }
+}
+
+/**
+ * Connect to the next candidate of the ranking
+ */
+void connect_candidate() {
+  if(candidate >= ranking.get_count()) {
+    DEBUG_PRINTLN("WiFi connector: no stored network available");
+    state = e_wifi_idle;
+    return;
+  }
+  const auto& network = ranking.get(candidate);
+  profile = network.profile;
+  lease_reused = false;
+  state = e_wifi_connecting;
+  use_dhcp();
+  DEBUG_PRINTF("WiFi connector: connecting to %s (%d dBm)\n", profiles[profile].ssid, network.rssi);
+  begin(profiles[profile], network.channel, network.bssid);
+}
+
+/**
+ * Start with the cached access point if there is one, else scan
+ */
+void start_connect() {
+  connect_start = millis();
+  int8_t cached = cached_profile();
+  if(cached >= 0) {
+    start_fast_connect(cached);
+  } else {
+    start_scan();
+  }
+}
+
+/**
+ * A reused lease is not renewed while the IP is configured statically, DHCP takes over at its renewal time
+ */
+void schedule_renew() {
+  esp_timer_stop(renew_timer);
+  if(lease_reused) {
+    int32_t remaining = static_cast<int32_t>(cache.renew_after) - static_cast<int32_t>(time(nullptr) - cache.leased_at);
+    esp_timer_start_once(renew_timer, remaining > 0 ? remaining * 1000000ull : 0);
+  }
+}
+
+void on_renew(void*) {
+  if(state == e_wifi_connected && lease_reused) {
+    DEBUG_PRINTLN("WiFi connector: reused lease reached its renewal time, starting DHCP");
+    lease_reused = false;
+    // Starts the DHCP client, the new lease follows as another got IP event
+    use_dhcp();
+  }
+}
+
+void on_scan_done() {
+  if(state != e_wifi_scanning) {
+    return;
+  }
+  metrics.last_scan = millis() - attempt_start;
+  int16_t found = WiFi.scanComplete();
+  ranking.clear();
+  for(int16_t i = 0; i < found; ++i) {
+    ranking.add(WiFi.SSID(i).c_str(), WiFi.RSSI(i), WiFi.channel(i), WiFi.BSSID(i));
+  }
+  WiFi.scanDelete();
+  candidate = 0;
+  metrics.last_candidates = ranking.rank();
+  DEBUG_PRINTF("WiFi connector: scan found %d networks, %u stored, in %u ms\n",
+               found, metrics.last_candidates.load(), metrics.last_scan.load());
+  connect_candidate();
+}
+
+void on_connected() {
+  uint32_t now = millis();
+  bool renewed = state == e_wifi_connected;
+  if(!renewed) {
+    bool fast = state == e_wifi_fast_connecting;
+    metrics.last_dhcp = now - associated_at;
+    metrics.last_connect = now - connect_start;
+    metrics.last_fast = fast;
+    metrics.last_lease_reused = lease_reused;
+    metrics.last_profile = profile;
+    ++metrics.connects;
+    if(fast) {
+      ++metrics.fast_connects;
+    }
+    if(connected_profile >= 0 && connected_profile != profile) {
+      ++metrics.failovers;
+    }
+    connected_profile = profile;
+    state = e_wifi_connected;
+    DEBUG_PRINTF("WiFi connector: connected to %s (%s%s) in %u ms, association %u ms, ip %u ms\n",
+                 profiles[profile].ssid, fast ? "fast" : "full", lease_reused ? ", cached lease" : "",
+                 metrics.last_connect.load(), metrics.last_association.load(), metrics.last_dhcp.load());
+  }
+
+  cache.magic = WIFI_CACHE_MAGIC;
+  cache.credentials = credentials[profile];
+  memcpy(cache.bssid, bssid, sizeof(cache.bssid));
+  cache.channel = channel;
+  if(!lease_reused) {
+    // Renewals that keep the IP have no event, the cache keeps the time of the first lease, which only shortens
+    // the reuse
+    cache.ip = WiFi.localIP();
+    cache.gateway = WiFi.gatewayIP();
+    cache.subnet = WiFi.subnetMask();
+    cache.dns = WiFi.dnsIP();
+    cache.leased_at = time(nullptr);
+    cache.renew_after = lease_renew_seconds();
+  }
+  schedule_renew();
+}
+
+void on_disconnected(uint8_t reason) {
+  metrics.last_reason = reason;
+  switch(state) {
+    case e_wifi_connected:
+      // Access point lost, most likely it comes back on the same channel. Else the scan fails over to another network
+      ++metrics.disconnects;
+      esp_timer_stop(renew_timer);
+      DEBUG_PRINTF("WiFi connector: connection lost (reason %u), reconnecting\n", reason);
+      start_connect();
+      break;
+    case e_wifi_fast_connecting:
+      ++metrics.fast_failed;
+      cache.magic = 0;
+      DEBUG_PRINTF("WiFi connector: fast connect failed (reason %u), scanning\n", reason);
+      start_scan();
+      break;
+    case e_wifi_connecting:
+      DEBUG_PRINTF("WiFi connector: connect to %s failed (reason %u)\n", profiles[profile].ssid, reason);
+      ++candidate;
+      connect_candidate();
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * Runs on the WiFi event task
+ */
+void on_wifi_event(system_event_id_t event, system_event_info_t info) {
+  switch(event) {
+    case SYSTEM_EVENT_SCAN_DONE:
+      on_scan_done();
+      break;
+    case SYSTEM_EVENT_STA_CONNECTED:
+      associated_at = millis();
+      metrics.last_association = associated_at - attempt_start;
+      memcpy(bssid, info.connected.bssid, sizeof(bssid));
+      channel = info.connected.channel;
+      break;
+    case SYSTEM_EVENT_STA_GOT_IP:
+      if(state != e_wifi_idle) {
+        on_connected();
+      }
+      break;
+    case SYSTEM_EVENT_STA_DISCONNECTED:
+      on_disconnected(info.disconnected.reason);
+      break;
+    default:
+      break;
+  }
+}
+
+bool in_progress() {
+  return state != e_wifi_idle && state != e_wifi_connected && millis() - attempt_start < WIFI_CONNECT_TIMEOUT_MILLIS;
+}
+
+}
+
+bool WiFiConnection::connect_wifi(const WiFiProfile* stored_profiles, uint8_t count) {
+  if(!stored_profiles || !count) {
+    DEBUG_PRINTLN("WiFi connector: No network to connect to!");
+    return false;
+  }
+  if(!events_registered) {
+    esp_timer_create_args_t timer_args{};
+    timer_args.callback = &on_renew;
+    timer_args.name = "wifi_renew";
+    esp_timer_create(&timer_args, &renew_timer);
+    WiFi.onEvent(on_wifi_event);
+    // Reconnects are handled here, and the changing config should not be written to flash every connect
+    WiFi.setAutoReconnect(false);
+    WiFi.persistent(false);
+    events_registered = true;
+  }
+
+  if(state == e_wifi_connected) {
+    return true;
+  }
+  if(in_progress()) {
     return false;
   }
+  if(state != e_wifi_idle) {
+    DEBUG_PRINTLN("WiFi connector: connect timed out");
+  }
+
   DEBUG_PRINTLN("WiFi connector: Trying to connect to wifi...");
-  switch(WiFi.status()) {
-    case WL_CONNECTED:
-      return true;
-    case WL_DISCONNECTED:
-      WiFi.reconnect();
-      delay(100);
-      return WiFi.isConnected();
-    default:
-      password ? WiFi.begin(ssid, password) : WiFi.begin(ssid);
-      return WiFi.isConnected();
+  memset(profiles, 0, sizeof(profiles));
+  memcpy(profiles, stored_profiles, sizeof(WiFiProfile) * (count < WIFI_PROFILE_COUNT ? count : WIFI_PROFILE_COUNT));
+  for(uint8_t i = 0; i < WIFI_PROFILE_COUNT; ++i) {
+    profiles[i].ssid[WIFI_PROFILE_VAL_MAX - 1] = '\0';
+    profiles[i].password[WIFI_PROFILE_VAL_MAX - 1] = '\0';
+    credentials[i] = hash(profiles[i].password, hash(profiles[i].ssid));
   }
+  start_connect();
+  return false;
 }
 
 void WiFiConnection::disconnect_wifi() {
+  state = e_wifi_idle;
+  if(renew_timer) {
+    esp_timer_stop(renew_timer);
+  }
   WiFi.disconnect(true, true);
   WiFi.mode(WIFI_MODE_NULL);
 }
@@ -34,6 +356,14 @@ bool WiFiConnection::wifi_connected() {
   return WiFi.isConnected();
 }
 
+bool WiFiConnection::wifi_connecting() {
+  return in_progress();
+}
+
+const WiFiMetrics& WiFiConnection::get_metrics() {
+  return metrics;
+}
+
 bool WiFiConnection::start_ap_server(const char* host_ssid, const char* password) {
   set_hostname(host_ssid);
   WiFi.softAP(host_ssid, password);
@@ -1,15 +1,50 @@
 #ifndef BGEIGIECAST_WIFI_CONNECTION_H_
 #define BGEIGIECAST_WIFI_CONNECTION_H_
 
+#include <stdint.h>
+#include <atomic>
+
+#include "wifi_profiles.h"
+
+/**
+ * Connection statistics, written by the WiFi event task
+ */
+struct WiFiMetrics {
+  std::atomic<uint32_t> connects; // connections that got an IP
+  std::atomic<uint32_t> fast_connects; // of which with the cached access point
+  std::atomic<uint32_t> fast_failed; // fast connects that fell back to a full connect
+  std::atomic<uint32_t> disconnects; // connections lost while connected
+  std::atomic<uint32_t> failovers; // connected to another network than the last connection
+  std::atomic<uint32_t> scans;
+  std::atomic<uint32_t> last_scan; // millis
+  std::atomic<uint8_t> last_candidates; // stored networks found by the last scan
+  std::atomic<uint8_t> last_profile; // network of the last connection
+  std::atomic<uint8_t> last_reason; // of the last disconnect (wifi_err_reason_t)
+  std::atomic<bool> last_fast;
+  std::atomic<bool> last_lease_reused;
+  std::atomic<uint32_t> last_association; // millis from the connect until associated with the access point
+  std::atomic<uint32_t> last_dhcp; // millis from associated until the IP was configured
+  std::atomic<uint32_t> last_connect; // millis from the connect until the IP was configured
+};
+
+/**
+ * Connects to the best of the stored networks, driven by the WiFi events.
+ *
+ * The access point (BSSID, channel) and IP lease of the last connection are cached in RTC memory. A connect first
+ * tries the cached access point, which skips the scan. Until the renewal time (T1) the server gave the lease, the
+ * cached IP is configured without DHCP, and DHCP takes over at T1. After T1 DHCP runs as usual. If that fails, a single
+ * scan ranks the stored networks that are in range (see WiFiRanking), they are tried in that order. A lost connection
+ * is reconnected the same way without waiting for a retry, so it fails over to another network if its own is gone.
+ */
 class WiFiConnection {
  public:
   /**
-   * Connect to wifi endpoint
-   * @param ssid
-   * @param password
+   * Start connecting to the stored networks, the result follows from the WiFi events
+   * @param profiles: stored networks, copied
+   * @param count
    * @return true if connected
    */
-  static bool connect_wifi(const char* ssid, const char* password = nullptr);
+  static bool connect_wifi(const WiFiProfile* profiles, uint8_t count);
 
   /**
    * disconnect from wifi endpoint
@@ -22,6 +57,14 @@ class WiFiConnection {
    */
   static bool wifi_connected();
 
+  /**
+   * check if a connect is in progress
+   * @return
+   */
+  static bool wifi_connecting();
+
+  static const WiFiMetrics& get_metrics();
+
   /**
    * Start access point server
    * @return true if up
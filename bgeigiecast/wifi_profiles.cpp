@@ -0,0 +1,83 @@
+#include <string.h>
+
+#include "wifi_profiles.h"
+
+namespace {
+
+/**
+ * @return true if `a` should be tried before `b`
+ */
+bool better(const WiFiCandidate& a, const WiFiCandidate& b, const WiFiProfile* profiles) {
+  bool a_usable = a.rssi >= WIFI_MIN_RSSI;
+  bool b_usable = b.rssi >= WIFI_MIN_RSSI;
+  if(a_usable != b_usable) {
+    return a_usable;
+  }
+  if(profiles[a.profile].priority != profiles[b.profile].priority) {
+    return profiles[a.profile].priority > profiles[b.profile].priority;
+  }
+  return a.rssi > b.rssi;
+}
+
+}
+
+WiFiRanking::WiFiRanking(const WiFiProfile* profiles, uint8_t profile_count) :
+    _profiles(profiles),
+    _profile_count(profile_count < WIFI_PROFILE_COUNT ? profile_count : WIFI_PROFILE_COUNT),
+    _candidates(),
+    _count(0) {
+}
+
+void WiFiRanking::clear() {
+  _count = 0;
+}
+
+void WiFiRanking::add(const char* ssid, int8_t rssi, uint8_t channel, const uint8_t* bssid) {
+  if(!ssid || !ssid[0]) {
+    // Hidden network
+    return;
+  }
+  for(uint8_t profile = 0; profile < _profile_count; ++profile) {
+    if(strncmp(_profiles[profile].ssid, ssid, WIFI_PROFILE_VAL_MAX) != 0) {
+      continue;
+    }
+    WiFiCandidate* candidate = nullptr;
+    for(uint8_t i = 0; i < _count; ++i) {
+      if(_candidates[i].profile == profile) {
+        candidate = &_candidates[i];
+        break;
+      }
+    }
+    if(!candidate) {
+      candidate = &_candidates[_count++];
+      candidate->profile = profile;
+    } else if(candidate->rssi >= rssi) {
+      return;
+    }
+    candidate->rssi = rssi;
+    candidate->channel = channel;
+    memcpy(candidate->bssid, bssid, sizeof(candidate->bssid));
+    return;
+  }
+}
+
+uint8_t WiFiRanking::rank() {
+  // Insertion sort, there are only a few
+  for(uint8_t i = 1; i < _count; ++i) {
+    WiFiCandidate candidate = _candidates[i];
+    uint8_t j = i;
+    for(; j > 0 && better(candidate, _candidates[j - 1], _profiles); --j) {
+      _candidates[j] = _candidates[j - 1];
+    }
+    _candidates[j] = candidate;
+  }
+  return _count;
+}
+
+uint8_t WiFiRanking::get_count() const {
+  return _count;
+}
+
+const WiFiCandidate& WiFiRanking::get(uint8_t index) const {
+  return _candidates[index];
+}
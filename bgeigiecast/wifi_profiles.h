@@ -0,0 +1,69 @@
+#ifndef BGEIGIECAST_WIFI_PROFILES_H
+#define BGEIGIECAST_WIFI_PROFILES_H
+
+#include <stdint.h>
+
+#define WIFI_PROFILE_COUNT 4 // Networks that can be stored, part of the stored config layout
+#define WIFI_PROFILE_VAL_MAX 32 // Same as CONFIG_VAL_MAX
+#define WIFI_PRIORITY_MAX 9
+
+#ifndef WIFI_MIN_RSSI
+#define WIFI_MIN_RSSI (-85) // Weaker networks are only tried after all networks with a usable signal
+#endif
+
+/**
+ * A network to connect to, the first profile is the WiFi network of the connection settings
+ */
+struct __attribute__((packed)) WiFiProfile {
+  char ssid[WIFI_PROFILE_VAL_MAX]; // empty if not used
+  char password[WIFI_PROFILE_VAL_MAX];
+  uint8_t priority; // 0 - WIFI_PRIORITY_MAX, higher is preferred over a stronger signal
+};
+
+/**
+ * Access point of a stored network found in a scan
+ */
+struct WiFiCandidate {
+  uint8_t profile;
+  int8_t rssi;
+  uint8_t channel;
+  uint8_t bssid[6];
+};
+
+/**
+ * Ranks the stored networks found in a scan. Per network the access point with the strongest signal is kept, the
+ * networks with a usable signal (WIFI_MIN_RSSI) are ranked by priority and then by signal.
+ */
+class WiFiRanking {
+ public:
+  WiFiRanking(const WiFiProfile* profiles, uint8_t profile_count);
+  virtual ~WiFiRanking() = default;
+
+  /**
+   * Start a new ranking
+   */
+  void clear();
+
+  /**
+   * Add a network of the scan, ignored if it is not stored
+   */
+  void add(const char* ssid, int8_t rssi, uint8_t channel, const uint8_t* bssid);
+
+  /**
+   * Sort the candidates, best first
+   * @return amount of candidates
+   */
+  uint8_t rank();
+
+  uint8_t get_count() const;
+
+  const WiFiCandidate& get(uint8_t index) const;
+
+ private:
+  const WiFiProfile* _profiles;
+  uint8_t _profile_count;
+  WiFiCandidate _candidates[WIFI_PROFILE_COUNT];
+  uint8_t _count;
+};
+
+#endif //BGEIGIECAST_WIFI_PROFILES_H
@@ -0,0 +1,150 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <HTTPClient.h>
+#include <atomic>
+
+#include <configuration_server.h>
+#include <http_pages.h>
+#include <wifi_connection.h>
+
+#define TEST_SERVER "http://127.0.0.1"
+#define TEST_REQUESTS_PER_CLIENT 20
+#define TEST_CLIENT_STACK_SIZE 8192
+#define TEST_TIMEOUT_MILLIS 60000
+// Longest keys, a torn copy would mix both
+#define TEST_API_KEY_A "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+#define TEST_API_KEY_B "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb"
+
+// Pages of ConfigWebServer::add_urls which render the settings
+static const char* const settings_pages[] = {"/", "/device", "/connection", "/location", "/status", "/api/status"};
+
+/**
+ * Server with access to the activate / deactivate functions
+ */
+class TestConfigWebServer : public ConfigWebServer {
+ public:
+  explicit TestConfigWebServer(LocalStorage& config) : ConfigWebServer(config) {}
+  using ConfigWebServer::activate;
+  using ConfigWebServer::deactivate;
+};
+
+static std::atomic<int> running(0);
+static std::atomic<int> failures(0);
+static std::atomic<int> torn(0);
+
+static int post_save(HTTPClient& http, const char* form) {
+  http.begin(TEST_SERVER "/save");
+  http.addHeader("Content-Type", "application/x-www-form-urlencoded");
+  int code = http.POST(reinterpret_cast<uint8_t*>(const_cast<char*>(form)), strlen(form));
+  http.end();
+  return code;
+}
+
+/**
+ * Requests the settings pages, the connection page must show one of the api keys completely
+ */
+static void reader_task(void* index_arg) {
+  auto index = reinterpret_cast<uintptr_t>(index_arg);
+  HTTPClient http;
+  for(uint8_t i = 0; i < TEST_REQUESTS_PER_CLIENT; ++i) {
+    const char* page = settings_pages[(index + i) % (sizeof(settings_pages) / sizeof(settings_pages[0]))];
+    http.begin(String(TEST_SERVER) + page);
+    if(http.GET() != 200) {
+      ++failures;
+    } else if(strcmp(page, "/connection") == 0) {
+      String body = http.getString();
+      if(body.indexOf(TEST_API_KEY_A) < 0 && body.indexOf(TEST_API_KEY_B) < 0) {
+        ++torn;
+      }
+    }
+    http.end();
+  }
+  --running;
+  vTaskDelete(nullptr);
+}
+
+/**
+ * Saves the api keys in turns
+ */
+static void saver_task(void*) {
+  HTTPClient http;
+  char form[64];
+  for(uint8_t i = 0; i < TEST_REQUESTS_PER_CLIENT; ++i) {
+    snprintf(form, sizeof(form), "%s=%s&next=/connection", FORM_NAME_API_KEY, i % 2 ? TEST_API_KEY_A : TEST_API_KEY_B);
+    if(post_save(http, form) != 302) {
+      ++failures;
+    }
+  }
+  --running;
+  vTaskDelete(nullptr);
+}
+
+static void start_server(LocalStorage& config, TestConfigWebServer& server) {
+  config.set_device_id(1234, false);
+  config.set_api_key(TEST_API_KEY_A, false);
+  TEST_ASSERT_TRUE(WiFiConnection::start_ap_server("bgeigie1234", "testpassword"));
+  TEST_ASSERT_TRUE(server.activate(false));
+}
+
+static void stop_server(TestConfigWebServer& server) {
+  server.deactivate();
+  WiFiConnection::stop_ap_server();
+}
+
+/**
+ * Test every route of the config server answers, the settings are not committed so nothing is written to the flash
+ */
+void test_config_server_routes(void) {
+  LocalStorage config;
+  TestConfigWebServer server(config);
+  start_server(config, server);
+
+  HTTPClient http;
+  for(const auto page : settings_pages) {
+    http.begin(String(TEST_SERVER) + page);
+    TEST_ASSERT_EQUAL_MESSAGE(200, http.GET(), page);
+    http.end();
+  }
+  http.begin(TEST_SERVER "/update");
+  TEST_ASSERT_EQUAL(200, http.GET());
+  http.end();
+  // No trace passed to the server
+  http.begin(TEST_SERVER "/trace");
+  TEST_ASSERT_EQUAL(404, http.GET());
+  http.end();
+
+  TEST_ASSERT_EQUAL(302, post_save(http, FORM_NAME_API_KEY "=" TEST_API_KEY_B "&next=/connection"));
+  TEST_ASSERT_EQUAL_STRING(TEST_API_KEY_B, config.get_api_key());
+
+  stop_server(server);
+}
+
+/**
+ * Test pages rendered while another server task saves show complete settings
+ */
+void test_config_server_concurrent_saves(void) {
+  LocalStorage config;
+  TestConfigWebServer server(config);
+  start_server(config, server);
+  failures = 0;
+  torn = 0;
+
+  // One connection per server task, more would be refused as busy
+  running = HTTP_SERVER_WORKERS;
+  xTaskCreate(saver_task, "Saver", TEST_CLIENT_STACK_SIZE, nullptr, 1, nullptr);
+  for(uintptr_t i = 0; i < HTTP_SERVER_WORKERS - 1; ++i) {
+    xTaskCreate(reader_task, "Reader", TEST_CLIENT_STACK_SIZE, reinterpret_cast<void*>(i), 1, nullptr);
+  }
+  uint32_t start = millis();
+  while(running > 0 && millis() - start < TEST_TIMEOUT_MILLIS) {
+    delay(10);
+  }
+
+  TEST_ASSERT_EQUAL(0, running.load());
+  TEST_ASSERT_EQUAL(0, failures.load());
+  TEST_ASSERT_EQUAL(0, torn.load());
+  // The last save (odd) wins
+  TEST_ASSERT_EQUAL_STRING(TEST_API_KEY_A, config.get_api_key());
+
+  stop_server(server);
+}
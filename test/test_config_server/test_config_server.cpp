@@ -0,0 +1,19 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void test_config_server_routes();
+void test_config_server_concurrent_saves();
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_config_server_routes);
+  RUN_TEST(test_config_server_concurrent_saves);
+
+  UNITY_END();
+}
+
+void loop() {
+}
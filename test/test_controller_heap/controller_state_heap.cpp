@@ -0,0 +1,83 @@
+#include <Arduino.h>
+#include <unity.h>
+#include <controller.h>
+#include <identifiers.h>
+
+/**
+ * Handler which does nothing, so the states can (de)activate it
+ */
+class NoopHandler : public Handler {
+ public:
+  explicit NoopHandler(uint8_t id) : Handler(id) {}
+ protected:
+  int8_t handle_produced_work(const worker_status_t&) override {
+    return HandlerStatus::e_handler_idle;
+  }
+};
+
+/**
+ * Worker which does nothing, so the states can (de)activate it
+ */
+class NoopWorker : public Worker<bool> {
+ public:
+  explicit NoopWorker(uint8_t id) : Worker<bool>(id, false) {}
+ protected:
+  int8_t produce_data() override {
+    return WorkerStatus::e_worker_idle;
+  }
+};
+
+/**
+ * Storage which keeps the saved state in memory, every toggle saves the state and this test should not wear the flash
+ */
+class MemoryLocalStorage : public LocalStorage {
+ public:
+  void set_saved_state(uint8_t saved_state, bool force) override {
+    ++saves;
+  }
+
+  uint32_t saves = 0;
+};
+
+/**
+ * Test controller state transitions do not use the heap: Init -> Mobile <-> Fixed (10,000 times)
+ */
+void controller_state_transitions_no_heap(void) {
+  MemoryLocalStorage config;
+  Controller controller(config);
+  NoopHandler bluetooth(k_handler_bluetooth_reporter);
+  NoopHandler api(k_handler_api_reporter);
+  NoopHandler ota(k_handler_ota_puller);
+  NoopWorker server(k_worker_configuration_server);
+  NoopWorker bluetooth_transfer(k_worker_bluetooth_transfer);
+  controller.register_handler(bluetooth, false);
+  controller.register_handler(api, false);
+  controller.register_handler(ota, false);
+  controller.register_worker(server, false);
+  controller.register_worker(bluetooth_transfer, false);
+
+  controller.setup_state_machine();
+  controller.schedule_event(Event_enum::e_c_controller_initialized);
+  controller.handle_events();
+  controller.schedule_event(Event_enum::e_c_reading_initialized);
+  controller.handle_events();
+  controller.schedule_event(Event_enum::e_c_post_init_time_passed);
+  controller.handle_events();
+  TEST_ASSERT_EQUAL(ControllerState::k_state_MobileModeState, controller.get_current_state()->get_state_id());
+
+  State* mobile_state = controller.get_current_state();
+  uint32_t free_heap = ESP.getFreeHeap();
+
+  for(uint16_t i = 0; i < 10000; ++i) {
+    controller.schedule_event(Event_enum::e_c_button_pressed);
+    controller.handle_events();
+  }
+
+  // Even amount of toggles, back in the same (preallocated) mobile state
+  TEST_ASSERT_EQUAL(ControllerState::k_state_MobileModeState, controller.get_current_state()->get_state_id());
+  TEST_ASSERT_EQUAL_PTR(mobile_state, controller.get_current_state());
+  TEST_ASSERT_EQUAL(free_heap, ESP.getFreeHeap());
+  // Initial mobile state and every toggle saved the state, nothing left to write to the flash
+  TEST_ASSERT_EQUAL(10001, config.saves);
+  TEST_ASSERT_FALSE(config.is_dirty());
+}
@@ -0,0 +1,17 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void controller_state_transitions_no_heap(void);
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(controller_state_transitions_no_heap);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,79 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <HandlerScheduler.hpp>
+
+/**
+ * Handler that records the order in which it was called
+ */
+class OrderHandler : public Handler {
+ public:
+  OrderHandler(uint8_t id, Priority priority, uint32_t duration, uint32_t deadline, uint8_t*& order) :
+      Handler(id, 0, priority, deadline), duration(duration), order(order) {}
+
+ protected:
+  int8_t handle_produced_work(const worker_status_t&) override {
+    *order++ = get_handler_id();
+    delay(duration);
+    return HandlerStatus::e_handler_data_handled;
+  }
+
+ private:
+  uint32_t duration;
+  uint8_t*& order;
+};
+
+/**
+ * Test handler dispatch order, deadline misses and deferring when the cycle budget is used up
+ */
+void test_handler_scheduler() {
+  uint8_t called[8] = {0};
+  uint8_t* order = called;
+  worker_status_t worker_reports;
+  handler_status_t handler_stats;
+
+  OrderHandler low(0, Handler::e_priority_low, 0, 0, order);
+  OrderHandler normal(1, Handler::e_priority_normal, 30, 0, order);
+  OrderHandler high(2, Handler::e_priority_high, 0, 10, order);
+
+  HandlerScheduler scheduler;
+  scheduler.add(low);
+  scheduler.add(normal);
+  scheduler.add(high);
+  for(uint8_t i = 0; i < 3; ++i) {
+    handler_stats[i] = HandlerStatus();
+    handler_stats[i].active_state = HandlerStatus::e_state_active;
+  }
+
+  // No budget, all run in order of priority
+  scheduler.dispatch(handler_stats, worker_reports, millis());
+  TEST_ASSERT_EQUAL(3, order - called);
+  TEST_ASSERT_EQUAL(2, called[0]);
+  TEST_ASSERT_EQUAL(1, called[1]);
+  TEST_ASSERT_EQUAL(0, called[2]);
+  TEST_ASSERT_FALSE(scheduler.has_deferred());
+  TEST_ASSERT_EQUAL(0, handler_stats[2].deadline_misses);
+
+  // Work produced long ago, high priority handler misses its deadline
+  order = called;
+  scheduler.set_cycle_budget(20);
+  scheduler.dispatch(handler_stats, worker_reports, millis() - 15);
+  TEST_ASSERT_EQUAL(1, handler_stats[2].deadline_misses);
+
+  // Normal handler used up the budget, low priority is deferred
+  TEST_ASSERT_EQUAL(2, order - called);
+  TEST_ASSERT_TRUE(scheduler.has_deferred());
+  TEST_ASSERT_EQUAL(1, handler_stats[0].deferred);
+
+  scheduler.run_deferred(handler_stats, worker_reports);
+  TEST_ASSERT_EQUAL(3, order - called);
+  TEST_ASSERT_EQUAL(0, called[2]);
+  TEST_ASSERT_FALSE(scheduler.has_deferred());
+
+  // Removed handlers are not dispatched
+  order = called;
+  scheduler.set_cycle_budget(0);
+  scheduler.remove(normal);
+  scheduler.dispatch(handler_stats, worker_reports, millis());
+  TEST_ASSERT_EQUAL(2, order - called);
+}
@@ -0,0 +1,17 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void test_handler_scheduler();
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_handler_scheduler);
+
+  UNITY_END();
+}
+
+void loop() {
+}
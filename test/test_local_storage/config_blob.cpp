@@ -0,0 +1,179 @@
+#include <unity.h>
+#include <Preferences.h>
+#include <local_storage.h>
+#include <user_config.h>
+#include <controller.h>
+
+/**
+ * LocalStorage with access to the activate function
+ */
+class BlobTestLocalStorage : public LocalStorage {
+ public:
+  using LocalStorage::activate;
+};
+
+#define TEST_BLOB_HEADER_SIZE 8 // crc (4), version (2), size (2)
+#define TEST_BLOB_V1_SIZE 167 // values until last_latitude, before update_url
+
+/**
+ * CRC-32 (IEEE 802.3), as the stored config
+ */
+static uint32_t test_crc(const uint8_t* data, size_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for(size_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for(uint8_t bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+  }
+  return ~crc;
+}
+
+/**
+ * Test migrating every value from the old layout with a key per value (as written by the previous firmware) to the
+ * config blob
+ */
+void test_config_blob_migration(void) {
+  Preferences memory;
+  memory.begin("data");
+  memory.clear();
+  memory.putUShort("ap_ssid", 1234);
+  memory.putString("ap_password", "old ap password");
+  memory.putString("wifi_ssid", "old ssid");
+  memory.putString("wifi_password", "old password");
+  memory.putString("api_key", "old api key");
+  memory.putBool("use_dev", !D_USE_DEV_SERVER);
+  // The previous firmware wrote both the led color blind and the use home location setting to this key
+  memory.putBool("led_color_blind", true);
+  memory.putUChar("led_intensity", 42);
+  memory.putChar("saved_state", Controller::k_savable_FixedMode);
+  memory.putDouble("home_longtitude", 139.7);
+  memory.putDouble("home_latitude", 35.6);
+  memory.putDouble("last_longtitude", -70.5);
+  memory.putDouble("last_latitude", 12.5);
+  memory.end();
+
+  BlobTestLocalStorage config;
+  config.activate(false);
+  TEST_ASSERT_EQUAL(LocalStorage::e_config_migrated, config.get_load_status());
+  TEST_ASSERT_EQUAL(1234, config.get_device_id());
+  TEST_ASSERT_EQUAL_STRING("old ap password", config.get_ap_password());
+  TEST_ASSERT_EQUAL_STRING("old ssid", config.get_wifi_ssid());
+  TEST_ASSERT_EQUAL_STRING("old password", config.get_wifi_password());
+  TEST_ASSERT_EQUAL_STRING("old api key", config.get_api_key());
+  TEST_ASSERT_EQUAL(!D_USE_DEV_SERVER, config.get_use_dev());
+  TEST_ASSERT_TRUE(config.is_led_color_blind());
+  TEST_ASSERT_EQUAL(42, config.get_led_color_intensity());
+  TEST_ASSERT_EQUAL(Controller::k_savable_FixedMode, config.get_saved_state());
+  TEST_ASSERT_TRUE(config.get_use_home_location());
+  TEST_ASSERT_EQUAL_FLOAT(139.7, config.get_home_longitude());
+  TEST_ASSERT_EQUAL_FLOAT(35.6, config.get_home_latitude());
+  TEST_ASSERT_EQUAL_FLOAT(-70.5, config.get_last_longitude());
+  TEST_ASSERT_EQUAL_FLOAT(12.5, config.get_last_latitude());
+  // Not in the old layout
+  TEST_ASSERT_EQUAL_STRING(D_UPDATE_URL, config.get_update_url());
+  TEST_ASSERT_EQUAL_STRING("", config.get_wifi_profiles()[1].ssid);
+
+  // Old keys are removed
+  memory.begin("data", true);
+  TEST_ASSERT_FALSE(memory.isKey("wifi_ssid"));
+  TEST_ASSERT_FALSE(memory.isKey("led_color_blind"));
+  TEST_ASSERT_TRUE(memory.isKey("config"));
+  memory.end();
+
+  // Next boot loads the blob
+  BlobTestLocalStorage loaded;
+  loaded.activate(false);
+  TEST_ASSERT_EQUAL(LocalStorage::e_config_loaded, loaded.get_load_status());
+  TEST_ASSERT_EQUAL(1234, loaded.get_device_id());
+  TEST_ASSERT_EQUAL_STRING("old ap password", loaded.get_ap_password());
+  TEST_ASSERT_EQUAL_STRING("old ssid", loaded.get_wifi_ssid());
+  TEST_ASSERT_EQUAL_STRING("old password", loaded.get_wifi_password());
+  TEST_ASSERT_EQUAL_STRING("old api key", loaded.get_api_key());
+  TEST_ASSERT_EQUAL(!D_USE_DEV_SERVER, loaded.get_use_dev());
+  TEST_ASSERT_TRUE(loaded.is_led_color_blind());
+  TEST_ASSERT_EQUAL(42, loaded.get_led_color_intensity());
+  TEST_ASSERT_EQUAL(Controller::k_savable_FixedMode, loaded.get_saved_state());
+  TEST_ASSERT_TRUE(loaded.get_use_home_location());
+  TEST_ASSERT_EQUAL_FLOAT(139.7, loaded.get_home_longitude());
+  TEST_ASSERT_EQUAL_FLOAT(35.6, loaded.get_home_latitude());
+  TEST_ASSERT_EQUAL_FLOAT(-70.5, loaded.get_last_longitude());
+  TEST_ASSERT_EQUAL_FLOAT(12.5, loaded.get_last_latitude());
+
+  loaded.reset_defaults();
+}
+
+/**
+ * Test a blob of an older version keeps its values and gets defaults for the values added later
+ */
+void test_config_blob_upgrade(void) {
+  BlobTestLocalStorage config;
+  config.activate(false);
+  config.set_api_key("kept api key", false);
+  config.set_last_latitude(7.25, false);
+  config.set_update_url("http://example.com/manifest.txt", false);
+  TEST_ASSERT_TRUE(config.commit());
+
+  // Rewrite the blob as version 1, which ended before the update url
+  Preferences memory;
+  memory.begin("data");
+  uint8_t blob[CONFIG_BLOB_MAX_SIZE];
+  size_t length = memory.getBytes("config", blob, sizeof(blob));
+  TEST_ASSERT_GREATER_THAN(TEST_BLOB_HEADER_SIZE + TEST_BLOB_V1_SIZE, length);
+  uint32_t crc = test_crc(blob + TEST_BLOB_HEADER_SIZE, TEST_BLOB_V1_SIZE);
+  uint16_t version = 1;
+  uint16_t size = TEST_BLOB_V1_SIZE;
+  memcpy(blob, &crc, sizeof(crc));
+  memcpy(blob + 4, &version, sizeof(version));
+  memcpy(blob + 6, &size, sizeof(size));
+  memory.putBytes("config", blob, TEST_BLOB_HEADER_SIZE + TEST_BLOB_V1_SIZE);
+  memory.end();
+
+  BlobTestLocalStorage upgraded;
+  upgraded.activate(false);
+  TEST_ASSERT_EQUAL(LocalStorage::e_config_upgraded, upgraded.get_load_status());
+  TEST_ASSERT_EQUAL_STRING("kept api key", upgraded.get_api_key());
+  TEST_ASSERT_EQUAL_FLOAT(7.25, upgraded.get_last_latitude());
+  TEST_ASSERT_EQUAL_STRING(D_UPDATE_URL, upgraded.get_update_url());
+  // Written again as the current version
+  TEST_ASSERT_FALSE(upgraded.is_dirty());
+  BlobTestLocalStorage loaded;
+  loaded.activate(false);
+  TEST_ASSERT_EQUAL(LocalStorage::e_config_loaded, loaded.get_load_status());
+
+  loaded.reset_defaults();
+}
+
+/**
+ * Test a corrupted config blob is detected and replaced with defaults
+ */
+void test_config_blob_corrupted(void) {
+  BlobTestLocalStorage config;
+  config.activate(false);
+  config.set_wifi_ssid("valid ssid", false);
+  TEST_ASSERT_TRUE(config.commit());
+
+  // Flip a byte in the stored blob
+  Preferences memory;
+  memory.begin("data");
+  uint8_t blob[CONFIG_BLOB_MAX_SIZE];
+  size_t length = memory.getBytes("config", blob, sizeof(blob));
+  TEST_ASSERT_GREATER_THAN(20, length);
+  blob[20] ^= 0xFF;
+  memory.putBytes("config", blob, length);
+  memory.end();
+
+  BlobTestLocalStorage corrupted;
+  corrupted.activate(false);
+  TEST_ASSERT_EQUAL(LocalStorage::e_config_corrupted, corrupted.get_load_status());
+  TEST_ASSERT_EQUAL_STRING(D_WIFI_SSID, corrupted.get_wifi_ssid());
+  TEST_ASSERT_TRUE(corrupted.is_dirty());
+
+  // Valid config is written again
+  TEST_ASSERT_TRUE(corrupted.commit());
+  BlobTestLocalStorage loaded;
+  loaded.activate(false);
+  TEST_ASSERT_EQUAL(LocalStorage::e_config_loaded, loaded.get_load_status());
+
+  loaded.reset_defaults();
+}
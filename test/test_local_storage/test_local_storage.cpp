@@ -0,0 +1,26 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void test_write_back_config(void);
+void test_write_back_wifi_profiles(void);
+void test_config_blob_migration(void);
+void test_config_blob_upgrade(void);
+void test_config_blob_corrupted(void);
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_write_back_config);
+  RUN_TEST(test_write_back_wifi_profiles);
+
+  RUN_TEST(test_config_blob_migration);
+  RUN_TEST(test_config_blob_upgrade);
+  RUN_TEST(test_config_blob_corrupted);
+
+  UNITY_END();
+}
+
+void loop() {
+}
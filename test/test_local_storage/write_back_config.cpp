@@ -0,0 +1,98 @@
+#include <unity.h>
+#include <local_storage.h>
+#include <user_config.h>
+#include <identifiers.h>
+
+/**
+ * LocalStorage with access to the activate / handle functions
+ */
+class TestLocalStorage : public LocalStorage {
+ public:
+  using LocalStorage::activate;
+  using LocalStorage::handle_produced_work;
+};
+
+/**
+ * Test setters only write to the flash on commit, with all changes at once
+ */
+void test_write_back_config(void) {
+  TestLocalStorage config;
+  config.activate(false);
+  config.reset_defaults();
+  TEST_ASSERT_FALSE(config.is_dirty());
+  auto commits = config.get_metrics().commits;
+  auto keys_written = config.get_metrics().keys_written;
+
+  // Same value, nothing to write
+  config.set_wifi_ssid(D_WIFI_SSID, false);
+  TEST_ASSERT_FALSE(config.is_dirty());
+  TEST_ASSERT_EQUAL(1, config.get_metrics().unchanged);
+
+  // Values are changed, but not written yet
+  config.set_wifi_ssid("some ssid", false);
+  config.set_wifi_password("some password", false);
+  config.set_last_latitude(1.0, false);
+  config.set_last_latitude(2.0, false);
+  TEST_ASSERT_TRUE(config.is_dirty());
+  TEST_ASSERT_EQUAL_STRING("some ssid", config.get_wifi_ssid());
+  TEST_ASSERT_EQUAL(1, config.get_metrics().coalesced);
+  TEST_ASSERT_EQUAL(commits, config.get_metrics().commits);
+
+  // Single commit for all changed values
+  TEST_ASSERT_TRUE(config.commit());
+  TEST_ASSERT_FALSE(config.is_dirty());
+  TEST_ASSERT_EQUAL(commits + 1, config.get_metrics().commits);
+  TEST_ASSERT_EQUAL(keys_written + 3, config.get_metrics().keys_written);
+
+  // Committed values are loaded again
+  TestLocalStorage loaded;
+  loaded.activate(false);
+  TEST_ASSERT_EQUAL_STRING("some ssid", loaded.get_wifi_ssid());
+  TEST_ASSERT_EQUAL_STRING("some password", loaded.get_wifi_password());
+  TEST_ASSERT_EQUAL_FLOAT(2.0, loaded.get_last_latitude());
+
+  // Last location is only committed on interval by the handler, settings on the next cycle
+  worker_status_t worker_reports;
+  worker_reports[k_worker_bgeigie_connector] = WorkerStatus();
+  config.set_last_longitude(3.0, false);
+  config.handle_produced_work(worker_reports);
+  TEST_ASSERT_TRUE(config.is_dirty());
+  config.set_led_color_intensity(D_LED_COLOR_INTENSITY + 1, false);
+  config.handle_produced_work(worker_reports);
+  TEST_ASSERT_FALSE(config.is_dirty());
+
+  config.reset_defaults();
+}
+
+/**
+ * Test the stored networks are written with the config
+ */
+void test_write_back_wifi_profiles(void) {
+  TestLocalStorage config;
+  config.activate(false);
+  config.reset_defaults();
+  TEST_ASSERT_EQUAL_STRING("", config.get_wifi_profiles()[1].ssid);
+
+  // First network is the wifi ssid / password setting
+  config.set_wifi_profile(0, "first ssid", "first password", 3, false);
+  config.set_wifi_profile(2, "third ssid", "third password", WIFI_PRIORITY_MAX + 1, false);
+  TEST_ASSERT_EQUAL_STRING("first ssid", config.get_wifi_ssid());
+  TEST_ASSERT_EQUAL(WIFI_PRIORITY_MAX, config.get_wifi_profiles()[2].priority);
+  TEST_ASSERT_TRUE(config.commit());
+
+  TestLocalStorage loaded;
+  loaded.activate(false);
+  const auto* profiles = loaded.get_wifi_profiles();
+  TEST_ASSERT_EQUAL_STRING("first ssid", profiles[0].ssid);
+  TEST_ASSERT_EQUAL_STRING("first password", profiles[0].password);
+  TEST_ASSERT_EQUAL(3, profiles[0].priority);
+  TEST_ASSERT_EQUAL_STRING("", profiles[1].ssid);
+  TEST_ASSERT_EQUAL_STRING("third ssid", profiles[2].ssid);
+  TEST_ASSERT_EQUAL_STRING("third password", profiles[2].password);
+
+  // Same values, nothing to write
+  loaded.set_wifi_profile(2, "third ssid", "third password", WIFI_PRIORITY_MAX, false);
+  TEST_ASSERT_FALSE(loaded.is_dirty());
+
+  config.reset_defaults();
+}
@@ -0,0 +1,85 @@
+#include <unity.h>
+#include <math.h>
+
+#include <ble_beacon.h>
+#include <reading.h>
+
+#define TEST_POSITION_PRECISION (0.5 / BLE_BEACON_POSITION_SCALE)
+
+void test_ble_beacon_round_trip() {
+  BleBeacon beacon{2345, 61, k_reading_parsed | k_reading_sensor_ok | k_reading_gps_ok | k_reading_valid,
+                   35.659, 139.7009, 255};
+  uint8_t data[BLE_BEACON_SIZE];
+  TEST_ASSERT_EQUAL(BLE_BEACON_SIZE, beacon.encode(data));
+
+  BleBeacon decoded{};
+  TEST_ASSERT_TRUE(BleBeacon::decode(data, sizeof(data), decoded));
+  TEST_ASSERT_EQUAL(2345, decoded.device_id);
+  TEST_ASSERT_EQUAL(61, decoded.cpm);
+  TEST_ASSERT_EQUAL(beacon.status, decoded.status);
+  TEST_ASSERT_TRUE(fabs(decoded.latitude - 35.659) < TEST_POSITION_PRECISION);
+  TEST_ASSERT_TRUE(fabs(decoded.longitude - 139.7009) < TEST_POSITION_PRECISION);
+  TEST_ASSERT_EQUAL(255, decoded.sequence);
+
+  // Southern and western hemisphere
+  beacon.latitude = -33.8688;
+  beacon.longitude = -70.6693;
+  beacon.cpm = 65535;
+  beacon.encode(data);
+  TEST_ASSERT_TRUE(BleBeacon::decode(data, sizeof(data), decoded));
+  TEST_ASSERT_TRUE(fabs(decoded.latitude + 33.8688) < TEST_POSITION_PRECISION);
+  TEST_ASSERT_TRUE(fabs(decoded.longitude + 70.6693) < TEST_POSITION_PRECISION);
+  TEST_ASSERT_EQUAL(65535, decoded.cpm);
+}
+
+void test_ble_beacon_layout() {
+  BleBeacon beacon{0x1234, 0x0102, k_reading_valid, 0.001, -0.001, 7};
+  uint8_t data[BLE_BEACON_SIZE];
+  beacon.encode(data);
+  const uint8_t expected[BLE_BEACON_SIZE] = {
+      0xFF, 0xFF, // company id
+      BLE_BEACON_VERSION,
+      0x34, 0x12, // device id
+      0x02, 0x01, // cpm
+      k_reading_valid,
+      0x01, 0x00, 0x00, // latitude 1
+      0xFF, 0xFF, 0xFF, // longitude -1
+      7,
+  };
+  for(size_t i = 0; i < BLE_BEACON_SIZE; ++i) {
+    TEST_ASSERT_EQUAL_HEX8(expected[i], data[i]);
+  }
+}
+
+void test_ble_beacon_coordinate_limits() {
+  BleBeacon beacon{1, 0, 0, 90, -180, 0};
+  uint8_t data[BLE_BEACON_SIZE];
+  BleBeacon decoded{};
+  beacon.encode(data);
+  TEST_ASSERT_TRUE(BleBeacon::decode(data, sizeof(data), decoded));
+  TEST_ASSERT_TRUE(fabs(decoded.latitude - 90) < TEST_POSITION_PRECISION);
+  TEST_ASSERT_TRUE(fabs(decoded.longitude + 180) < TEST_POSITION_PRECISION);
+
+  // Out of range values are clamped instead of wrapping around
+  beacon.latitude = 1e9;
+  beacon.longitude = -1e9;
+  beacon.encode(data);
+  TEST_ASSERT_TRUE(BleBeacon::decode(data, sizeof(data), decoded));
+  TEST_ASSERT_TRUE(decoded.latitude > 8000);
+  TEST_ASSERT_TRUE(decoded.longitude < -8000);
+}
+
+void test_ble_beacon_rejects_other_data() {
+  BleBeacon beacon{1, 2, 3, 4, 5, 6};
+  uint8_t data[BLE_BEACON_SIZE];
+  BleBeacon decoded{};
+  beacon.encode(data);
+
+  TEST_ASSERT_FALSE(BleBeacon::decode(data, BLE_BEACON_SIZE - 1, decoded));
+  data[2] = BLE_BEACON_VERSION + 1;
+  TEST_ASSERT_FALSE(BleBeacon::decode(data, sizeof(data), decoded));
+  data[2] = BLE_BEACON_VERSION;
+  data[0] = 0x4C; // Other company
+  data[1] = 0x00;
+  TEST_ASSERT_FALSE(BleBeacon::decode(data, sizeof(data), decoded));
+}
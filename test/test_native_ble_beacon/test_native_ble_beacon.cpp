@@ -0,0 +1,19 @@
+#include <unity.h>
+
+void test_ble_beacon_round_trip();
+void test_ble_beacon_layout();
+void test_ble_beacon_coordinate_limits();
+void test_ble_beacon_rejects_other_data();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ble_beacon_round_trip);
+  RUN_TEST(test_ble_beacon_layout);
+  RUN_TEST(test_ble_beacon_coordinate_limits);
+  RUN_TEST(test_ble_beacon_rejects_other_data);
+
+  // Unit test done
+  return UNITY_END();
+}
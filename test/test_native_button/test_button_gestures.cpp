@@ -0,0 +1,120 @@
+#include <unity.h>
+
+#include <button.h>
+
+/**
+ * Counts the callbacks, button is PULLUP so LOW is down
+ */
+class GestureObserver : public ButtonObserver {
+ public:
+  void on_button_pressed(Button* button, uint32_t millis_pressed) override {
+    ++pressed;
+    pressed_time = millis_pressed;
+  };
+
+  void on_button_gesture(Button* button, ButtonGesture gesture) override {
+    ++gestures[gesture];
+  };
+
+  int pressed = 0;
+  uint32_t pressed_time = 0;
+  int gestures[3] = {0, 0, 0};
+};
+
+void test_button_single_press() {
+  Button button(0, PULLUP);
+  GestureObserver observer;
+  button.set_observer(&observer);
+
+  TEST_ASSERT_TRUE(button.state_changed(LOW, 1000));
+  TEST_ASSERT_EQUAL(1000 + BUTTON_LONG_HOLD_MILLIS, button.get_gesture_deadline());
+  TEST_ASSERT_TRUE(button.state_changed(HIGH, 1200));
+  TEST_ASSERT_EQUAL(1, observer.pressed);
+  TEST_ASSERT_EQUAL(200, observer.pressed_time);
+
+  // Waits for a second press
+  TEST_ASSERT_EQUAL(1200 + BUTTON_DOUBLE_PRESS_MILLIS, button.get_gesture_deadline());
+  button.time_passed(1200 + BUTTON_DOUBLE_PRESS_MILLIS - 1);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_single]);
+  button.time_passed(1200 + BUTTON_DOUBLE_PRESS_MILLIS);
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_single]);
+  TEST_ASSERT_EQUAL(0, button.get_gesture_deadline());
+
+  // Fires once
+  button.time_passed(5000);
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_single]);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_double]);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_long_hold]);
+}
+
+void test_button_double_press() {
+  Button button(0, PULLUP);
+  GestureObserver observer;
+  button.set_observer(&observer);
+
+  button.state_changed(LOW, 1000);
+  button.state_changed(HIGH, 1100);
+  button.state_changed(LOW, 1250);
+  // Fires on the second press
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_double]);
+  TEST_ASSERT_EQUAL(0, button.get_gesture_deadline());
+  button.state_changed(HIGH, 1350);
+  TEST_ASSERT_EQUAL(0, button.get_gesture_deadline());
+
+  button.time_passed(10000);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_single]);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_long_hold]);
+  TEST_ASSERT_EQUAL(2, observer.pressed);
+
+  // Second press too late, two single presses
+  button.state_changed(LOW, 20000);
+  button.state_changed(HIGH, 20100);
+  button.time_passed(20100 + BUTTON_DOUBLE_PRESS_MILLIS);
+  button.state_changed(LOW, 20500);
+  button.state_changed(HIGH, 20600);
+  button.time_passed(20600 + BUTTON_DOUBLE_PRESS_MILLIS);
+  TEST_ASSERT_EQUAL(2, observer.gestures[e_gesture_single]);
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_double]);
+}
+
+void test_button_long_hold() {
+  Button button(0, PULLUP);
+  GestureObserver observer;
+  button.set_observer(&observer);
+
+  button.state_changed(LOW, 1000);
+  // Fires while still held down
+  button.time_passed(1000 + BUTTON_LONG_HOLD_MILLIS - 1);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_long_hold]);
+  button.time_passed(1000 + BUTTON_LONG_HOLD_MILLIS);
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_long_hold]);
+  TEST_ASSERT_TRUE(button.currently_pressed());
+
+  // The release after it is no gesture
+  button.state_changed(HIGH, 8000);
+  TEST_ASSERT_EQUAL(0, button.get_gesture_deadline());
+  button.time_passed(10000);
+  TEST_ASSERT_EQUAL(0, observer.gestures[e_gesture_single]);
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_long_hold]);
+  TEST_ASSERT_EQUAL(1, observer.pressed);
+  TEST_ASSERT_EQUAL(7000, observer.pressed_time);
+
+  // Time wrapping around
+  button.state_changed(LOW, 0xFFFFFF00);
+  button.time_passed(0xFFFFFF10);
+  TEST_ASSERT_EQUAL(1, observer.gestures[e_gesture_long_hold]);
+  button.time_passed(0xFFFFFF00 + BUTTON_LONG_HOLD_MILLIS);
+  TEST_ASSERT_EQUAL(2, observer.gestures[e_gesture_long_hold]);
+}
+
+void test_button_bounce() {
+  Button button(0, PULLUP);
+  GestureObserver observer;
+  button.set_observer(&observer);
+
+  TEST_ASSERT_TRUE(button.state_changed(LOW, 1000));
+  // Same state or within the debounce time is ignored
+  TEST_ASSERT_FALSE(button.state_changed(LOW, 1100));
+  TEST_ASSERT_FALSE(button.state_changed(HIGH, 1000 + BUTTON_DEBOUNCE_TIME_MILLIS - 1));
+  TEST_ASSERT_EQUAL(0, observer.pressed);
+}
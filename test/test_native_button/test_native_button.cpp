@@ -0,0 +1,19 @@
+#include <unity.h>
+
+void test_button_single_press();
+void test_button_double_press();
+void test_button_long_hold();
+void test_button_bounce();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_button_single_press);
+  RUN_TEST(test_button_double_press);
+  RUN_TEST(test_button_long_hold);
+  RUN_TEST(test_button_bounce);
+
+  // Unit test done
+  return UNITY_END();
+}
@@ -0,0 +1,78 @@
+#include <unity.h>
+#include <thread>
+
+#include <event_queue.h>
+
+/**
+ * Test event queue, items are never overwritten and overflows are counted
+ */
+void test_event_queue() {
+  const uint16_t QUEUE_SIZE = 8;
+  EventQueue<int, QUEUE_SIZE> queue;
+  int val = -1;
+  uint32_t timestamp = 0;
+
+  TEST_ASSERT_TRUE(queue.empty());
+  TEST_ASSERT_FALSE(queue.get(val, timestamp));
+
+  // Fill queue
+  for(int i = 0; i < QUEUE_SIZE; ++i) {
+    TEST_ASSERT_TRUE(queue.add(i, 100 + i));
+  }
+
+  // Full queue drops new items
+  TEST_ASSERT_FALSE(queue.add(42, 0));
+  TEST_ASSERT_FALSE(queue.add(43, 0));
+  TEST_ASSERT_EQUAL(2, queue.get_overflows());
+
+  for(int i = 0; i < QUEUE_SIZE; ++i) {
+    TEST_ASSERT_TRUE(queue.get(val, timestamp));
+    TEST_ASSERT_EQUAL(i, val);
+    TEST_ASSERT_EQUAL(100 + i, timestamp);
+  }
+  TEST_ASSERT_TRUE(queue.empty());
+
+  // Wrapping around
+  for(int i = 0; i < QUEUE_SIZE * 3; ++i) {
+    TEST_ASSERT_TRUE(queue.add(i, i));
+    TEST_ASSERT_TRUE(queue.get(val, timestamp));
+    TEST_ASSERT_EQUAL(i, val);
+  }
+
+  queue.add(1, 0);
+  queue.clear();
+  TEST_ASSERT_TRUE(queue.empty());
+}
+
+static EventQueue<uint32_t, 256> concurrent_queue;
+static const uint32_t ITEMS_PER_PRODUCER = 100;
+
+static void event_queue_producer(uint32_t offset) {
+  for(uint32_t i = 0; i < ITEMS_PER_PRODUCER; ++i) {
+    concurrent_queue.add(offset + i, i);
+  }
+}
+
+/**
+ * Test event queue with concurrent producers, no items lost or duplicated
+ */
+void test_event_queue_concurrent() {
+  std::thread producer0(event_queue_producer, 0);
+  std::thread producer1(event_queue_producer, 1000);
+  producer0.join();
+  producer1.join();
+
+  uint32_t next[2] = {0, 1000};
+  uint32_t val;
+  uint32_t timestamp;
+  uint32_t count = 0;
+  while(concurrent_queue.get(val, timestamp)) {
+    // Items of the same producer keep their order
+    uint8_t producer = val < 1000 ? 0 : 1;
+    TEST_ASSERT_EQUAL(next[producer], val);
+    ++next[producer];
+    ++count;
+  }
+  TEST_ASSERT_EQUAL(ITEMS_PER_PRODUCER * 2, count);
+  TEST_ASSERT_EQUAL(0, concurrent_queue.get_overflows());
+}
@@ -0,0 +1,15 @@
+#include <unity.h>
+
+void test_event_queue();
+void test_event_queue_concurrent();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_event_queue);
+  RUN_TEST(test_event_queue_concurrent);
+
+  // Unit test done
+  return UNITY_END();
+}
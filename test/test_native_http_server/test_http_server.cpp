@@ -0,0 +1,247 @@
+#include <unity.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <http_server.h>
+
+#define TEST_PORT 8088
+#define TEST_HANDLER_DELAY_MILLIS 200
+
+// Routes of the test server, the routes of ConfigWebServer::add_urls are requested on the device (test_config_server)
+static const char* test_pages[] = {
+    "/", "/device", "/connection", "/location", "/update", "/status", "/api/status", "/trace",
+};
+
+static std::atomic<int> handler_delay(0);
+
+/**
+ * Send a raw request to the test server
+ * @return the complete response, "" if the connection failed
+ */
+static std::string http_request(const std::string& request) {
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(TEST_PORT);
+  address.sin_addr.s_addr = inet_addr("127.0.0.1");
+  if(connect(sock, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+    close(sock);
+    return "";
+  }
+  send(sock, request.data(), request.size(), 0);
+
+  std::string response;
+  char buffer[512];
+  ssize_t received;
+  while((received = recv(sock, buffer, sizeof(buffer), 0)) > 0) {
+    response.append(buffer, received);
+  }
+  close(sock);
+  return response;
+}
+
+static std::string http_get(const char* path) {
+  return http_request(std::string("GET ") + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n");
+}
+
+static int status_code(const std::string& response) {
+  return response.size() > 12 ? atoi(response.c_str() + 9) : 0;
+}
+
+static std::string body_of(const std::string& response) {
+  auto start = response.find("\r\n\r\n");
+  return start == std::string::npos ? "" : response.substr(start + 4);
+}
+
+static void add_test_routes(HttpServer& server) {
+  auto handler = [](HttpRequest& request, HttpResponse& response) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(handler_delay.load()));
+    response.send(200, "text/plain", request.path());
+  };
+  for(auto page : test_pages) {
+    TEST_ASSERT_TRUE(server.on(page, e_http_get, handler));
+  }
+  TEST_ASSERT_TRUE(server.on("/save", e_http_post, handler));
+}
+
+void test_http_server_concurrent_requests() {
+  HttpServer server;
+  add_test_routes(server);
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+
+  // Each route is served
+  handler_delay = 0;
+  for(auto page : test_pages) {
+    auto response = http_get(page);
+    TEST_ASSERT_EQUAL(200, status_code(response));
+    TEST_ASSERT_EQUAL_STRING(page, body_of(response).c_str());
+  }
+
+  // Slow requests are handled at the same time, not one after the other
+  handler_delay = TEST_HANDLER_DELAY_MILLIS;
+  std::thread clients[HTTP_SERVER_WORKERS];
+  int codes[HTTP_SERVER_WORKERS] = {};
+  auto start = std::chrono::steady_clock::now();
+  for(int i = 0; i < HTTP_SERVER_WORKERS; ++i) {
+    clients[i] = std::thread([&codes, i]() {
+      codes[i] = status_code(http_get(test_pages[i]));
+    });
+  }
+  for(auto& client : clients) {
+    client.join();
+  }
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+  for(auto code : codes) {
+    TEST_ASSERT_EQUAL(200, code);
+  }
+  TEST_ASSERT_LESS_THAN(2 * TEST_HANDLER_DELAY_MILLIS, elapsed.count());
+  TEST_ASSERT_EQUAL(0, server.get_refused());
+
+  server.stop();
+  TEST_ASSERT_FALSE(server.is_running());
+}
+
+void test_http_server_busy() {
+  const int request_count = HTTP_SERVER_WORKERS + HTTP_SERVER_QUEUE_SIZE + 2;
+  HttpServer server;
+  add_test_routes(server);
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+  handler_delay = TEST_HANDLER_DELAY_MILLIS;
+
+  std::thread clients[request_count];
+  std::atomic<int> ok(0);
+  std::atomic<int> busy(0);
+  for(auto& client : clients) {
+    client = std::thread([&ok, &busy]() {
+      auto code = status_code(http_get("/status"));
+      if(code == 200) {
+        ++ok;
+      } else if(code == 503) {
+        ++busy;
+      }
+    });
+  }
+  for(auto& client : clients) {
+    client.join();
+  }
+
+  // More connections than workers and queue are refused right away
+  TEST_ASSERT_EQUAL(request_count, ok + busy);
+  TEST_ASSERT_GREATER_OR_EQUAL(HTTP_SERVER_WORKERS, ok.load());
+  TEST_ASSERT_GREATER_OR_EQUAL(1, busy.load());
+  TEST_ASSERT_EQUAL(busy.load(), server.get_refused());
+
+  server.stop();
+}
+
+void test_http_server_not_found() {
+  HttpServer server;
+  add_test_routes(server);
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+  handler_delay = 0;
+
+  TEST_ASSERT_EQUAL(404, status_code(http_get("/unknown")));
+  // Wrong method
+  TEST_ASSERT_EQUAL(404, status_code(http_get("/save")));
+  // Handler that does not respond
+  server.stop();
+  TEST_ASSERT_TRUE(server.on("/nothing", e_http_get, [](HttpRequest&, HttpResponse&) {}));
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+  TEST_ASSERT_EQUAL(500, status_code(http_get("/nothing")));
+
+  server.stop();
+}
+
+void test_http_server_form_args() {
+  HttpServer server;
+  std::string result;
+  server.on("/save", e_http_post, [&result](HttpRequest& request, HttpResponse& response) {
+    result = std::string(request.arg("next")) + "|" + request.arg("ssid") + "|" + request.arg("led") + "|"
+        + (request.has_arg("missing") ? "yes" : "no") + "|" + request.arg("missing") + "|"
+        + (request.header("content-type") ? request.header("content-type") : "");
+    response.add_header("Location", "/device?success=true");
+    response.send(302, "text/html");
+  });
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+
+  std::string body = "ssid=my+home%21&led=50";
+  auto response = http_request(
+      "POST /save?next=/device HTTP/1.1\r\n"
+      "Host: localhost\r\n"
+      "Content-Type: application/x-www-form-urlencoded\r\n"
+      "Content-Length: " + std::to_string(body.size()) + "\r\n"
+      "\r\n" + body
+  );
+
+  TEST_ASSERT_EQUAL(302, status_code(response));
+  TEST_ASSERT_TRUE(response.find("Location: /device?success=true\r\n") != std::string::npos);
+  TEST_ASSERT_EQUAL_STRING("/device|my home!|50|no||application/x-www-form-urlencoded", result.c_str());
+
+  server.stop();
+}
+
+void test_http_server_chunked_response() {
+  HttpServer server;
+  server.on("/", e_http_get, [](HttpRequest&, HttpResponse& response) {
+    response.begin_chunked(200, "text/html");
+    response.write_chunk("hello ", 6);
+    response.write_chunk("world", 5);
+    response.end_chunked();
+  });
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+
+  auto response = http_get("/");
+  TEST_ASSERT_EQUAL(200, status_code(response));
+  TEST_ASSERT_TRUE(response.find("Transfer-Encoding: chunked\r\n") != std::string::npos);
+  TEST_ASSERT_EQUAL_STRING("6\r\nhello \r\n5\r\nworld\r\n0\r\n\r\n", body_of(response).c_str());
+
+  server.stop();
+}
+
+void test_http_server_raw_body() {
+  const size_t body_size = 3 * HTTP_SERVER_BODY_SIZE + 17;
+  HttpServer server;
+  server.on("/update", e_http_post, [](HttpRequest& request, HttpResponse& response) {
+    uint8_t buffer[100];
+    size_t total = 0;
+    uint32_t sum = 0;
+    int read_size;
+    while((read_size = request.read(buffer, sizeof(buffer))) > 0) {
+      for(int i = 0; i < read_size; ++i) {
+        sum += buffer[i];
+      }
+      total += read_size;
+    }
+    char result[32];
+    snprintf(result, sizeof(result), "%zu %u", total, sum);
+    response.send(total == request.content_length() ? 200 : 500, "text/plain", result);
+  }, true);
+  TEST_ASSERT_TRUE(server.begin(TEST_PORT));
+
+  std::string body;
+  uint32_t sum = 0;
+  for(size_t i = 0; i < body_size; ++i) {
+    body += static_cast<char>(i % 251);
+    sum += i % 251;
+  }
+  auto response = http_request(
+      "POST /update HTTP/1.1\r\n"
+      "Host: localhost\r\n"
+      "Content-Type: application/octet-stream\r\n"
+      "Content-Length: " + std::to_string(body.size()) + "\r\n"
+      "\r\n" + body
+  );
+
+  TEST_ASSERT_EQUAL(200, status_code(response));
+  TEST_ASSERT_EQUAL_STRING((std::to_string(body_size) + " " + std::to_string(sum)).c_str(), body_of(response).c_str());
+
+  server.stop();
+}
@@ -0,0 +1,23 @@
+#include <unity.h>
+
+void test_http_server_concurrent_requests();
+void test_http_server_busy();
+void test_http_server_not_found();
+void test_http_server_form_args();
+void test_http_server_chunked_response();
+void test_http_server_raw_body();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_http_server_concurrent_requests);
+  RUN_TEST(test_http_server_busy);
+  RUN_TEST(test_http_server_not_found);
+  RUN_TEST(test_http_server_form_args);
+  RUN_TEST(test_http_server_chunked_response);
+  RUN_TEST(test_http_server_raw_body);
+
+  // Unit test done
+  return UNITY_END();
+}
@@ -0,0 +1,69 @@
+#include <unity.h>
+
+#include <led_sequencer.h>
+
+constexpr LedStep k_steady[] = {{3, 0, false}};
+constexpr LedStep k_blink[] = {{1, 250, false}, {0, 750, false}};
+constexpr LedStep k_fade[] = {{1, 100, true}, {2, 50, false}};
+
+void test_led_sequencer_steady() {
+  LedSequencer sequencer;
+  LedFrame frame{};
+  // Nothing started yet
+  TEST_ASSERT_EQUAL(0, sequencer.update(frame));
+  TEST_ASSERT_EQUAL(0, frame.color);
+
+  LedPattern pattern = LED_PATTERN(k_steady);
+  sequencer.start(pattern);
+  TEST_ASSERT_EQUAL(0, sequencer.update(frame));
+  TEST_ASSERT_EQUAL(3, frame.color);
+  TEST_ASSERT_EQUAL(0, frame.blend);
+}
+
+void test_led_sequencer_blink() {
+  LedSequencer sequencer;
+  LedPattern pattern = LED_PATTERN(k_blink);
+  sequencer.start(pattern);
+  LedFrame frame{};
+
+  // One update per step, looping
+  for(int i = 0; i < 3; ++i) {
+    TEST_ASSERT_EQUAL(250, sequencer.update(frame));
+    TEST_ASSERT_EQUAL(1, frame.color);
+    TEST_ASSERT_EQUAL(0, frame.blend);
+    TEST_ASSERT_EQUAL(750, sequencer.update(frame));
+    TEST_ASSERT_EQUAL(0, frame.color);
+  }
+
+  // Starting again begins with the first step
+  sequencer.update(frame);
+  sequencer.start(pattern);
+  TEST_ASSERT_EQUAL(250, sequencer.update(frame));
+  TEST_ASSERT_EQUAL(1, frame.color);
+}
+
+void test_led_sequencer_fade() {
+  LedSequencer sequencer;
+  LedPattern pattern = LED_PATTERN(k_fade);
+  sequencer.start(pattern);
+  LedFrame frame{};
+
+  uint32_t elapsed = 0;
+  uint8_t last_blend = 0;
+  for(int i = 0; i < 5; ++i) {
+    uint32_t delay = sequencer.update(frame);
+    TEST_ASSERT_EQUAL(1, frame.color);
+    TEST_ASSERT_EQUAL(2, frame.next_color);
+    TEST_ASSERT_EQUAL(elapsed * 255 / 100, frame.blend);
+    TEST_ASSERT_TRUE(frame.blend >= last_blend);
+    TEST_ASSERT_EQUAL(LED_SEQUENCER_FADE_TICK_MILLIS, delay);
+    last_blend = frame.blend;
+    elapsed += delay;
+  }
+
+  // Fade reached the next color, which is shown without fading
+  TEST_ASSERT_EQUAL(50, sequencer.update(frame));
+  TEST_ASSERT_EQUAL(2, frame.color);
+  TEST_ASSERT_EQUAL(1, frame.next_color);
+  TEST_ASSERT_EQUAL(0, frame.blend);
+}
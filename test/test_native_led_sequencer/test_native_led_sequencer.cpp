@@ -0,0 +1,17 @@
+#include <unity.h>
+
+void test_led_sequencer_steady();
+void test_led_sequencer_blink();
+void test_led_sequencer_fade();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_led_sequencer_steady);
+  RUN_TEST(test_led_sequencer_blink);
+  RUN_TEST(test_led_sequencer_fade);
+
+  // Unit test done
+  return UNITY_END();
+}
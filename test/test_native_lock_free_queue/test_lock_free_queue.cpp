@@ -0,0 +1,44 @@
+#include <unity.h>
+
+#include <LockFreeQueue.hpp>
+
+/**
+ * Test lock free queue
+ */
+void test_lock_free_queue() {
+  const uint16_t QUEUE_SIZE = 4;
+  LockFreeQueue<int, QUEUE_SIZE> queue;
+  int val = -1;
+
+  TEST_ASSERT_TRUE(queue.empty());
+  TEST_ASSERT_NULL(queue.peek());
+  TEST_ASSERT_FALSE(queue.pop(val));
+
+  // Fill queue
+  for(int i = 0; i < QUEUE_SIZE; ++i) {
+    TEST_ASSERT_TRUE(queue.push(i));
+  }
+
+  // Full queue does not overwrite, but counts the dropped item
+  TEST_ASSERT_FALSE(queue.push(42));
+  TEST_ASSERT_EQUAL(1, queue.get_dropped());
+
+  // In place reading
+  TEST_ASSERT_NOT_NULL(queue.peek());
+  TEST_ASSERT_EQUAL(0, *queue.peek());
+  queue.release();
+
+  // In place writing
+  int* slot = queue.acquire();
+  TEST_ASSERT_NOT_NULL(slot);
+  *slot = 12;
+  queue.commit();
+
+  for(int i = 1; i < QUEUE_SIZE; ++i) {
+    TEST_ASSERT_TRUE(queue.pop(val));
+    TEST_ASSERT_EQUAL(i, val);
+  }
+  TEST_ASSERT_TRUE(queue.pop(val));
+  TEST_ASSERT_EQUAL(12, val);
+  TEST_ASSERT_TRUE(queue.empty());
+}
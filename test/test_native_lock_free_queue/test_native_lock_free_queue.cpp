@@ -0,0 +1,13 @@
+#include <unity.h>
+
+void test_lock_free_queue();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_lock_free_queue);
+
+  // Unit test done
+  return UNITY_END();
+}
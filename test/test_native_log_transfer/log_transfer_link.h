@@ -0,0 +1,244 @@
+#ifndef TEST_NATIVE_LOG_TRANSFER_LINK_H
+#define TEST_NATIVE_LOG_TRANSFER_LINK_H
+
+#include <stdint.h>
+#include <deque>
+#include <string>
+#include <utility>
+
+#include <log_transfer.h>
+
+/**
+ * Log in memory, data before `start` was removed
+ */
+class MemoryLog : public LogSource {
+ public:
+  MemoryLog(const std::string& data, uint32_t start = 0) : data(data), start(start) {}
+
+  uint32_t get_start() const override {
+    return start;
+  }
+
+  uint32_t get_end() const override {
+    return data.size();
+  }
+
+  size_t read(uint32_t offset, uint8_t* buffer, size_t size) override {
+    if(offset < start || offset >= data.size()) {
+      return 0;
+    }
+    return data.copy(reinterpret_cast<char*>(buffer), size, offset);
+  }
+
+  std::string data;
+  uint32_t start;
+};
+
+/**
+ * Log sentences like the bGeigie produces them
+ */
+inline std::string make_log(uint32_t size) {
+  std::string log;
+  for(uint32_t i = 0; log.size() < size; ++i) {
+    char sentence[96];
+    snprintf(sentence, sizeof(sentence),
+             "$BNRDD,2345,2024-05-0%uT12:%02u:%02uZ,%u,%u,%u,A,3539.5400,N,13942.0054,E,41.20,A,9,91*%02X\n",
+             1 + i % 9, (i / 60) % 60, i % 60, 30 + i % 17, 2000 + i, 600000 + i * 7, i & 0xFF);
+    log += sentence;
+  }
+  log.resize(size);
+  return log;
+}
+
+#define TEST_GAP_REPEAT_MILLIS 50 // Report a gap again if the device did not go back
+
+/**
+ * Phone side of the protocol, acknowledges every window / 2 packets and reports gaps
+ */
+class LogClient {
+ public:
+  explicit LogClient(uint8_t window) : window(window), base(0), expected(0), end(0), received(), since_ack(0),
+                                       gap_reported(false), gap_reported_at(0), done(false), corrupted(0), commands() {}
+
+  void request(uint32_t offset) {
+    std::string command("R");
+    append_u32(command, offset);
+    command.push_back(static_cast<char>(window));
+    commands.push_back(command);
+    done = false;
+  }
+
+  void receive(const std::string& packet, uint32_t now) {
+    auto data = reinterpret_cast<const uint8_t*>(packet.data());
+    switch(packet[0]) {
+      case 'I':
+        if(received.empty()) {
+          base = read_u32(data + 1);
+        }
+        expected = read_u32(data + 1);
+        end = read_u32(data + 5);
+        since_ack = 0;
+        gap_reported = false;
+        break;
+      case 'D': {
+        uint16_t crc = data[packet.size() - 2] | (data[packet.size() - 1] << 8u);
+        if(LogTransfer::crc16(data, packet.size() - 2) != crc) {
+          ++corrupted;
+          report_gap(now);
+          break;
+        }
+        if(read_u32(data + 1) != expected) {
+          // Lost packet, or sent again after the client's acknowledgement was lost
+          report_gap(now);
+          break;
+        }
+        received.append(packet, 5, packet.size() - LOG_TRANSFER_DATA_OVERHEAD);
+        expected += packet.size() - LOG_TRANSFER_DATA_OVERHEAD;
+        gap_reported = false;
+        if(++since_ack >= window / 2 || expected == end) {
+          acknowledge('A');
+        }
+        break;
+      }
+      case 'E':
+        done = read_u32(data + 1) == expected;
+        break;
+      default:
+        break;
+    }
+  }
+
+  uint8_t window;
+  uint32_t base;
+  uint32_t expected;
+  uint32_t end;
+  std::string received;
+  uint16_t since_ack;
+  bool gap_reported;
+  uint32_t gap_reported_at;
+  bool done;
+  uint32_t corrupted;
+  std::deque<std::string> commands;
+
+ private:
+  void report_gap(uint32_t now) {
+    if(!gap_reported || now - gap_reported_at > TEST_GAP_REPEAT_MILLIS) {
+      // Once per gap, packets after it are ignored until the missing offset arrives
+      acknowledge('N');
+      gap_reported = true;
+      gap_reported_at = now;
+    }
+  }
+
+  void acknowledge(char type) {
+    std::string command(1, type);
+    append_u32(command, expected);
+    commands.push_back(command);
+    since_ack = 0;
+  }
+
+  static void append_u32(std::string& out, uint32_t value) {
+    for(int i = 0; i < 4; ++i) {
+      out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+  }
+
+  static uint32_t read_u32(const uint8_t* data) {
+    return data[0] | (data[1] << 8u) | (data[2] << 16u) | (static_cast<uint32_t>(data[3]) << 24u);
+  }
+};
+
+/**
+ * Notification link in 1 ms steps: a limited amount of packets per step, latency, and lost or corrupted data packets.
+ * Info and end packets always arrive, a real client requests again when they don't.
+ */
+class LinkSimulation {
+ public:
+  LinkSimulation(LogSource& log, LogClient& client, uint16_t packet_size) :
+      packets_per_milli(1),
+      latency(8),
+      packet_loss(0),
+      corruption(0),
+      command_loss(0),
+      now(0),
+      transfer(log, [this](const uint8_t* packet, size_t size) { return send(packet, size); }),
+      _client(client),
+      _sent_this_milli(0),
+      _to_client(),
+      _to_device(),
+      _random(0x1234567) {
+    transfer.set_packet_size(packet_size);
+  }
+
+  /**
+   * Run until the client received the end or the time limit
+   * @return millis it took
+   */
+  uint32_t run(uint32_t max_millis) {
+    uint32_t started = now;
+    while(!_client.done && now - started < max_millis) {
+      step();
+    }
+    return now - started;
+  }
+
+  void step() {
+    while(!_client.commands.empty()) {
+      if(!chance(command_loss)) {
+        _to_device.emplace_back(now + latency, _client.commands.front());
+      }
+      _client.commands.pop_front();
+    }
+    while(!_to_device.empty() && _to_device.front().first <= now) {
+      const auto& command = _to_device.front().second;
+      transfer.handle_command(reinterpret_cast<const uint8_t*>(command.data()), command.size(), now);
+      _to_device.pop_front();
+    }
+    _sent_this_milli = 0;
+    transfer.poll(now);
+    while(!_to_client.empty() && _to_client.front().first <= now) {
+      _client.receive(_to_client.front().second, now);
+      _to_client.pop_front();
+    }
+    ++now;
+  }
+
+  uint8_t packets_per_milli;
+  uint32_t latency;
+  uint8_t packet_loss; // percentages
+  uint8_t corruption;
+  uint8_t command_loss;
+  uint32_t now;
+  LogTransfer transfer;
+
+ private:
+  bool send(const uint8_t* packet, size_t size) {
+    if(_sent_this_milli >= packets_per_milli) {
+      return false;
+    }
+    ++_sent_this_milli;
+    bool data_packet = packet[0] == 'D';
+    if(data_packet && chance(packet_loss)) {
+      return true;
+    }
+    std::string data(reinterpret_cast<const char*>(packet), size);
+    if(data_packet && chance(corruption)) {
+      data[size / 2] ^= 0x10;
+    }
+    _to_client.emplace_back(now + latency, data);
+    return true;
+  }
+
+  bool chance(uint8_t percentage) {
+    _random = _random * 1103515245 + 12345;
+    return (_random >> 16u) % 100 < percentage;
+  }
+
+  LogClient& _client;
+  uint8_t _sent_this_milli;
+  std::deque<std::pair<uint32_t, std::string>> _to_client;
+  std::deque<std::pair<uint32_t, std::string>> _to_device;
+  uint32_t _random;
+};
+
+#endif //TEST_NATIVE_LOG_TRANSFER_LINK_H
@@ -0,0 +1,165 @@
+#include <unity.h>
+#include <stdio.h>
+
+#include "log_transfer_link.h"
+
+#define TEST_LOG_SIZE (128 * 1024) // Both files of the reading log
+#define TEST_PACKET_SIZE 244 // MTU 247
+#define TEST_WINDOW 32 // Covers the round trip of the link
+
+void test_log_transfer_crc16() {
+  const char* check = "123456789";
+  TEST_ASSERT_EQUAL_HEX16(0x29B1, LogTransfer::crc16(reinterpret_cast<const uint8_t*>(check), 9));
+  // Continued over parts
+  uint16_t crc = LogTransfer::crc16(reinterpret_cast<const uint8_t*>(check), 4);
+  TEST_ASSERT_EQUAL_HEX16(0x29B1, LogTransfer::crc16(reinterpret_cast<const uint8_t*>(check + 4), 5, crc));
+}
+
+void test_log_transfer_clean_link() {
+  MemoryLog log(make_log(TEST_LOG_SIZE));
+  LogClient client(TEST_WINDOW);
+  LinkSimulation link(log, client, TEST_PACKET_SIZE);
+
+  client.request(0);
+  uint32_t duration = link.run(60000);
+  TEST_ASSERT_TRUE(client.done);
+  TEST_ASSERT_TRUE(client.received == log.data);
+
+  const auto& metrics = link.transfer.get_metrics();
+  uint32_t payload = TEST_PACKET_SIZE - LOG_TRANSFER_DATA_OVERHEAD;
+  TEST_ASSERT_EQUAL((TEST_LOG_SIZE + payload - 1) / payload, metrics.packets);
+  TEST_ASSERT_EQUAL(0, metrics.resent);
+  TEST_ASSERT_EQUAL(0, metrics.timeouts);
+  TEST_ASSERT_EQUAL(TEST_LOG_SIZE, metrics.last_bytes);
+  TEST_ASSERT_FALSE(link.transfer.is_active());
+
+  char message[96];
+  snprintf(message, sizeof(message), "%u bytes in %u ms (%u B/s), %u packets refused by the link",
+           TEST_LOG_SIZE, duration, TEST_LOG_SIZE * 1000 / duration, metrics.congested);
+  TEST_MESSAGE(message);
+  // One packet per milli is the limit of the link, the window keeps it busy despite the latency
+  TEST_ASSERT_LESS_THAN(TEST_LOG_SIZE / payload * 12 / 10, duration);
+}
+
+void test_log_transfer_small_mtu() {
+  MemoryLog log(make_log(4096));
+  LogClient client(TEST_WINDOW);
+  LinkSimulation link(log, client, 20); // Default MTU of 23
+
+  client.request(0);
+  link.run(60000);
+  TEST_ASSERT_TRUE(client.done);
+  TEST_ASSERT_TRUE(client.received == log.data);
+  TEST_ASSERT_EQUAL((4096 + 12) / 13, link.transfer.get_metrics().packets);
+}
+
+void test_log_transfer_lossy_link() {
+  MemoryLog log(make_log(TEST_LOG_SIZE));
+  LogClient client(TEST_WINDOW);
+  LinkSimulation link(log, client, TEST_PACKET_SIZE);
+  link.packet_loss = 3;
+  link.corruption = 2;
+  link.command_loss = 10;
+
+  client.request(0);
+  link.run(120000);
+  TEST_ASSERT_TRUE(client.done);
+  TEST_ASSERT_TRUE(client.received == log.data);
+
+  const auto& metrics = link.transfer.get_metrics();
+  TEST_ASSERT_GREATER_THAN(0, client.corrupted);
+  TEST_ASSERT_GREATER_THAN(0, metrics.gaps);
+  TEST_ASSERT_GREATER_THAN(0, metrics.resent);
+}
+
+void test_log_transfer_lost_acknowledgements() {
+  MemoryLog log(make_log(16 * 1024));
+  LogClient client(TEST_WINDOW);
+  LinkSimulation link(log, client, TEST_PACKET_SIZE);
+
+  client.request(0);
+  link.run(20);
+  // Everything the client sends is lost, the window fills up and the device sends again after the timeout
+  link.command_loss = 100;
+  link.run(LOG_TRANSFER_ACK_TIMEOUT_MILLIS * 2);
+  TEST_ASSERT_GREATER_THAN(0, link.transfer.get_metrics().timeouts);
+  TEST_ASSERT_FALSE(client.done);
+
+  link.command_loss = 0;
+  link.run(60000);
+  TEST_ASSERT_TRUE(client.done);
+  TEST_ASSERT_TRUE(client.received == log.data);
+}
+
+void test_log_transfer_resume() {
+  MemoryLog log(make_log(TEST_LOG_SIZE));
+  LogClient client(TEST_WINDOW);
+  LinkSimulation link(log, client, TEST_PACKET_SIZE);
+
+  client.request(0);
+  link.run(200);
+  // Disconnected halfway, the client requests again from what it received
+  link.transfer.cancel();
+  link.run(50);
+  uint32_t resume_offset = client.expected;
+  TEST_ASSERT_GREATER_THAN(0, resume_offset);
+  TEST_ASSERT_LESS_THAN(TEST_LOG_SIZE, resume_offset);
+
+  client.request(resume_offset);
+  link.run(60000);
+  TEST_ASSERT_TRUE(client.done);
+  TEST_ASSERT_TRUE(client.received == log.data);
+  TEST_ASSERT_EQUAL(2, link.transfer.get_metrics().transfers);
+  TEST_ASSERT_EQUAL(TEST_LOG_SIZE - resume_offset, link.transfer.get_metrics().last_bytes);
+}
+
+void test_log_transfer_snapshot_and_removed_data() {
+  // Older data was removed when the log rotated, the transfer starts at the oldest data still available
+  MemoryLog log(make_log(8192), 2048);
+  LogClient client(TEST_WINDOW);
+  LinkSimulation link(log, client, TEST_PACKET_SIZE);
+
+  client.request(0);
+  link.run(20);
+  // Logged during the transfer, not part of it
+  log.data += "$BNRDD,2345,new\n";
+  link.run(60000);
+  TEST_ASSERT_TRUE(client.done);
+  TEST_ASSERT_EQUAL(2048, client.base);
+  TEST_ASSERT_EQUAL(8192, client.end);
+  TEST_ASSERT_TRUE(client.received == log.data.substr(2048, 8192 - 2048));
+
+  // Nothing new: info and end right away
+  LogClient empty_client(TEST_WINDOW);
+  LinkSimulation empty_link(log, empty_client, TEST_PACKET_SIZE);
+  empty_client.request(log.get_end());
+  empty_link.run(1000);
+  TEST_ASSERT_TRUE(empty_client.done);
+  TEST_ASSERT_EQUAL(0, empty_link.transfer.get_metrics().packets);
+}
+
+void test_log_transfer_invalid_commands() {
+  MemoryLog log(make_log(1024));
+  LogTransfer transfer(log, [](const uint8_t*, size_t) { return true; });
+  const uint8_t request[] = {'R', 0, 0, 0, 0, 4};
+  const uint8_t short_request[] = {'R', 0, 0, 0, 0};
+  const uint8_t ack_beyond[] = {'A', 0, 1, 0, 0};
+  const uint8_t unknown[] = {'Q'};
+
+  TEST_ASSERT_FALSE(transfer.handle_command(short_request, sizeof(short_request), 0));
+  TEST_ASSERT_FALSE(transfer.handle_command(unknown, sizeof(unknown), 0));
+  TEST_ASSERT_FALSE(transfer.handle_command(request, 0, 0));
+  TEST_ASSERT_FALSE(transfer.is_active());
+
+  TEST_ASSERT_TRUE(transfer.handle_command(request, sizeof(request), 0));
+  TEST_ASSERT_TRUE(transfer.is_active());
+  // Info and the window of 4 data packets
+  TEST_ASSERT_EQUAL(5, transfer.poll(0));
+  TEST_ASSERT_EQUAL(0, transfer.poll(1));
+  TEST_ASSERT_FALSE(transfer.handle_command(ack_beyond, sizeof(ack_beyond), 1));
+
+  const uint8_t cancel[] = {'X'};
+  TEST_ASSERT_TRUE(transfer.handle_command(cancel, sizeof(cancel), 2));
+  TEST_ASSERT_FALSE(transfer.is_active());
+  TEST_ASSERT_EQUAL(0, transfer.poll(3));
+}
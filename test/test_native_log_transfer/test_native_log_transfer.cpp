@@ -0,0 +1,27 @@
+#include <unity.h>
+
+void test_log_transfer_crc16();
+void test_log_transfer_clean_link();
+void test_log_transfer_small_mtu();
+void test_log_transfer_lossy_link();
+void test_log_transfer_lost_acknowledgements();
+void test_log_transfer_resume();
+void test_log_transfer_snapshot_and_removed_data();
+void test_log_transfer_invalid_commands();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_log_transfer_crc16);
+  RUN_TEST(test_log_transfer_clean_link);
+  RUN_TEST(test_log_transfer_small_mtu);
+  RUN_TEST(test_log_transfer_lossy_link);
+  RUN_TEST(test_log_transfer_lost_acknowledgements);
+  RUN_TEST(test_log_transfer_resume);
+  RUN_TEST(test_log_transfer_snapshot_and_removed_data);
+  RUN_TEST(test_log_transfer_invalid_commands);
+
+  // Unit test done
+  return UNITY_END();
+}
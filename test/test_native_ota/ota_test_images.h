@@ -0,0 +1,92 @@
+#ifndef TEST_NATIVE_OTA_IMAGES_H
+#define TEST_NATIVE_OTA_IMAGES_H
+
+#include <stdint.h>
+#include <string>
+
+#include <delta_patch.h>
+
+#define TEST_IMAGE_SIZE (256 * 1024)
+#define TEST_INSERT "new code of the next release"
+
+/**
+ * Builds patches in the format of tools/ota_publish.py
+ */
+class PatchBuilder {
+ public:
+  PatchBuilder(uint32_t source_size, uint32_t target_size) {
+    _patch.append(DELTA_MAGIC, 4);
+    _patch.push_back(DELTA_VERSION);
+    _patch.append(3, '\0');
+    append_u32(source_size);
+    append_u32(target_size);
+  }
+
+  PatchBuilder& copy(uint32_t offset, uint32_t length) {
+    _patch.push_back('C');
+    append_u32(offset);
+    append_u32(length);
+    return *this;
+  }
+
+  PatchBuilder& insert(const std::string& data) {
+    _patch.push_back('I');
+    append_u32(data.size());
+    _patch.append(data);
+    return *this;
+  }
+
+  std::string end() {
+    _patch.push_back('E');
+    return _patch;
+  }
+
+ private:
+  void append_u32(uint32_t value) {
+    for(int i = 0; i < 4; ++i) {
+      _patch.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+  }
+
+  std::string _patch;
+};
+
+/**
+ * Pseudo random image, like compiled code it does not compress
+ */
+inline std::string make_source_image() {
+  std::string image(TEST_IMAGE_SIZE, '\0');
+  uint32_t state = 0x12345678;
+  for(auto& byte : image) {
+    state = state * 1103515245 + 12345;
+    byte = static_cast<char>(state >> 16);
+  }
+  return image;
+}
+
+/**
+ * The source with some code inserted in the middle, like a small firmware change
+ */
+inline std::string make_target_image(const std::string& source) {
+  return source.substr(0, TEST_IMAGE_SIZE / 2) + TEST_INSERT + source.substr(TEST_IMAGE_SIZE / 2);
+}
+
+inline std::string make_patch(const std::string& source, const std::string& target) {
+  return PatchBuilder(source.size(), target.size())
+      .copy(0, TEST_IMAGE_SIZE / 2)
+      .insert(TEST_INSERT)
+      .copy(TEST_IMAGE_SIZE / 2, TEST_IMAGE_SIZE / 2)
+      .end();
+}
+
+inline DeltaPatcher::SourceReader make_reader(const std::string& source) {
+  return [&source](uint32_t offset, uint8_t* buffer, size_t size) {
+    if(offset + size > source.size()) {
+      return false;
+    }
+    source.copy(reinterpret_cast<char*>(buffer), size, offset);
+    return true;
+  };
+}
+
+#endif //TEST_NATIVE_OTA_IMAGES_H
@@ -0,0 +1,80 @@
+#include <unity.h>
+#include <string>
+
+#include "ota_test_images.h"
+
+static bool apply(const std::string& source, const std::string& patch, std::string& target, size_t part_size) {
+  auto reader = make_reader(source);
+  DeltaPatcher patcher(reader, [&target](const uint8_t* data, size_t size) {
+    target.append(reinterpret_cast<const char*>(data), size);
+    return true;
+  });
+  for(size_t offset = 0; offset < patch.size(); offset += part_size) {
+    auto size = patch.size() - offset < part_size ? patch.size() - offset : part_size;
+    if(!patcher.write(reinterpret_cast<const uint8_t*>(patch.data() + offset), size)) {
+      return false;
+    }
+  }
+  return patcher.is_complete();
+}
+
+void test_delta_patch_apply() {
+  auto source = make_source_image();
+  auto target = make_target_image(source);
+  auto patch = make_patch(source, target);
+
+  std::string result;
+  TEST_ASSERT_TRUE(apply(source, patch, result, patch.size()));
+  TEST_ASSERT_EQUAL(target.size(), result.size());
+  TEST_ASSERT_TRUE(result == target);
+  TEST_ASSERT_LESS_THAN(100, patch.size());
+}
+
+void test_delta_patch_streamed() {
+  auto source = make_source_image();
+  auto target = make_target_image(source);
+  auto patch = make_patch(source, target);
+
+  // Headers and arguments split over network reads
+  for(size_t part_size : {1, 3, 7, 1460}) {
+    std::string result;
+    TEST_ASSERT_TRUE(apply(source, patch, result, part_size));
+    TEST_ASSERT_TRUE(result == target);
+  }
+}
+
+void test_delta_patch_invalid() {
+  auto source = make_source_image();
+  std::string result;
+
+  // Wrong magic
+  auto patch = PatchBuilder(source.size(), 4).insert("data").end();
+  patch[0] = 'X';
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+
+  // Copy outside of the source
+  patch = PatchBuilder(source.size(), 16).copy(source.size() - 8, 16).end();
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+
+  // More data than the target size
+  patch = PatchBuilder(source.size(), 2).insert("data").end();
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+
+  // End before the target is complete
+  patch = PatchBuilder(source.size(), 8).insert("data").end();
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+
+  // Unknown operation
+  patch = PatchBuilder(source.size(), 4).end();
+  patch.back() = 'X';
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+
+  // Data after the end
+  patch = PatchBuilder(source.size(), 4).insert("data").end() + "I";
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+
+  // Truncated
+  patch = PatchBuilder(source.size(), 4).insert("data").end();
+  patch.pop_back();
+  TEST_ASSERT_FALSE(apply(source, patch, result, patch.size()));
+}
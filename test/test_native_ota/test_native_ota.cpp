@@ -0,0 +1,31 @@
+#include <unity.h>
+
+void test_ota_manifest_parse();
+void test_ota_compare_versions();
+void test_delta_patch_apply();
+void test_delta_patch_streamed();
+void test_delta_patch_invalid();
+void test_ota_fetch_check();
+void test_ota_fetch_full_image();
+void test_ota_fetch_delta();
+void test_ota_fetch_resume();
+void test_ota_fetch_failures();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ota_manifest_parse);
+  RUN_TEST(test_ota_compare_versions);
+  RUN_TEST(test_delta_patch_apply);
+  RUN_TEST(test_delta_patch_streamed);
+  RUN_TEST(test_delta_patch_invalid);
+  RUN_TEST(test_ota_fetch_check);
+  RUN_TEST(test_ota_fetch_full_image);
+  RUN_TEST(test_ota_fetch_delta);
+  RUN_TEST(test_ota_fetch_resume);
+  RUN_TEST(test_ota_fetch_failures);
+
+  // Unit test done
+  return UNITY_END();
+}
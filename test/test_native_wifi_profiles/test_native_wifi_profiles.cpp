@@ -0,0 +1,19 @@
+#include <unity.h>
+
+void test_wifi_ranking_stored_only();
+void test_wifi_ranking_strongest_access_point();
+void test_wifi_ranking_priority();
+void test_wifi_ranking_weak_signal();
+
+int main(int, char**) {
+  // Unit test start
+  UNITY_BEGIN();
+
+  RUN_TEST(test_wifi_ranking_stored_only);
+  RUN_TEST(test_wifi_ranking_strongest_access_point);
+  RUN_TEST(test_wifi_ranking_priority);
+  RUN_TEST(test_wifi_ranking_weak_signal);
+
+  // Unit test done
+  return UNITY_END();
+}
@@ -0,0 +1,81 @@
+#include <string.h>
+#include <unity.h>
+
+#include <wifi_profiles.h>
+
+const uint8_t k_bssid_a[6] = {1, 1, 1, 1, 1, 1};
+const uint8_t k_bssid_b[6] = {2, 2, 2, 2, 2, 2};
+
+void set_profile(WiFiProfile& profile, const char* ssid, uint8_t priority) {
+  strcpy(profile.ssid, ssid);
+  strcpy(profile.password, "password");
+  profile.priority = priority;
+}
+
+void test_wifi_ranking_stored_only() {
+  WiFiProfile profiles[WIFI_PROFILE_COUNT]{};
+  set_profile(profiles[0], "home", 0);
+  set_profile(profiles[2], "office", 0);
+  WiFiRanking ranking(profiles, WIFI_PROFILE_COUNT);
+
+  ranking.add("neighbour", -40, 1, k_bssid_a);
+  ranking.add("", -45, 1, k_bssid_a); // Hidden, never matches an unused profile
+  ranking.add("office", -60, 6, k_bssid_b);
+  TEST_ASSERT_EQUAL(1, ranking.rank());
+  TEST_ASSERT_EQUAL(2, ranking.get(0).profile);
+  TEST_ASSERT_EQUAL(-60, ranking.get(0).rssi);
+  TEST_ASSERT_EQUAL(6, ranking.get(0).channel);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(k_bssid_b, ranking.get(0).bssid, 6);
+
+  ranking.clear();
+  TEST_ASSERT_EQUAL(0, ranking.rank());
+}
+
+void test_wifi_ranking_strongest_access_point() {
+  WiFiProfile profiles[WIFI_PROFILE_COUNT]{};
+  set_profile(profiles[0], "home", 0);
+  WiFiRanking ranking(profiles, WIFI_PROFILE_COUNT);
+
+  // Same network from two access points, one candidate with the strongest
+  ranking.add("home", -70, 1, k_bssid_a);
+  ranking.add("home", -50, 11, k_bssid_b);
+  ranking.add("home", -80, 6, k_bssid_a);
+  TEST_ASSERT_EQUAL(1, ranking.rank());
+  TEST_ASSERT_EQUAL(-50, ranking.get(0).rssi);
+  TEST_ASSERT_EQUAL(11, ranking.get(0).channel);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(k_bssid_b, ranking.get(0).bssid, 6);
+}
+
+void test_wifi_ranking_priority() {
+  WiFiProfile profiles[WIFI_PROFILE_COUNT]{};
+  set_profile(profiles[0], "home", 0);
+  set_profile(profiles[1], "office", 0);
+  set_profile(profiles[2], "phone", 5);
+  set_profile(profiles[3], "site", 0);
+  WiFiRanking ranking(profiles, WIFI_PROFILE_COUNT);
+
+  ranking.add("home", -70, 1, k_bssid_a);
+  ranking.add("office", -55, 1, k_bssid_a);
+  ranking.add("phone", -75, 1, k_bssid_a);
+  ranking.add("site", -60, 1, k_bssid_a);
+  TEST_ASSERT_EQUAL(4, ranking.rank());
+  // Priority first, then the signal
+  TEST_ASSERT_EQUAL(2, ranking.get(0).profile);
+  TEST_ASSERT_EQUAL(1, ranking.get(1).profile);
+  TEST_ASSERT_EQUAL(3, ranking.get(2).profile);
+  TEST_ASSERT_EQUAL(0, ranking.get(3).profile);
+}
+
+void test_wifi_ranking_weak_signal() {
+  WiFiProfile profiles[WIFI_PROFILE_COUNT]{};
+  set_profile(profiles[0], "home", 0);
+  set_profile(profiles[1], "phone", WIFI_PRIORITY_MAX);
+  WiFiRanking ranking(profiles, WIFI_PROFILE_COUNT);
+
+  // A preferred network that is barely in range is tried last
+  ranking.add("phone", WIFI_MIN_RSSI - 1, 1, k_bssid_a);
+  ranking.add("home", -70, 1, k_bssid_b);
+  TEST_ASSERT_EQUAL(2, ranking.rank());
+  TEST_ASSERT_EQUAL(0, ranking.get(0).profile);
+  TEST_ASSERT_EQUAL(1, ranking.get(1).profile);
+}
@@ -0,0 +1,180 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <ota_updater.h>
+
+// SHA-256 of test_image(3 * OTA_BUFFER_SIZE + 100)
+#define TEST_IMAGE_SIZE (3 * OTA_BUFFER_SIZE + 100)
+#define TEST_IMAGE_SHA256 "27aff3c267b17a34c9f2a77a44060eb5a2f1c0ad669931720ed82516a7451260"
+
+static uint8_t test_image_byte(size_t i) {
+  return i % 251;
+}
+
+/**
+ * Updater that checks the written image instead of writing to flash
+ */
+class TestOtaUpdater : public OtaUpdater {
+ public:
+  size_t begin_size = 0;
+  size_t written = 0;
+  bool content_ok = true;
+  bool ended = false;
+  bool aborted = false;
+  uint32_t write_delay = 0;
+  size_t fail_after = SIZE_MAX;
+
+ protected:
+  bool flash_begin(size_t size) override {
+    begin_size = size;
+    return true;
+  }
+
+  bool flash_write(uint8_t* data, size_t size) override {
+    if(written + size > fail_after) {
+      return false;
+    }
+    for(size_t i = 0; i < size; ++i) {
+      content_ok &= data[i] == test_image_byte(written + i);
+    }
+    written += size;
+    delay(write_delay);
+    return true;
+  }
+
+  bool flash_end() override {
+    ended = true;
+    return true;
+  }
+
+  void flash_abort() override {
+    aborted = true;
+  }
+};
+
+/**
+ * Send the test image in parts of `part_size`, like received from the network
+ */
+static bool write_test_image(OtaUpdater& updater, size_t size, size_t part_size, uint32_t part_delay = 0) {
+  uint8_t part[part_size];
+  for(size_t offset = 0; offset < size; offset += part_size) {
+    size_t length = size - offset < part_size ? size - offset : part_size;
+    for(size_t i = 0; i < length; ++i) {
+      part[i] = test_image_byte(offset + i);
+    }
+    delay(part_delay);
+    if(!updater.write(part, length)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void test_ota_parse_digest() {
+  uint8_t digest[OTA_DIGEST_SIZE];
+  TEST_ASSERT_TRUE(OtaUpdater::parse_digest(TEST_IMAGE_SHA256, digest));
+  TEST_ASSERT_EQUAL_HEX8(0x27, digest[0]);
+  TEST_ASSERT_EQUAL_HEX8(0xaf, digest[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x60, digest[OTA_DIGEST_SIZE - 1]);
+  TEST_ASSERT_TRUE(OtaUpdater::parse_digest("27AFF3C267B17A34C9F2A77A44060EB5A2F1C0AD669931720ED82516A7451260", digest));
+
+  TEST_ASSERT_FALSE(OtaUpdater::parse_digest(nullptr, digest));
+  TEST_ASSERT_FALSE(OtaUpdater::parse_digest("27aff3c2", digest));
+  TEST_ASSERT_FALSE(OtaUpdater::parse_digest("x7aff3c267b17a34c9f2a77a44060eb5a2f1c0ad669931720ed82516a7451260", digest));
+
+  TestOtaUpdater updater;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_invalid_digest, updater.begin(TEST_IMAGE_SIZE, "1234"));
+  TEST_ASSERT_FALSE(updater.is_running());
+  TEST_ASSERT_EQUAL(0, updater.begin_size);
+}
+
+void test_ota_update_verified() {
+  TestOtaUpdater updater;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, updater.begin(TEST_IMAGE_SIZE, TEST_IMAGE_SHA256));
+  TEST_ASSERT_TRUE(updater.is_running());
+  TEST_ASSERT_EQUAL(TEST_IMAGE_SIZE, updater.begin_size);
+
+  // Parts that do not line up with the buffers
+  TEST_ASSERT_TRUE(write_test_image(updater, TEST_IMAGE_SIZE, 1000));
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, updater.end());
+  TEST_ASSERT_FALSE(updater.is_running());
+
+  TEST_ASSERT_EQUAL(TEST_IMAGE_SIZE, updater.written);
+  TEST_ASSERT_TRUE(updater.content_ok);
+  TEST_ASSERT_TRUE(updater.ended);
+  TEST_ASSERT_FALSE(updater.aborted);
+  TEST_ASSERT_EQUAL(TEST_IMAGE_SIZE, updater.get_metrics().size);
+  TEST_ASSERT_GREATER_THAN(0, updater.get_metrics().bytes_per_second());
+
+  // Without digest
+  TestOtaUpdater unverified;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, unverified.begin(TEST_IMAGE_SIZE));
+  TEST_ASSERT_TRUE(write_test_image(unverified, TEST_IMAGE_SIZE, OTA_BUFFER_SIZE));
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, unverified.end());
+  TEST_ASSERT_TRUE(unverified.ended);
+}
+
+void test_ota_update_digest_mismatch() {
+  TestOtaUpdater updater;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok,
+                    updater.begin(TEST_IMAGE_SIZE, "0000000000000000000000000000000000000000000000000000000000000000"));
+  TEST_ASSERT_TRUE(write_test_image(updater, TEST_IMAGE_SIZE, 1000));
+
+  // Written completely, but never activated
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_digest_mismatch, updater.end());
+  TEST_ASSERT_EQUAL(TEST_IMAGE_SIZE, updater.written);
+  TEST_ASSERT_FALSE(updater.ended);
+  TEST_ASSERT_TRUE(updater.aborted);
+}
+
+void test_ota_update_incomplete() {
+  TestOtaUpdater updater;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, updater.begin(TEST_IMAGE_SIZE, TEST_IMAGE_SHA256));
+  TEST_ASSERT_TRUE(write_test_image(updater, TEST_IMAGE_SIZE - 10, 1000));
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_size_mismatch, updater.end());
+  TEST_ASSERT_FALSE(updater.ended);
+  TEST_ASSERT_TRUE(updater.aborted);
+
+  // More than announced
+  TestOtaUpdater too_large;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, too_large.begin(100));
+  TEST_ASSERT_FALSE(write_test_image(too_large, 200, 150));
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_size_mismatch, too_large.end());
+  TEST_ASSERT_TRUE(too_large.aborted);
+
+  // End without begin
+  TestOtaUpdater not_started;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_not_started, not_started.end());
+}
+
+void test_ota_update_write_failed() {
+  TestOtaUpdater updater;
+  updater.fail_after = OTA_BUFFER_SIZE;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, updater.begin(TEST_IMAGE_SIZE, TEST_IMAGE_SHA256));
+
+  // The failure is noticed when the next buffer is needed
+  TEST_ASSERT_FALSE(write_test_image(updater, TEST_IMAGE_SIZE, 1000));
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_write_failed, updater.end());
+  TEST_ASSERT_EQUAL(OTA_BUFFER_SIZE, updater.written);
+  TEST_ASSERT_FALSE(updater.ended);
+  TEST_ASSERT_TRUE(updater.aborted);
+}
+
+void test_ota_update_overlaps_flash_writes() {
+  const uint8_t buffers = 8;
+  const uint32_t delay_per_buffer = 20;
+  TestOtaUpdater updater;
+  updater.write_delay = delay_per_buffer;
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, updater.begin(buffers * OTA_BUFFER_SIZE));
+
+  // Receiving a buffer takes as long as writing it
+  TEST_ASSERT_TRUE(write_test_image(updater, buffers * OTA_BUFFER_SIZE, OTA_BUFFER_SIZE, delay_per_buffer));
+  TEST_ASSERT_EQUAL(OtaUpdater::e_ota_ok, updater.end());
+  TEST_ASSERT_TRUE(updater.content_ok);
+
+  const auto& metrics = updater.get_metrics();
+  TEST_ASSERT_GREATER_OR_EQUAL(buffers * delay_per_buffer * 1000, metrics.flash);
+  TEST_ASSERT_GREATER_OR_EQUAL(buffers * delay_per_buffer * 1000, metrics.network());
+  // One after the other would take twice as long
+  TEST_ASSERT_LESS_THAN(buffers * delay_per_buffer * 1000 * 3 / 2, metrics.total);
+}
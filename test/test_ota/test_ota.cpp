@@ -0,0 +1,27 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void test_ota_parse_digest();
+void test_ota_update_verified();
+void test_ota_update_digest_mismatch();
+void test_ota_update_incomplete();
+void test_ota_update_write_failed();
+void test_ota_update_overlaps_flash_writes();
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_ota_parse_digest);
+  RUN_TEST(test_ota_update_verified);
+  RUN_TEST(test_ota_update_digest_mismatch);
+  RUN_TEST(test_ota_update_incomplete);
+  RUN_TEST(test_ota_update_write_failed);
+  RUN_TEST(test_ota_update_overlaps_flash_writes);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,60 @@
+#include <Arduino.h>
+#include <unity.h>
+
+#include <sm_trace.h>
+
+/**
+ * Test state trace records entries oldest first, keeps the newest when full and tracks dwell times
+ */
+void test_state_trace() {
+  StateTrace trace;
+  static uint8_t buffer[StateTrace::k_serialized_size];
+  StateTrace::Header header{};
+  StateTrace::Entry entry{};
+
+  // Empty trace, only header
+  TEST_ASSERT_EQUAL(sizeof(StateTrace::Header), trace.serialize(buffer, sizeof(buffer)));
+  memcpy(&header, buffer, sizeof(header));
+  TEST_ASSERT_EQUAL(0, memcmp(header.magic, TRACE_MAGIC, 4));
+  TEST_ASSERT_EQUAL(0, header.count);
+
+  trace.state_entered(1);
+  delay(20);
+  trace.event_handled(3, 150);
+  trace.state_exited(1);
+  trace.state_entered(2);
+
+  TEST_ASSERT_EQUAL(sizeof(StateTrace::Header) + 4 * sizeof(StateTrace::Entry),
+                    trace.serialize(buffer, sizeof(buffer)));
+  memcpy(&entry, buffer + sizeof(StateTrace::Header) + sizeof(StateTrace::Entry), sizeof(entry));
+  TEST_ASSERT_EQUAL(StateTrace::e_trace_event, entry.type);
+  TEST_ASSERT_EQUAL(3, entry.id);
+  TEST_ASSERT_EQUAL(150, entry.value);
+
+  auto stats = trace.get_dwell_stats(1);
+  TEST_ASSERT_EQUAL(1, stats.visits);
+  TEST_ASSERT_TRUE(stats.total >= 20);
+  TEST_ASSERT_EQUAL(stats.total, stats.max);
+  TEST_ASSERT_EQUAL(0, trace.get_dwell_stats(2).visits);
+
+  // Overflow, newest entries are kept
+  for(int i = 0; i < TRACE_SIZE + 10; ++i) {
+    trace.event_handled(i % 100, i);
+  }
+  trace.serialize(buffer, sizeof(buffer));
+  memcpy(&header, buffer, sizeof(header));
+  TEST_ASSERT_EQUAL(TRACE_SIZE, header.count);
+  TEST_ASSERT_EQUAL(4 + TRACE_SIZE + 10, header.total_recorded);
+  memcpy(&entry, buffer + sizeof(StateTrace::Header) + (TRACE_SIZE - 1) * sizeof(StateTrace::Entry), sizeof(entry));
+  TEST_ASSERT_EQUAL(TRACE_SIZE + 9, entry.value);
+
+  // Smaller buffer, newest entries that fit
+  TEST_ASSERT_EQUAL(sizeof(StateTrace::Header) + 2 * sizeof(StateTrace::Entry),
+                    trace.serialize(buffer, sizeof(StateTrace::Header) + 2 * sizeof(StateTrace::Entry) + 3));
+  memcpy(&entry, buffer + sizeof(StateTrace::Header) + sizeof(StateTrace::Entry), sizeof(entry));
+  TEST_ASSERT_EQUAL(TRACE_SIZE + 9, entry.value);
+
+  trace.clear();
+  TEST_ASSERT_EQUAL(sizeof(StateTrace::Header), trace.serialize(buffer, sizeof(buffer)));
+  TEST_ASSERT_EQUAL(0, trace.get_dwell_stats(1).visits);
+}
@@ -0,0 +1,17 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void test_state_trace();
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_state_trace);
+
+  UNITY_END();
+}
+
+void loop() {
+}
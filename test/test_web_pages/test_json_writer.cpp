@@ -0,0 +1,56 @@
+#include <unity.h>
+#include <StreamString.h>
+#include <json_writer.h>
+
+void test_json_writer() {
+  StreamString out;
+  JsonWriter json(out);
+  json.begin_object();
+  json.add("id", 1234);
+  json.add("name", "bGeigieCast");
+  json.add("active", true);
+  json.add("cpm", 35u);
+  json.add("latitude", 35.12345678, 5);
+  json.add_null("reading");
+  json.begin_array("values");
+  json.add(nullptr, -1);
+  json.add(nullptr, 2);
+  json.begin_object();
+  json.end_object();
+  json.end_array();
+  json.end_object();
+
+  TEST_ASSERT_TRUE(json.is_complete());
+  TEST_ASSERT_EQUAL_STRING(
+      "{\"id\":1234,\"name\":\"bGeigieCast\",\"active\":true,\"cpm\":35,\"latitude\":35.12346,\"reading\":null,"
+      "\"values\":[-1,2,{}]}",
+      out.c_str()
+  );
+}
+
+void test_json_writer_escaping() {
+  StreamString out;
+  JsonWriter json(out);
+  json.begin_object();
+  json.add("time", "\"quoted\"\\\n\x01");
+  json.add("nan", NAN);
+  json.end_object();
+
+  TEST_ASSERT_EQUAL_STRING("{\"time\":\"\\\"quoted\\\"\\\\\\n\\u0001\",\"nan\":null}", out.c_str());
+}
+
+void test_json_writer_max_depth() {
+  StreamString out;
+  JsonWriter json(out);
+  for(int i = 0; i < JSON_WRITER_MAX_DEPTH + 2; ++i) {
+    json.begin_array();
+  }
+  json.add(nullptr, 1);
+  for(int i = 0; i < JSON_WRITER_MAX_DEPTH + 2; ++i) {
+    json.end_array();
+  }
+
+  // Too deep values are left out, the output is still valid json
+  TEST_ASSERT_FALSE(json.is_complete());
+  TEST_ASSERT_EQUAL(JSON_WRITER_MAX_DEPTH * 2, out.length());
+}
@@ -0,0 +1,156 @@
+#include <unity.h>
+#include <StreamString.h>
+#include <http_pages.h>
+#include <web_assets.h>
+
+/**
+ * Check that a rendered page is complete
+ */
+void assert_complete_page(const StreamString& page) {
+  TEST_ASSERT_TRUE(page.startsWith("<!DOCTYPE html>"));
+  TEST_ASSERT_TRUE(page.endsWith("</body></html>"));
+}
+
+void test_render_home_page() {
+  StreamString page;
+  HttpPages::render_home_page(page, 1234);
+  assert_complete_page(page);
+  TEST_ASSERT_NOT_EQUAL(-1, page.indexOf("<title>Home | bGeigieCast 1234</title>"));
+}
+
+void test_render_update_page() {
+  StreamString page;
+  HttpPages::render_update_page(page, 1234);
+  assert_complete_page(page);
+}
+
+void test_render_config_device_page() {
+  StreamString default_page;
+  HttpPages::render_config_device_page(
+      default_page,
+      false,
+      1234,
+      0,
+      false
+  );
+  assert_complete_page(default_page);
+  TEST_ASSERT_EQUAL(-1, default_page.indexOf("Configurations saved!"));
+
+  StreamString saved_page;
+  HttpPages::render_config_device_page(
+      saved_page,
+      true,
+      1234,
+      100,
+      true
+  );
+  assert_complete_page(saved_page);
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("value='100'"));
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("Configurations saved!"));
+}
+
+void test_render_config_connection_page() {
+  WiFiProfile profiles[WIFI_PROFILE_COUNT]{};
+  strcpy(profiles[0].ssid, "some wifi ssid");
+  strcpy(profiles[0].password, "some wifi password");
+
+  StreamString default_page;
+  HttpPages::render_config_connection_page(
+      default_page,
+      false,
+      1234,
+      "some ap password",
+      profiles,
+      "some pai key",
+      false,
+      ""
+  );
+  assert_complete_page(default_page);
+
+  strcpy(profiles[0].ssid, "new wifi ssid");
+  strcpy(profiles[2].ssid, "other wifi ssid");
+  profiles[2].priority = 5;
+
+  StreamString saved_page;
+  HttpPages::render_config_connection_page(
+      saved_page,
+      true,
+      1234,
+      "new ap password",
+      profiles,
+      "new pai key",
+      true,
+      "http://192.168.1.10:8000/manifest.txt"
+  );
+  assert_complete_page(saved_page);
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("value='new wifi ssid'"));
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("name='" FORM_NAME_WIFI_SSID "2' id='" FORM_NAME_WIFI_SSID "2' "
+                                               "placeholder='Network name' value='other wifi ssid'"));
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("name='" FORM_NAME_WIFI_PRIORITY "2' placeholder='Priority' value='5'"));
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("value='http://192.168.1.10:8000/manifest.txt'"));
+}
+
+void test_render_config_location_page() {
+  StreamString default_page;
+  HttpPages::render_config_location_page(
+      default_page,
+      false,
+      1234,
+      false,
+      0,
+      0,
+      0,
+      0
+  );
+  assert_complete_page(default_page);
+
+  StreamString saved_page;
+  HttpPages::render_config_location_page(
+      saved_page,
+      true,
+      1234,
+      true,
+      -123.45678,
+      123.45678,
+      -123.45678,
+      123.45678
+  );
+  assert_complete_page(saved_page);
+  TEST_ASSERT_NOT_EQUAL(-1, saved_page.indexOf("value='-123.45678'"));
+}
+
+const WebAsset* find_asset(const char* path) {
+  for(const auto& asset : web_assets) {
+    if(strcmp(asset.path, path) == 0) {
+      return &asset;
+    }
+  }
+  return nullptr;
+}
+
+void test_pure_css() {
+  auto asset = find_asset("/pure.css");
+  TEST_ASSERT_NOT_NULL(asset);
+  TEST_ASSERT_TRUE(asset->gzipped);
+  // gzip magic
+  TEST_ASSERT_EQUAL_HEX8(0x1f, asset->data[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x8b, asset->data[1]);
+  TEST_ASSERT_EQUAL_STRING("\"" ASSET_VERSION_PURE_CSS "\"", asset->etag);
+}
+
+void test_favicon() {
+  auto asset = find_asset("/favicon.ico");
+  TEST_ASSERT_NOT_NULL(asset);
+  // Already compressed
+  TEST_ASSERT_FALSE(asset->gzipped);
+}
+
+void test_render_pages_reference_asset_versions() {
+  StreamString page;
+  HttpPages::render_update_page(page, 1234);
+  TEST_ASSERT_NOT_EQUAL(-1, page.indexOf("/pure.css?v=" ASSET_VERSION_PURE_CSS));
+  TEST_ASSERT_NOT_EQUAL(-1, page.indexOf("/update.js?v=" ASSET_VERSION_UPDATE_JS));
+  // No inline styles or scripts left in the page
+  TEST_ASSERT_EQUAL(-1, page.indexOf("<style>"));
+  TEST_ASSERT_EQUAL(-1, page.indexOf("<script>"));
+}
@@ -0,0 +1,37 @@
+#include <Arduino.h>
+#include <unity.h>
+
+void test_render_home_page();
+void test_render_update_page();
+void test_render_config_device_page();
+void test_render_config_connection_page();
+void test_render_config_location_page();
+void test_pure_css();
+void test_favicon();
+void test_render_pages_reference_asset_versions();
+void test_json_writer();
+void test_json_writer_escaping();
+void test_json_writer_max_depth();
+
+void setup() {
+  delay(2000);
+
+  UNITY_BEGIN();
+
+  RUN_TEST(test_render_home_page);
+  RUN_TEST(test_render_update_page);
+  RUN_TEST(test_render_config_device_page);
+  RUN_TEST(test_render_config_connection_page);
+  RUN_TEST(test_render_config_location_page);
+  RUN_TEST(test_pure_css);
+  RUN_TEST(test_favicon);
+  RUN_TEST(test_render_pages_reference_asset_versions);
+  RUN_TEST(test_json_writer);
+  RUN_TEST(test_json_writer_escaping);
+  RUN_TEST(test_json_writer_max_depth);
+
+  UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Decode a bGeigieCast state machine trace and print the timeline and dwell times per state.
+
+The trace can be downloaded from the device (http://<device>/trace) or dumped on the serial monitor by sending `t`,
+which prints a line starting with `TRACE:` followed by the trace in hex.
+
+usage:
+    decode_trace.py trace.bin
+    decode_trace.py serial.log
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"SMTR"
+VERSION = 1
+HEADER = struct.Struct("<4sBBHII")
+ENTRY = struct.Struct("<IIBb")
+
+# ControllerState::StateId in sm_c_state.h
+STATES = [
+    "Initialize",
+    "InitReading",
+    "PostInitialize",
+    "ConfigurationMode",
+    "MobileMode",
+    "FixedMode",
+    "Reset",
+]
+
+# Event_enum in sm_events.h
+EVENTS = [
+    "button_pressed",
+    "button_long_pressed",
+    "controller_initialized",
+    "reading_initialized",
+    "post_init_time_passed",
+    "report_success",
+    "button_double_pressed",
+]
+
+ENTRY_STATE_ENTRY = 0
+ENTRY_STATE_EXIT = 1
+ENTRY_EVENT = 2
+
+
+def name(names, index):
+    return names[index] if 0 <= index < len(names) else "unknown({})".format(index)
+
+
+def load(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data.startswith(MAGIC):
+        return data
+    # Serial log, use the last dump
+    for line in reversed(data.decode(errors="ignore").splitlines()):
+        line = line.strip()
+        if line.startswith("TRACE:"):
+            return bytes.fromhex(line[len("TRACE:"):])
+    raise ValueError("No trace found in {}".format(path))
+
+
+def decode(data):
+    magic, version, entry_size, count, total, now = HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION or entry_size != ENTRY.size:
+        raise ValueError("Unsupported trace (magic {}, version {}, entry size {})".format(magic, version, entry_size))
+    entries = []
+    offset = HEADER.size
+    for _ in range(count):
+        entries.append(ENTRY.unpack_from(data, offset))
+        offset += ENTRY.size
+    return total, now, entries
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("file", help="binary trace or serial log")
+    args = parser.parse_args()
+
+    try:
+        total, now, entries = decode(load(args.file))
+    except (OSError, ValueError, struct.error) as e:
+        print(e, file=sys.stderr)
+        return 1
+
+    print("Trace at {} ms, {} entries ({} lost)".format(now, len(entries), total - len(entries)))
+    print()
+
+    dwell = {}
+    for time, value, entry_type, entry_id in entries:
+        if entry_type == ENTRY_STATE_ENTRY:
+            print("{:>10} ms  -> {}".format(time, name(STATES, entry_id)))
+        elif entry_type == ENTRY_STATE_EXIT:
+            print("{:>10} ms  <- {} after {} ms".format(time, name(STATES, entry_id), value))
+            visits, dwell_total, dwell_max = dwell.get(entry_id, (0, 0, 0))
+            dwell[entry_id] = (visits + 1, dwell_total + value, max(dwell_max, value))
+        elif entry_type == ENTRY_EVENT:
+            print("{:>10} ms     event {} (latency {} us)".format(time, name(EVENTS, entry_id), value))
+        else:
+            print("{:>10} ms     unknown entry type {}".format(time, entry_type))
+
+    print()
+    print("Dwell times in trace:")
+    print("{:<20}{:>8}{:>12}{:>12}{:>12}".format("state", "visits", "total ms", "avg ms", "max ms"))
+    for state_id, (visits, dwell_total, dwell_max) in sorted(dwell.items()):
+        print("{:<20}{:>8}{:>12}{:>12}{:>12}".format(
+            name(STATES, state_id), visits, dwell_total, dwell_total // visits, dwell_max))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
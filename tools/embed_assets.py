@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""
+Embed the static resources of the configuration server (web/) in the firmware.
+
+Each resource is gzip compressed (unless that does not make it smaller) and gets a content hash, which is used as
+ETag and as version in the urls of the pages. Generates bgeigiecast/web_assets.h and bgeigiecast/web_assets.cpp, only
+rewritten when the content changed.
+
+Runs before every PlatformIO build (extra_scripts in platformio.ini), or manually:
+    embed_assets.py
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ASSETS = [
+    # file in web/, url, content type
+    ("pure.css", "/pure.css", "text/css"),
+    ("style.css", "/style.css", "text/css"),
+    ("menu.js", "/menu.js", "application/javascript"),
+    ("update.js", "/update.js", "application/javascript"),
+    ("status.js", "/status.js", "application/javascript"),
+    ("favicon.ico", "/favicon.ico", "image/x-icon"),
+]
+
+HEADER_TEMPLATE = """\
+// Generated by tools/embed_assets.py from web/, do not edit
+#ifndef BGEIGIECAST_WEB_ASSETS_H
+#define BGEIGIECAST_WEB_ASSETS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define WEB_ASSET_COUNT {count}
+
+// Content hashes, to version the asset urls in the pages
+{versions}
+
+/**
+ * Static resource of the configuration server, stored in flash
+ */
+struct WebAsset {{
+  const char* path;
+  const char* content_type;
+  const char* etag;
+  bool gzipped;
+  const uint8_t* data;
+  size_t size;
+}};
+
+extern const WebAsset web_assets[WEB_ASSET_COUNT];
+
+#endif //BGEIGIECAST_WEB_ASSETS_H
+"""
+
+SOURCE_TEMPLATE = """\
+// Generated by tools/embed_assets.py from web/, do not edit
+#include "web_assets.h"
+
+{arrays}
+const WebAsset web_assets[WEB_ASSET_COUNT] = {{
+{entries}
+}};
+"""
+
+
+def identifier(file_name):
+    return re.sub(r"[^A-Za-z0-9]", "_", file_name).upper()
+
+
+def byte_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return "static const uint8_t %s[%d] = {\n%s\n};\n" % (name, len(data), ",\n".join(lines))
+
+
+def write_if_changed(path, content):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == content:
+                return
+    with open(path, "w") as f:
+        f.write(content)
+    print("embed_assets: generated %s" % path)
+
+
+def generate(project_dir):
+    versions = []
+    arrays = []
+    entries = []
+    for file_name, url, content_type in ASSETS:
+        with open(os.path.join(project_dir, "web", file_name), "rb") as f:
+            raw = f.read()
+        version = hashlib.sha256(raw).hexdigest()[:16]
+        # mtime 0 so the output only depends on the content
+        compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+        gzipped = len(compressed) < len(raw)
+        data = compressed if gzipped else raw
+
+        name = "asset_" + identifier(file_name).lower()
+        versions.append('#define ASSET_VERSION_%s "%s"' % (identifier(file_name), version))
+        arrays.append(byte_array(name, data))
+        entries.append('    {"%s", "%s", "\\"%s\\"", %s, %s, %d},' % (
+            url, content_type, version, "true" if gzipped else "false", name, len(data)))
+
+    out_dir = os.path.join(project_dir, "bgeigiecast")
+    write_if_changed(os.path.join(out_dir, "web_assets.h"), HEADER_TEMPLATE.format(
+        count=len(ASSETS),
+        versions="\n".join(versions),
+    ))
+    write_if_changed(os.path.join(out_dir, "web_assets.cpp"), SOURCE_TEMPLATE.format(
+        arrays="\n".join(arrays),
+        entries="\n".join(entries),
+    ))
+
+
+try:
+    # Running as PlatformIO extra script
+    Import("env")
+    generate(env.subst("$PROJECT_DIR"))
+except NameError:
+    if __name__ == "__main__":
+        generate(os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")))
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Publish a firmware image for devices that pull their updates (update url in the device settings).
+
+Writes the image, the manifest and optionally a delta patch from the previous release to a directory, which can be
+served by any static HTTP server that supports range requests, or by this script with `--serve`.
+
+usage:
+    ota_publish.py .pio/build/bGeigieCast/firmware.bin --version 1.4 --out updates
+    ota_publish.py firmware.bin --version 1.4 --previous old/firmware.bin --previous-version 1.3 --out updates
+    ota_publish.py --serve 8000 --out updates
+
+Set the update url of the devices to http://<host>:8000/manifest.txt
+"""
+
+import argparse
+import hashlib
+import http.server
+import os
+import re
+import shutil
+import struct
+import sys
+
+# DeltaPatcher in bgeigiecast/delta_patch.h
+MAGIC = b"BGCD"
+VERSION = 1
+HEADER = struct.Struct("<4sB3xII")
+COPY = struct.Struct("<cII")
+INSERT = struct.Struct("<cI")
+END = b"E"
+
+BLOCK_SIZE = 16  # Smallest match that is copied from the source
+
+
+def make_patch(source, target):
+    """
+    Greedy block matching: every aligned block of the source is indexed, the target is scanned at every offset and
+    matches are extended in both directions.
+    """
+    index = {}
+    for offset in range(0, len(source) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        index.setdefault(source[offset:offset + BLOCK_SIZE], offset)
+
+    patch = bytearray(HEADER.pack(MAGIC, VERSION, len(source), len(target)))
+
+    def insert(data):
+        if data:
+            patch.extend(INSERT.pack(b"I", len(data)))
+            patch.extend(data)
+
+    position = 0
+    literal_start = 0
+    while position + BLOCK_SIZE <= len(target):
+        offset = index.get(target[position:position + BLOCK_SIZE])
+        if offset is None:
+            position += 1
+            continue
+        start, source_start = position, offset
+        while start > literal_start and source_start > 0 and target[start - 1] == source[source_start - 1]:
+            start -= 1
+            source_start -= 1
+        end, source_end = position + BLOCK_SIZE, offset + BLOCK_SIZE
+        while end < len(target) and source_end < len(source) and target[end] == source[source_end]:
+            end += 1
+            source_end += 1
+        insert(target[literal_start:start])
+        patch.extend(COPY.pack(b"C", source_start, end - start))
+        position = literal_start = end
+    insert(target[literal_start:])
+    patch.extend(END)
+    return bytes(patch)
+
+
+def apply_patch(source, patch):
+    """
+    Reference implementation of the device side, used to verify each patch before publishing it
+    """
+    magic, version, source_size, target_size = HEADER.unpack_from(patch)
+    if magic != MAGIC or version != VERSION or source_size != len(source):
+        raise ValueError("invalid patch header")
+    target = bytearray()
+    position = HEADER.size
+    while patch[position:position + 1] != END:
+        operation = patch[position:position + 1]
+        if operation == b"C":
+            _, offset, length = COPY.unpack_from(patch, position)
+            target.extend(source[offset:offset + length])
+            position += COPY.size
+        elif operation == b"I":
+            _, length = INSERT.unpack_from(patch, position)
+            position += INSERT.size
+            target.extend(patch[position:position + length])
+            position += length
+        else:
+            raise ValueError("invalid operation at %d" % position)
+    if len(target) != target_size:
+        raise ValueError("invalid target size")
+    return bytes(target)
+
+
+def publish(args):
+    if not re.match(r"^v?\d+(\.\d+)*$", args.version):
+        sys.exit("version must be dotted numeric, like 1.4.2")
+    os.makedirs(args.out, exist_ok=True)
+    with open(args.image, "rb") as f:
+        image = f.read()
+
+    image_name = "bgeigiecast-%s.bin" % args.version
+    shutil.copyfile(args.image, os.path.join(args.out, image_name))
+    manifest = [
+        "version=%s" % args.version,
+        "size=%d" % len(image),
+        "sha256=%s" % hashlib.sha256(image).hexdigest(),
+        "url=%s" % image_name,
+    ]
+
+    if args.previous:
+        with open(args.previous, "rb") as f:
+            previous = f.read()
+        patch = make_patch(previous, image)
+        if apply_patch(previous, patch) != image:
+            sys.exit("patch verification failed")
+        patch_name = "bgeigiecast-%s-%s.patch" % (args.previous_version, args.version)
+        with open(os.path.join(args.out, patch_name), "wb") as f:
+            f.write(patch)
+        manifest += [
+            "delta_from=%s" % args.previous_version,
+            "delta_url=%s" % patch_name,
+            "delta_size=%d" % len(patch),
+        ]
+        print("patch: %d bytes (%.1f%% of the image)" % (len(patch), 100.0 * len(patch) / len(image)))
+
+    with open(os.path.join(args.out, "manifest.txt"), "w") as f:
+        f.write("\n".join(manifest) + "\n")
+    print("\n".join(manifest))
+
+
+class RangeRequestHandler(http.server.SimpleHTTPRequestHandler):
+    """
+    Static file server with single `bytes=<start>-` ranges, used by the devices to resume downloads
+    """
+
+    def send_head(self):
+        match = re.match(r"^bytes=(\d+)-$", self.headers.get("Range", ""))
+        path = self.translate_path(self.path)
+        if not match or not os.path.isfile(path):
+            return super().send_head()
+        size = os.path.getsize(path)
+        start = int(match.group(1))
+        if start >= size:
+            self.send_error(416)
+            return None
+        f = open(path, "rb")
+        f.seek(start)
+        self.send_response(206)
+        self.send_header("Content-Type", self.guess_type(path))
+        self.send_header("Content-Length", str(size - start))
+        self.send_header("Content-Range", "bytes %d-%d/%d" % (start, size - 1, size))
+        self.end_headers()
+        return f
+
+
+def serve(args):
+    os.chdir(args.out)
+    server = http.server.ThreadingHTTPServer(("", args.serve), RangeRequestHandler)
+    print("serving %s on port %d" % (args.out, args.serve))
+    server.serve_forever()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Publish firmware for pull based updates")
+    parser.add_argument("image", nargs="?", help="firmware image (.bin)")
+    parser.add_argument("--version", help="version of the image, compared with BGEIGIECAST_VERSION")
+    parser.add_argument("--out", default="updates", help="output directory")
+    parser.add_argument("--previous", help="image of the previous release, to create a delta patch")
+    parser.add_argument("--previous-version", help="version of the previous image")
+    parser.add_argument("--serve", type=int, metavar="PORT", help="serve the output directory")
+    args = parser.parse_args()
+
+    if args.image:
+        if not args.version:
+            parser.error("--version is required")
+        if args.previous and not args.previous_version:
+            parser.error("--previous-version is required with --previous")
+        publish(args)
+    elif not args.serve:
+        parser.error("an image or --serve is required")
+    if args.serve:
+        serve(args)
+
+
+if __name__ == "__main__":
+    main()
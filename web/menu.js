@@ -0,0 +1 @@
+document.querySelectorAll('.pure-menu-item').forEach((e)=>e.children[0].href===window.location.href?e.classList.add('pure-menu-selected'):0);
@@ -0,0 +1,19 @@
+(d => {
+  const out = d.getElementById('status');
+  const member = m => `${m.name} [${m.state}]\n - Status: ${m.status}\n`;
+  const update = () => fetch('/api/status').then(r => r.json()).then(s => {
+    const r = s.reading;
+    out.textContent =
+      `bGeigieCast ${s.device_id} version ${s.version}\n` +
+      ` - Uptime: ${s.uptime} s\n` +
+      ` - Free heap: ${s.heap.free} bytes (min ${s.heap.min_free})\n` +
+      ` - WiFi: ${s.wifi.connected ? `connected, RSSI ${s.wifi.rssi} dBm` : 'not connected'}\n` +
+      ` - Upload backlog: ${s.api.backlog === null ? '-' : s.api.backlog}\n` +
+      (r ? `Last reading (${Math.round(r.age / 1000)} s ago)\n - ${r.cpm} CPM, valid: ${r.valid ? 'yes' : 'no'}\n`
+         : 'No reading yet\n') +
+      s.workers.map(member).join('') +
+      s.handlers.map(member).join('');
+  }).catch(() => out.textContent = 'Unable to get the status');
+  update();
+  setInterval(update, 5000);
+})(document);
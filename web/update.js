@@ -0,0 +1 @@
+(e=>{const t=(...t)=>e.querySelector(...t),n=t('form'),a=t('#status');n.addEventListener('submit',e=>{e.preventDefault();const o=t('#file').files[0],d=new XMLHttpRequest;o?(n.classList.add('uploading'),d.addEventListener('load',e=>{if(d.status!==200){a.innerText='Update failed ('+d.responseText+')... Try again or contact info@safecast.org',n.classList.remove('uploading');return}a.innerText='Applying update...';setTimeout(()=>{a.innerText='Upload success! Restarting device to apply update.';const t=new XMLHttpRequest;t.open('get','/reboot'),t.send()},2000)}),d.addEventListener('error',e=>{a.innerText='Upload failed... Try again or contact info@safecast.org',n.classList.remove('uploading')}),d.addEventListener('abort',e=>{a.innerText='Upload cancelled...'}),d.upload.addEventListener('progress',e=>{if(e.lengthComputable){a.innerText='Uploading new firmware... This can take up to 10 minutes.';const n=Math.round(e.loaded/e.total*100)+'%';t('#prg').innerText=n,t('#bar').style.width=n}}),d.open(n.method,n.action),d.setRequestHeader('Content-Type','application/octet-stream'),t('#sha256').value&&d.setRequestHeader('X-Firmware-SHA256',t('#sha256').value.trim()),d.send(o)):a.innerText='Please select a file...'})})(this.document);